@@ -211,6 +211,7 @@ void AFederationCharacter::UpdateCameraForSpaceMode()
 
 void AFederationCharacter::Tick(float DeltaSeconds)
 {
+	QUICK_SCOPE_CYCLE_COUNTER(STAT_FederationCharacter_Tick);
 	Super::Tick(DeltaSeconds);
 
 	const bool bIsFalling = GetCharacterMovement() && GetCharacterMovement()->MovementMode == MOVE_Falling;
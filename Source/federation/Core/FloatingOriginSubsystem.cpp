@@ -0,0 +1,156 @@
+// Copyright Federation Game. All Rights Reserved.
+
+#include "Core/FloatingOriginSubsystem.h"
+#include "Planet/GravitySourceSubsystem.h"
+#include "Planet/OrbitalMechanicsSubsystem.h"
+#include "Planet/PlanetStreamingSubsystem.h"
+#include "Engine/Engine.h"
+#include "Engine/Level.h"
+#include "Engine/LevelStreaming.h"
+#include "Engine/World.h"
+#include "GameFramework/Pawn.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformTime.h"
+#include "Kismet/GameplayStatics.h"
+#include "LevelUtils.h"
+
+static FAutoConsoleCommand CmdFloatingOriginStats(
+	TEXT("Fed.Origin.Stats"),
+	TEXT("Log the world origin and the cost of origin rebases (total and per shifted actor) for every world."),
+	FConsoleCommandDelegate::CreateLambda([]()
+	{
+		if (!GEngine) return;
+		for (const FWorldContext& Context : GEngine->GetWorldContexts())
+		{
+			UWorld* World = Context.World();
+			const UFloatingOriginSubsystem* Sub = World ? World->GetSubsystem<UFloatingOriginSubsystem>() : nullptr;
+			if (!Sub) continue;
+			const FFloatingOriginStats& Stats = Sub->GetStats();
+			UE_LOG(LogTemp, Log, TEXT("%s: origin %s, %d rebases; last %.2f ms (cache pass %.2f ms) over %d actors = %.2f us/actor; average %.2f us/actor"),
+				*World->GetName(), *Sub->GetOriginLocation().ToString(), Stats.NumRebases, Stats.LastRebaseMs, Stats.LastCachePassMs,
+				Stats.LastNumActors, Stats.GetLastMicrosPerActor(), Stats.GetAverageMicrosPerActor());
+		}
+	})
+);
+
+static FAutoConsoleCommand CmdFloatingOriginRebase(
+	TEXT("Fed.Origin.Rebase"),
+	TEXT("Rebase the world origin onto the player now, regardless of distance (measures rebase cost)."),
+	FConsoleCommandDelegate::CreateLambda([]()
+	{
+		if (!GEngine) return;
+		for (const FWorldContext& Context : GEngine->GetWorldContexts())
+		{
+			UWorld* World = Context.World();
+			UFloatingOriginSubsystem* Sub = World && World->IsGameWorld() ? World->GetSubsystem<UFloatingOriginSubsystem>() : nullptr;
+			const APawn* Pawn = Sub ? UGameplayStatics::GetPlayerPawn(World, 0) : nullptr;
+			if (Pawn && !Sub->RebaseOrigin(Pawn->GetActorLocation()))
+			{
+				UE_LOG(LogTemp, Warning, TEXT("FloatingOriginSubsystem: %s refused the rebase (level becoming visible); try again"), *World->GetName());
+			}
+		}
+	})
+);
+
+void UFloatingOriginSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	// The origin is per process: a client or listen server rebasing would disagree with its peers.
+	UWorld* World = GetWorld();
+	if (!World || !World->IsGameWorld() || World->GetNetMode() != NM_Standalone || RebaseDistance <= 0.0) return;
+
+	const APawn* Pawn = UGameplayStatics::GetPlayerPawn(World, 0);
+	if (!Pawn) return;
+
+	const FVector Location = Pawn->GetActorLocation();
+	if (Location.SizeSquared() > RebaseDistance * RebaseDistance)
+	{
+		// A refusal is transient; the next frame tries again.
+		RebaseOrigin(Location);
+	}
+}
+
+TStatId UFloatingOriginSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UFloatingOriginSubsystem, STATGROUP_Tickables);
+}
+
+FIntVector UFloatingOriginSubsystem::GetOriginLocation() const
+{
+	const UWorld* World = GetWorld();
+	return World ? World->OriginLocation : FIntVector::ZeroValue;
+}
+
+bool UFloatingOriginSubsystem::RebaseOrigin(const FVector& NewLocalOrigin)
+{
+	QUICK_SCOPE_CYCLE_COUNTER(STAT_FloatingOrigin_Rebase);
+
+	UWorld* World = GetWorld();
+	if (!World) return false;
+
+	const FIntVector Shift(FMath::RoundToInt(NewLocalOrigin.X), FMath::RoundToInt(NewLocalOrigin.Y), FMath::RoundToInt(NewLocalOrigin.Z));
+	if (Shift == FIntVector::ZeroValue) return true;
+
+	// Counted before the shift: the same levels the engine is about to move.
+	int32 NumActors = 0;
+	for (const ULevel* Level : World->GetLevels())
+	{
+		if (Level && (Level->bIsVisible || Level->IsPersistentLevel()))
+		{
+			NumActors += Level->Actors.Num();
+		}
+	}
+
+	const double StartSeconds = FPlatformTime::Seconds();
+	if (!World->SetNewWorldOrigin(World->OriginLocation + Shift)) return false;
+
+	// Everything moves opposite to the origin.
+	const double CacheStartSeconds = FPlatformTime::Seconds();
+	ShiftCachedPositions(-FVector(Shift));
+	const double EndSeconds = FPlatformTime::Seconds();
+
+	++Stats.NumRebases;
+	Stats.LastRebaseMs = (EndSeconds - StartSeconds) * 1000.0;
+	Stats.LastCachePassMs = (EndSeconds - CacheStartSeconds) * 1000.0;
+	Stats.LastNumActors = NumActors;
+	Stats.TotalRebaseMs += Stats.LastRebaseMs;
+	Stats.TotalActors += NumActors;
+
+	UE_LOG(LogTemp, Log, TEXT("FloatingOriginSubsystem: origin now %s (shift %s), %.2f ms over %d actors (%.2f us/actor)"),
+		*World->OriginLocation.ToString(), *Shift.ToString(), Stats.LastRebaseMs, NumActors, Stats.GetLastMicrosPerActor());
+	return true;
+}
+
+void UFloatingOriginSubsystem::ShiftCachedPositions(const FVector& Offset)
+{
+	UWorld* World = GetWorld();
+
+	// Orbits first: the gravity refresh reads orbiting sources' propagated positions.
+	if (UOrbitalMechanicsSubsystem* Orbits = World->GetSubsystem<UOrbitalMechanicsSubsystem>())
+	{
+		Orbits->ApplyOriginOffset(Offset);
+	}
+	if (UGravitySourceSubsystem* Gravity = World->GetSubsystem<UGravitySourceSubsystem>())
+	{
+		Gravity->ApplyOriginOffset(Offset);
+	}
+	if (UPlanetStreamingSubsystem* Streaming = World->GetSubsystem<UPlanetStreamingSubsystem>())
+	{
+		Streaming->ApplyOriginOffset(Offset);
+	}
+}
+
+void UFloatingOriginSubsystem::ShiftLevelInstance(ULevelStreaming* Level, const FVector& Offset)
+{
+	if (!Level) return;
+
+	// Visible levels were shifted by the engine. A hidden level whose actors were already placed (shown
+	// before, e.g. pooled) is not, so move it here; one never shown is placed from LevelTransform later.
+	ULevel* Loaded = Level->GetLoadedLevel();
+	if (Loaded && !Loaded->bIsVisible && Loaded->bAlreadyMovedActors)
+	{
+		FLevelUtils::ApplyLevelTransform(Loaded, FTransform(Offset), false);
+	}
+	Level->LevelTransform.AddToTranslation(Offset);
+}
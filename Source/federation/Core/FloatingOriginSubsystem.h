@@ -0,0 +1,83 @@
+// Copyright Federation Game. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "FloatingOriginSubsystem.generated.h"
+
+class ULevelStreaming;
+
+/** Cost of origin rebases (see UFloatingOriginSubsystem::RebaseOrigin). */
+struct FFloatingOriginStats
+{
+	int32 NumRebases = 0;
+
+	/** Wall time of the last rebase: engine shift of every visible level plus the cache pass. */
+	double LastRebaseMs = 0.0;
+	/** Part of LastRebaseMs spent shifting orbital, gravity and surface pool caches. */
+	double LastCachePassMs = 0.0;
+	/** Actors in the levels the engine shifted on the last rebase. */
+	int32 LastNumActors = 0;
+
+	double TotalRebaseMs = 0.0;
+	int64 TotalActors = 0;
+
+	double GetLastMicrosPerActor() const { return LastNumActors > 0 ? LastRebaseMs * 1000.0 / LastNumActors : 0.0; }
+	double GetAverageMicrosPerActor() const { return TotalActors > 0 ? TotalRebaseMs * 1000.0 / TotalActors : 0.0; }
+};
+
+/**
+ * Floating origin: keeps the player near (0,0,0) in engine space so physics and rendering stay precise
+ * at galaxy scale. Once the player is further than RebaseDistance from the origin, the world origin is
+ * moved under them (UWorld::SetNewWorldOrigin shifts every visible level, physics and the render scene).
+ *
+ * Positions cached outside actors are shifted in the same pass: orbital body state, the gravity source
+ * cache and queued ground probes, and the hidden surface levels held by UPlanetStreamingSubsystem's pool.
+ * UPlanetSurfaceStreamer shifts its own surface frame, saved space position and level placements from
+ * ApplyWorldOffset. Waypoints and star fields hold no world positions of their own and move with their actors.
+ *
+ * Rebase through RebaseOrigin (not SetNewWorldOrigin directly) so those caches follow. Each rebase is
+ * timed and its cost per shifted actor recorded; Fed.Origin.Stats logs it.
+ */
+UCLASS()
+class FEDERATION_API UFloatingOriginSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	/** Rebase once the player is further than this from the engine origin (UU). 0 disables automatic rebasing. */
+	double RebaseDistance = 1000000.0;
+
+	/**
+	 * Moves the world origin so NewLocalOrigin (a position in current engine space, rounded to whole UU)
+	 * becomes (0,0,0), then shifts the cached positions. False if the engine refused (a level is partway
+	 * through becoming visible); try again next frame.
+	 */
+	bool RebaseOrigin(const FVector& NewLocalOrigin);
+
+	/** Engine origin in absolute (galaxy) coordinates. */
+	FIntVector GetOriginLocation() const;
+
+	FVector LocalToAbsolute(const FVector& LocalPosition) const { return LocalPosition + FVector(GetOriginLocation()); }
+	FVector AbsoluteToLocal(const FVector& AbsolutePosition) const { return AbsolutePosition - FVector(GetOriginLocation()); }
+
+	const FFloatingOriginStats& GetStats() const { return Stats; }
+	void ResetStats() { Stats = FFloatingOriginStats(); }
+
+	/**
+	 * Keeps a streamed level instance in step with an origin shift: its LevelTransform always moves, and so
+	 * do the actors of a loaded but hidden level (the engine only shifts visible levels). Levels never shown
+	 * yet are placed from the moved LevelTransform when they become visible.
+	 */
+	static void ShiftLevelInstance(ULevelStreaming* Level, const FVector& Offset);
+
+private:
+	/** Orbital state, gravity caches and the surface pool; positions there don't belong to any actor. */
+	void ShiftCachedPositions(const FVector& Offset);
+
+	FFloatingOriginStats Stats;
+};
@@ -2,6 +2,17 @@
 
 #include "GalaxyStarField.h"
 #include "Components/InstancedStaticMeshComponent.h"
+#include "Async/ParallelFor.h"
+#include "Math/RandomStream.h"
+
+namespace GalaxyStarField
+{
+	/** Stars per generation chunk. Part of the output: changing it changes every seeded galaxy. */
+	constexpr int32 StarsPerChunk = 1024;
+
+	/** R, G, B, Intensity per star. */
+	constexpr int32 NumCustomDataFloats = 4;
+}
 
 AGalaxyStarField::AGalaxyStarField()
 {
@@ -18,7 +29,7 @@ AGalaxyStarField::AGalaxyStarField()
 	
 	// Set up custom data for per-instance color variation
 	// We use 4 floats: R, G, B, Intensity
-	StarMeshComponent->NumCustomDataFloats = 4;
+	StarMeshComponent->NumCustomDataFloats = GalaxyStarField::NumCustomDataFloats;
 }
 
 void AGalaxyStarField::BeginPlay()
@@ -70,127 +81,116 @@ int32 AGalaxyStarField::GetStarCount() const
 
 void AGalaxyStarField::GenerateSpiralGalaxy()
 {
+	QUICK_SCOPE_CYCLE_COUNTER(STAT_GalaxyStarField_Generate);
+
 	if (!StarMeshComponent || StarCount <= 0)
 	{
 		return;
 	}
 	
-	// Initialize random stream with seed for reproducibility
-	FRandomStream RandomStream(RandomSeed);
-	
-	// Pre-allocate instance transforms for better performance
 	TArray<FTransform> InstanceTransforms;
-	InstanceTransforms.Reserve(StarCount);
-	
-	// Store color data to apply after adding instances
-	TArray<FLinearColor> StarColors;
-	StarColors.Reserve(StarCount);
-	
-	// Calculate how many stars go in the core vs arms
-	const int32 CoreStarCount = FMath::RoundToInt(StarCount * CoreDensity);
-	const int32 ArmStarCount = StarCount - CoreStarCount;
-	const int32 StarsPerArm = SpiralArmCount > 0 ? ArmStarCount / SpiralArmCount : 0;
+	TArray<float> CustomData;
+	BuildStarInstances(InstanceTransforms, CustomData);
 	
-	// Generate core stars (dense central region)
-	for (int32 i = 0; i < CoreStarCount; ++i)
+	// Batch add all instances, then fill their custom data in one pass. Setting values per instance
+	// goes through the component's per-call bookkeeping 4 times per star; the instances were just
+	// added, so one write and one render state update cover them all.
+	StarMeshComponent->AddInstances(InstanceTransforms, false);
+	if (ensure(StarMeshComponent->PerInstanceSMCustomData.Num() == CustomData.Num()))
 	{
-		// Core stars are distributed in a sphere with higher density toward center
-		const float CoreRadius = GalaxyRadius * 0.2f; // Core is 20% of galaxy radius
-		const float Distance = FMath::Pow(RandomStream.FRand(), 2.0f) * CoreRadius;
-		const float Theta = RandomStream.FRand() * 2.0f * PI;
-		const float Phi = FMath::Acos(2.0f * RandomStream.FRand() - 1.0f);
-		
-		FVector Position;
-		Position.X = Distance * FMath::Sin(Phi) * FMath::Cos(Theta);
-		Position.Y = Distance * FMath::Sin(Phi) * FMath::Sin(Theta);
-		Position.Z = Distance * FMath::Cos(Phi) * (GalaxyThickness / GalaxyRadius); // Flatten to disk
-		
-		// Random scale variation
-		const float ScaleMultiplier = RandomStream.FRandRange(MinStarScaleMultiplier, MaxStarScaleMultiplier);
-		const float FinalScale = StarScale * ScaleMultiplier;
-		
-		FTransform StarTransform;
-		StarTransform.SetLocation(Position);
-		StarTransform.SetScale3D(FVector(FinalScale));
-		InstanceTransforms.Add(StarTransform);
-		
-		// Core stars tend to be older (redder/yellower)
-		const float Temperature = RandomStream.FRandRange(0.2f, 0.6f);
-		StarColors.Add(GetStarColor(Temperature));
+		FMemory::Memcpy(StarMeshComponent->PerInstanceSMCustomData.GetData(), CustomData.GetData(), CustomData.Num() * sizeof(float));
+		StarMeshComponent->MarkRenderStateDirty();
 	}
+}
+
+void AGalaxyStarField::BuildStarInstances(TArray<FTransform>& OutTransforms, TArray<float>& OutCustomData, bool bSingleThreaded) const
+{
+	const int32 NumStars = FMath::Max(0, StarCount);
+	OutTransforms.SetNumUninitialized(NumStars);
+	OutCustomData.SetNumUninitialized(NumStars * GalaxyStarField::NumCustomDataFloats);
 	
-	// Generate spiral arm stars
+	// Calculate how many stars go in the core vs arms; each star's group follows from its index alone
+	const int32 CoreStarCount = FMath::Clamp(FMath::RoundToInt(NumStars * CoreDensity), 0, NumStars);
+	const int32 ArmStarCount = NumStars - CoreStarCount;
+	const int32 StarsPerArm = SpiralArmCount > 0 ? ArmStarCount / SpiralArmCount : 0;
+	const int32 ArmEnd = CoreStarCount + StarsPerArm * FMath::Max(0, SpiralArmCount);
 	const float ArmAngleStep = 2.0f * PI / FMath::Max(1, SpiralArmCount);
 	
-	for (int32 ArmIndex = 0; ArmIndex < SpiralArmCount; ++ArmIndex)
+	// Fixed-size chunks, each with its own stream seeded from (RandomSeed, chunk): the result depends on
+	// the seed only, never on how many workers run or in which order they pick up chunks.
+	const int32 NumChunks = FMath::DivideAndRoundUp(NumStars, GalaxyStarField::StarsPerChunk);
+	ParallelFor(NumChunks, [&](int32 ChunkIndex)
 	{
-		const float ArmBaseAngle = ArmIndex * ArmAngleStep;
+		FRandomStream RandomStream(static_cast<int32>(MurmurFinalize32(HashCombineFast(GetTypeHash(RandomSeed), GetTypeHash(ChunkIndex)))));
+		const int32 First = ChunkIndex * GalaxyStarField::StarsPerChunk;
+		const int32 Last = FMath::Min(First + GalaxyStarField::StarsPerChunk, NumStars);
 		
-		for (int32 StarIndex = 0; StarIndex < StarsPerArm; ++StarIndex)
+		for (int32 i = First; i < Last; ++i)
 		{
-			// Distance from center (weighted toward outer regions for better arm visibility)
-			const float DistanceRatio = 0.2f + RandomStream.FRand() * 0.8f; // Start at 20% radius
-			const float Distance = DistanceRatio * GalaxyRadius;
-			
-			// Calculate position on spiral arm with spread
-			const float SpreadAmount = ArmSpread * Distance * RandomStream.FRandRange(-1.0f, 1.0f);
-			FVector Position = CalculateSpiralArmPosition(ArmBaseAngle, Distance, SpreadAmount);
+			FVector Position;
+			float Temperature;
 			
-			// Add vertical spread (thinner toward edges)
-			const float HeightSpread = GalaxyThickness * (1.0f - DistanceRatio * 0.5f);
-			Position.Z = RandomStream.FRandRange(-HeightSpread, HeightSpread) * 0.5f;
+			if (i < CoreStarCount)
+			{
+				// Core stars are distributed in a sphere with higher density toward center
+				const float CoreRadius = GalaxyRadius * 0.2f; // Core is 20% of galaxy radius
+				const float Distance = FMath::Pow(RandomStream.FRand(), 2.0f) * CoreRadius;
+				const float Theta = RandomStream.FRand() * 2.0f * PI;
+				const float Phi = FMath::Acos(2.0f * RandomStream.FRand() - 1.0f);
+				
+				Position.X = Distance * FMath::Sin(Phi) * FMath::Cos(Theta);
+				Position.Y = Distance * FMath::Sin(Phi) * FMath::Sin(Theta);
+				Position.Z = Distance * FMath::Cos(Phi) * (GalaxyThickness / GalaxyRadius); // Flatten to disk
+				
+				// Core stars tend to be older (redder/yellower)
+				Temperature = RandomStream.FRandRange(0.2f, 0.6f);
+			}
+			else if (i < ArmEnd)
+			{
+				const int32 ArmIndex = (i - CoreStarCount) / StarsPerArm;
+				const float ArmBaseAngle = ArmIndex * ArmAngleStep;
+				
+				// Distance from center (weighted toward outer regions for better arm visibility)
+				const float DistanceRatio = 0.2f + RandomStream.FRand() * 0.8f; // Start at 20% radius
+				const float Distance = DistanceRatio * GalaxyRadius;
+				
+				// Calculate position on spiral arm with spread
+				const float SpreadAmount = ArmSpread * Distance * RandomStream.FRandRange(-1.0f, 1.0f);
+				Position = CalculateSpiralArmPosition(ArmBaseAngle, Distance, SpreadAmount);
+				
+				// Add vertical spread (thinner toward edges)
+				const float HeightSpread = GalaxyThickness * (1.0f - DistanceRatio * 0.5f);
+				Position.Z = RandomStream.FRandRange(-HeightSpread, HeightSpread) * 0.5f;
+				
+				// Arm stars have wider temperature range (more young blue stars)
+				Temperature = RandomStream.FRandRange(0.0f, 1.0f);
+			}
+			else
+			{
+				// Remaining stars (from integer division) are scattered field stars
+				const float Distance = FMath::Sqrt(RandomStream.FRand()) * GalaxyRadius;
+				const float Angle = RandomStream.FRand() * 2.0f * PI;
+				
+				Position.X = Distance * FMath::Cos(Angle);
+				Position.Y = Distance * FMath::Sin(Angle);
+				Position.Z = RandomStream.FRandRange(-GalaxyThickness, GalaxyThickness) * 0.3f;
+				
+				Temperature = RandomStream.FRandRange(0.0f, 1.0f);
+			}
 			
 			// Random scale variation
 			const float ScaleMultiplier = RandomStream.FRandRange(MinStarScaleMultiplier, MaxStarScaleMultiplier);
 			const float FinalScale = StarScale * ScaleMultiplier;
+			OutTransforms[i] = FTransform(FQuat::Identity, Position, FVector(FinalScale));
 			
-			FTransform StarTransform;
-			StarTransform.SetLocation(Position);
-			StarTransform.SetScale3D(FVector(FinalScale));
-			InstanceTransforms.Add(StarTransform);
-			
-			// Arm stars have wider temperature range (more young blue stars)
-			const float Temperature = RandomStream.FRandRange(0.0f, 1.0f);
-			StarColors.Add(GetStarColor(Temperature));
+			const FLinearColor Color = GetStarColor(Temperature);
+			float* StarData = &OutCustomData[i * GalaxyStarField::NumCustomDataFloats];
+			StarData[0] = Color.R;
+			StarData[1] = Color.G;
+			StarData[2] = Color.B;
+			StarData[3] = 1.0f; // Intensity
 		}
-	}
-	
-	// Add remaining stars (from integer division) as scattered field stars
-	const int32 RemainingStars = StarCount - InstanceTransforms.Num();
-	for (int32 i = 0; i < RemainingStars; ++i)
-	{
-		const float Distance = FMath::Sqrt(RandomStream.FRand()) * GalaxyRadius;
-		const float Angle = RandomStream.FRand() * 2.0f * PI;
-		
-		FVector Position;
-		Position.X = Distance * FMath::Cos(Angle);
-		Position.Y = Distance * FMath::Sin(Angle);
-		Position.Z = RandomStream.FRandRange(-GalaxyThickness, GalaxyThickness) * 0.3f;
-		
-		const float ScaleMultiplier = RandomStream.FRandRange(MinStarScaleMultiplier, MaxStarScaleMultiplier);
-		const float FinalScale = StarScale * ScaleMultiplier;
-		
-		FTransform StarTransform;
-		StarTransform.SetLocation(Position);
-		StarTransform.SetScale3D(FVector(FinalScale));
-		InstanceTransforms.Add(StarTransform);
-		
-		const float Temperature = RandomStream.FRandRange(0.0f, 1.0f);
-		StarColors.Add(GetStarColor(Temperature));
-	}
-	
-	// Batch add all instances for better performance
-	StarMeshComponent->AddInstances(InstanceTransforms, false);
-	
-	// Apply per-instance custom data for color
-	for (int32 i = 0; i < StarColors.Num(); ++i)
-	{
-		const FLinearColor& Color = StarColors[i];
-		StarMeshComponent->SetCustomDataValue(i, 0, Color.R);
-		StarMeshComponent->SetCustomDataValue(i, 1, Color.G);
-		StarMeshComponent->SetCustomDataValue(i, 2, Color.B);
-		StarMeshComponent->SetCustomDataValue(i, 3, 1.0f); // Intensity
-	}
+	}, bSingleThreaded || NumChunks < 2 ? EParallelForFlags::ForceSingleThread : EParallelForFlags::None);
 }
 
 FVector AGalaxyStarField::CalculateSpiralArmPosition(float ArmAngle, float Distance, float RandomOffset) const
@@ -34,6 +34,13 @@ public:
 	UFUNCTION(BlueprintPure, Category = "Galaxy")
 	int32 GetStarCount() const;
 
+	/**
+	 * Builds every star's transform and custom data (4 floats each: R, G, B, Intensity) for the current
+	 * parameters, in parallel chunks that each draw from their own stream seeded by RandomSeed and the
+	 * chunk index. The result is the same whether or not it runs single-threaded.
+	 */
+	void BuildStarInstances(TArray<FTransform>& OutTransforms, TArray<float>& OutCustomData, bool bSingleThreaded = false) const;
+
 protected:
 	virtual void BeginPlay() override;
 	virtual void OnConstruction(const FTransform& Transform) override;
@@ -0,0 +1,159 @@
+// Copyright Federation Game. All Rights Reserved.
+
+#include "Planet/GravityField.h"
+#include "Math/VectorRegister.h"
+
+namespace GravityField
+{
+	/** Lanes per VectorRegister4Double. */
+	constexpr int32 LaneCount = 4;
+
+	/** Stand-in for "no cutoff" so the cutoff test needs no branch. */
+	constexpr double NoInfluenceLimit = 1.0e30;
+}
+
+void FGravityField::FSourceBlock::Reset()
+{
+	CenterX.Reset();
+	CenterY.Reset();
+	CenterZ.Reset();
+	Radius.Reset();
+	MinDistance.Reset();
+	InfluenceLimit.Reset();
+	Scale.Reset();
+	Exponent.Reset();
+	NumSources = 0;
+}
+
+void FGravityField::FSourceBlock::Add(const FVector& InCenter, double InRadius, double InMinDistance, double InInfluenceLimit, double InScale, double InExponent)
+{
+	if (NumSources == CenterX.Num())
+	{
+		for (int32 Lane = 0; Lane < GravityField::LaneCount; ++Lane)
+		{
+			// Padding: zero scale means zero strength, which the kernel masks out.
+			CenterX.Add(0.0);
+			CenterY.Add(0.0);
+			CenterZ.Add(0.0);
+			Radius.Add(1.0);
+			MinDistance.Add(1.0);
+			InfluenceLimit.Add(GravityField::NoInfluenceLimit);
+			Scale.Add(0.0);
+			Exponent.Add(2.0);
+		}
+	}
+
+	const int32 Index = NumSources++;
+	CenterX[Index] = InCenter.X;
+	CenterY[Index] = InCenter.Y;
+	CenterZ[Index] = InCenter.Z;
+	Radius[Index] = InRadius;
+	MinDistance[Index] = InMinDistance;
+	InfluenceLimit[Index] = InInfluenceLimit;
+	Scale[Index] = InScale;
+	Exponent[Index] = InExponent;
+}
+
+void FGravityField::Reset()
+{
+	InverseSquare.Reset();
+	General.Reset();
+}
+
+void FGravityField::AddSource(const FVector& Center, float RadiusUU, float SurfaceGravityScale, float FalloffExponent,
+	float MinDistanceMultiplier, float MaxInfluenceDistanceMultiplier)
+{
+	// Pre-fold the per-source constants exactly as ComputeStrengthFromParams derives them.
+	const double Radius = FMath::Max(RadiusUU, 1.f);
+	const double MinDistance = Radius * FMath::Max(0.1f, MinDistanceMultiplier);
+	const double InfluenceLimit = MaxInfluenceDistanceMultiplier > 0.f ? Radius * MaxInfluenceDistanceMultiplier : GravityField::NoInfluenceLimit;
+	const double Scale = FMath::Max(0.f, SurfaceGravityScale);
+	const double Exponent = FMath::Max(0.1f, FalloffExponent);
+
+	FSourceBlock& Block = (Exponent == 2.0) ? InverseSquare : General;
+	Block.Add(Center, Radius, MinDistance, InfluenceLimit, Scale, Exponent);
+}
+
+template <bool bInverseSquare>
+void FGravityField::EvaluateBlock(const FSourceBlock& Block, const FVector& Point, FVector& InOutAccel, float& InOutBest)
+{
+	if (Block.NumSources == 0) return;
+
+	const VectorRegister4Double PX = VectorSetFloat1(Point.X);
+	const VectorRegister4Double PY = VectorSetFloat1(Point.Y);
+	const VectorRegister4Double PZ = VectorSetFloat1(Point.Z);
+	const VectorRegister4Double Zero = VectorSetFloat1(0.0);
+	const VectorRegister4Double One = VectorSetFloat1(1.0);
+	const VectorRegister4Double MinStrength = VectorSetFloat1(static_cast<double>(KINDA_SMALL_NUMBER));
+
+	VectorRegister4Double AccX = Zero;
+	VectorRegister4Double AccY = Zero;
+	VectorRegister4Double AccZ = Zero;
+	VectorRegister4Double Best = Zero;
+
+	const int32 Count = Block.CenterX.Num();
+	for (int32 i = 0; i < Count; i += GravityField::LaneCount)
+	{
+		const VectorRegister4Double DX = VectorSubtract(VectorLoad(&Block.CenterX[i]), PX);
+		const VectorRegister4Double DY = VectorSubtract(VectorLoad(&Block.CenterY[i]), PY);
+		const VectorRegister4Double DZ = VectorSubtract(VectorLoad(&Block.CenterZ[i]), PZ);
+		const VectorRegister4Double Dist = VectorSqrt(VectorMultiplyAdd(DZ, DZ, VectorMultiplyAdd(DY, DY, VectorMultiply(DX, DX))));
+
+		const VectorRegister4Double Effective = VectorMax(Dist, VectorLoad(&Block.MinDistance[i]));
+		const VectorRegister4Double Ratio = VectorDivide(VectorLoad(&Block.Radius[i]), Effective);
+		VectorRegister4Double Falloff;
+		if constexpr (bInverseSquare)
+		{
+			Falloff = VectorMultiply(Ratio, Ratio);
+		}
+		else
+		{
+			Falloff = VectorPow(Ratio, VectorLoad(&Block.Exponent[i]));
+		}
+		VectorRegister4Double Strength = VectorMultiply(VectorLoad(&Block.Scale[i]), Falloff);
+
+		// Same skips as the scalar path: too close to the center, past the cutoff, or negligible.
+		const VectorRegister4Double Mask = VectorBitwiseAnd(
+			VectorBitwiseAnd(VectorCompareGE(Dist, One), VectorCompareLE(Dist, VectorLoad(&Block.InfluenceLimit[i]))),
+			VectorCompareGT(Strength, MinStrength));
+		Strength = VectorSelect(Mask, Strength, Zero);
+
+		// Direction * strength == Delta * (strength / dist); masked lanes contribute zero.
+		const VectorRegister4Double PerUnit = VectorDivide(Strength, VectorMax(Dist, One));
+		AccX = VectorMultiplyAdd(DX, PerUnit, AccX);
+		AccY = VectorMultiplyAdd(DY, PerUnit, AccY);
+		AccZ = VectorMultiplyAdd(DZ, PerUnit, AccZ);
+		Best = VectorMax(Best, Strength);
+	}
+
+	double Lanes[GravityField::LaneCount];
+	VectorStore(AccX, Lanes);
+	InOutAccel.X += Lanes[0] + Lanes[1] + Lanes[2] + Lanes[3];
+	VectorStore(AccY, Lanes);
+	InOutAccel.Y += Lanes[0] + Lanes[1] + Lanes[2] + Lanes[3];
+	VectorStore(AccZ, Lanes);
+	InOutAccel.Z += Lanes[0] + Lanes[1] + Lanes[2] + Lanes[3];
+	VectorStore(Best, Lanes);
+	InOutBest = FMath::Max(InOutBest, static_cast<float>(FMath::Max(FMath::Max(Lanes[0], Lanes[1]), FMath::Max(Lanes[2], Lanes[3]))));
+}
+
+void FGravityField::Evaluate(TConstArrayView<FVector> Points, TArrayView<FVector> OutAccel, TArrayView<float> OutBestStrength) const
+{
+	check(OutAccel.Num() >= Points.Num());
+	check(OutBestStrength.Num() == 0 || OutBestStrength.Num() >= Points.Num());
+
+	const bool bWantBest = OutBestStrength.Num() > 0;
+	for (int32 PointIndex = 0; PointIndex < Points.Num(); ++PointIndex)
+	{
+		FVector Accel = FVector::ZeroVector;
+		float BestStrength = 0.f;
+		EvaluateBlock<true>(InverseSquare, Points[PointIndex], Accel, BestStrength);
+		EvaluateBlock<false>(General, Points[PointIndex], Accel, BestStrength);
+
+		OutAccel[PointIndex] = Accel;
+		if (bWantBest)
+		{
+			OutBestStrength[PointIndex] = BestStrength;
+		}
+	}
+}
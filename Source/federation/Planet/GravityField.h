@@ -0,0 +1,63 @@
+// Copyright Federation Game. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Structure-of-arrays snapshot of gravity sources for batched evaluation.
+ * Plain data (no UObjects) so it can be rebuilt by UGravitySourceSubsystem whenever its sources change
+ * and evaluated for many query points (NPCs, projectiles, debris) in one pass.
+ *
+ * Sources with FalloffExponent == 2 go into a separate block evaluated by a kernel
+ * specialized at compile time for inverse-square falloff (no pow). Blocks are padded
+ * to the SIMD width with zero-strength entries.
+ */
+class FEDERATION_API FGravityField
+{
+public:
+	void Reset();
+
+	/** Adds one source. Parameters match UPlanetGravitySourceComponent::ComputeStrengthFromParams. */
+	void AddSource(const FVector& Center, float RadiusUU, float SurfaceGravityScale, float FalloffExponent,
+		float MinDistanceMultiplier, float MaxInfluenceDistanceMultiplier);
+
+	/** Number of real (non-padding) sources. */
+	int32 Num() const { return InverseSquare.NumSources + General.NumSources; }
+	int32 NumInverseSquare() const { return InverseSquare.NumSources; }
+
+	/**
+	 * For each point, writes the sum of (direction to source * strength) over all sources,
+	 * i.e. the same value as FGravityQueryResult::WeightedGravity. OutAccel must be at least
+	 * Points.Num() long. OutBestStrength is optional (empty view to skip).
+	 */
+	void Evaluate(TConstArrayView<FVector> Points, TArrayView<FVector> OutAccel,
+		TArrayView<float> OutBestStrength = TArrayView<float>()) const;
+
+private:
+	/** One SoA block; every array has the same (padded) length. */
+	struct FSourceBlock
+	{
+		TArray<double> CenterX;
+		TArray<double> CenterY;
+		TArray<double> CenterZ;
+		TArray<double> Radius;
+		/** Radius * max(0.1, MinDistanceMultiplier). */
+		TArray<double> MinDistance;
+		/** Radius * MaxInfluenceDistanceMultiplier, or a huge value when there is no cutoff. */
+		TArray<double> InfluenceLimit;
+		TArray<double> Scale;
+		TArray<double> Exponent;
+		int32 NumSources = 0;
+
+		void Reset();
+		/** Grows the arrays a full SIMD lane group at a time, filling spare slots with zero-strength padding. */
+		void Add(const FVector& Center, double Radius, double MinDistance, double InfluenceLimit, double Scale, double Exponent);
+	};
+
+	template <bool bInverseSquare>
+	static void EvaluateBlock(const FSourceBlock& Block, const FVector& Point, FVector& InOutAccel, float& InOutBest);
+
+	FSourceBlock InverseSquare;
+	FSourceBlock General;
+};
@@ -0,0 +1,103 @@
+// Copyright Federation Game. All Rights Reserved.
+
+#include "Planet/GravityInfluenceGrid.h"
+
+namespace GravityInfluenceGrid
+{
+	/** A sphere spanning more cells than this per axis goes to the always-visited list instead. */
+	constexpr int64 MaxCellsPerAxis = 8;
+}
+
+void FGravityInfluenceGrid::Reset()
+{
+	Pending.Reset();
+	UnboundedSources.Reset();
+	Cells.Reset();
+	CellSources.Reset();
+	CellPairs.Reset();
+	CellSize = 1.0;
+	InvCellSize = 1.0;
+}
+
+void FGravityInfluenceGrid::AddSource(int32 Index, const FVector& Center, double InfluenceRadius)
+{
+	FPendingSource& Source = Pending.AddDefaulted_GetRef();
+	Source.Center = Center;
+	Source.InfluenceRadius = InfluenceRadius;
+	Source.Index = Index;
+}
+
+void FGravityInfluenceGrid::Build()
+{
+	UnboundedSources.Reset();
+	Cells.Reset();
+	CellSources.Reset();
+	CellPairs.Reset();
+
+	TArray<double, TInlineAllocator<64>> Radii;
+	for (const FPendingSource& Source : Pending)
+	{
+		if (Source.InfluenceRadius > 0.0)
+		{
+			Radii.Add(Source.InfluenceRadius);
+		}
+		else
+		{
+			UnboundedSources.Add(Source.Index);
+		}
+	}
+	if (Radii.Num() == 0) return;
+
+	// Median diameter: typical spheres touch at most 2 cells per axis, outliers can't blow up the cell size.
+	Radii.Sort();
+	CellSize = FMath::Max(1.0, 2.0 * Radii[Radii.Num() / 2]);
+	InvCellSize = 1.0 / CellSize;
+
+	for (const FPendingSource& Source : Pending)
+	{
+		if (Source.InfluenceRadius <= 0.0) continue;
+
+		const FVector Extent(Source.InfluenceRadius);
+		const FInt64Vector Min = GetCellKey(Source.Center - Extent);
+		const FInt64Vector Max = GetCellKey(Source.Center + Extent);
+		const FInt64Vector Span = Max - Min + FInt64Vector(1);
+		if (Span.X > GravityInfluenceGrid::MaxCellsPerAxis || Span.Y > GravityInfluenceGrid::MaxCellsPerAxis
+			|| Span.Z > GravityInfluenceGrid::MaxCellsPerAxis)
+		{
+			UnboundedSources.Add(Source.Index);
+			continue;
+		}
+
+		const double RadiusSq = FMath::Square(Source.InfluenceRadius);
+		for (int64 X = Min.X; X <= Max.X; ++X)
+		{
+			for (int64 Y = Min.Y; Y <= Max.Y; ++Y)
+			{
+				for (int64 Z = Min.Z; Z <= Max.Z; ++Z)
+				{
+					// Skip bounding-box corner cells the sphere doesn't actually reach.
+					const FVector CellMin(static_cast<double>(X), static_cast<double>(Y), static_cast<double>(Z));
+					const FBox CellBox(CellMin * CellSize, (CellMin + FVector::OneVector) * CellSize);
+					if (CellBox.ComputeSquaredDistanceToPoint(Source.Center) > RadiusSq) continue;
+					CellPairs.Emplace(FInt64Vector(X, Y, Z), Source.Index);
+				}
+			}
+		}
+	}
+
+	// Group by cell so each cell owns one contiguous slice; ties keep source order for determinism.
+	CellPairs.StableSort([](const TPair<FInt64Vector, int32>& A, const TPair<FInt64Vector, int32>& B)
+	{
+		if (A.Key.X != B.Key.X) return A.Key.X < B.Key.X;
+		if (A.Key.Y != B.Key.Y) return A.Key.Y < B.Key.Y;
+		return A.Key.Z < B.Key.Z;
+	});
+
+	CellSources.Reserve(CellPairs.Num());
+	for (const TPair<FInt64Vector, int32>& Pair : CellPairs)
+	{
+		FCellRange& Range = Cells.FindOrAdd(Pair.Key, FCellRange{ CellSources.Num(), 0 });
+		++Range.Count;
+		CellSources.Add(Pair.Value);
+	}
+}
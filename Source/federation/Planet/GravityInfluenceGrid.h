@@ -0,0 +1,85 @@
+// Copyright Federation Game. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Uniform spatial hash over gravity influence spheres (Radius * MaxInfluenceDistanceMultiplier).
+ * Each bounded source is inserted into every cell its sphere's bounds overlap, so a query looks up
+ * one cell and visits only the sources that can reach it. Points in empty cells visit nothing.
+ *
+ * Sources without a cutoff, or whose sphere would span too many cells, are kept in an
+ * always-visited list. Cell size follows the median influence diameter.
+ */
+class FEDERATION_API FGravityInfluenceGrid
+{
+public:
+	void Reset();
+
+	/** Adds source Index (caller-defined, e.g. a cache slot). InfluenceRadius <= 0 means unbounded. */
+	void AddSource(int32 Index, const FVector& Center, double InfluenceRadius);
+
+	/** Buckets every added source; call after the last AddSource. */
+	void Build();
+
+	/** Calls Visit(Index) for every source whose influence volume may contain Point. Returns the number visited. */
+	template<typename FunctorType>
+	int32 ForEachCandidate(const FVector& Point, FunctorType&& Visit) const
+	{
+		for (const int32 Index : UnboundedSources)
+		{
+			Visit(Index);
+		}
+		int32 NumVisited = UnboundedSources.Num();
+
+		if (const FCellRange* Range = Cells.Find(GetCellKey(Point)))
+		{
+			for (int32 i = Range->First; i < Range->First + Range->Count; ++i)
+			{
+				Visit(CellSources[i]);
+			}
+			NumVisited += Range->Count;
+		}
+		return NumVisited;
+	}
+
+	int32 NumSources() const { return Pending.Num(); }
+	int32 NumCells() const { return Cells.Num(); }
+	int32 NumUnboundedSources() const { return UnboundedSources.Num(); }
+	double GetCellSize() const { return CellSize; }
+
+private:
+	struct FPendingSource
+	{
+		FVector Center = FVector::ZeroVector;
+		double InfluenceRadius = 0.0;
+		int32 Index = INDEX_NONE;
+	};
+
+	struct FCellRange
+	{
+		int32 First = 0;
+		int32 Count = 0;
+	};
+
+	FInt64Vector GetCellKey(const FVector& Point) const
+	{
+		return FInt64Vector(
+			static_cast<int64>(FMath::FloorToDouble(Point.X * InvCellSize)),
+			static_cast<int64>(FMath::FloorToDouble(Point.Y * InvCellSize)),
+			static_cast<int64>(FMath::FloorToDouble(Point.Z * InvCellSize)));
+	}
+
+	TArray<FPendingSource> Pending;
+	TArray<int32> UnboundedSources;
+
+	/** Per-cell slices of CellSources. */
+	TMap<FInt64Vector, FCellRange> Cells;
+	TArray<int32> CellSources;
+	/** Build scratch: (cell, source index) pairs, kept to avoid reallocating every refresh. */
+	TArray<TPair<FInt64Vector, int32>> CellPairs;
+
+	double CellSize = 1.0;
+	double InvCellSize = 1.0;
+};
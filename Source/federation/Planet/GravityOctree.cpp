@@ -0,0 +1,194 @@
+// Copyright Federation Game. All Rights Reserved.
+
+#include "Planet/GravityOctree.h"
+
+namespace GravityOctree
+{
+	constexpr int32 LeafCapacity = 4;
+	constexpr int32 MaxDepth = 16;
+
+	/** Half-diagonal of a cube per unit half-size. */
+	constexpr double CubeReach = 1.7320508075688772;
+}
+
+void FGravityOctree::Reset()
+{
+	Sources.Reset();
+	SourceOrder.Reset();
+	Nodes.Reset();
+}
+
+void FGravityOctree::AddSource(const FVector& Center, float RadiusUU, float SurfaceGravityScale, float MinDistanceMultiplier)
+{
+	// Same per-source constants as UPlanetGravitySourceComponent::ComputeStrengthFromParams.
+	FSource& Source = Sources.AddDefaulted_GetRef();
+	Source.Center = Center;
+	Source.Radius = FMath::Max(RadiusUU, 1.f);
+	Source.MinDistance = Source.Radius * FMath::Max(0.1f, MinDistanceMultiplier);
+	Source.Scale = FMath::Max(0.f, SurfaceGravityScale);
+	Source.Mass = Source.Scale * Source.Radius * Source.Radius;
+}
+
+void FGravityOctree::Build()
+{
+	Nodes.Reset();
+	SourceOrder.SetNumUninitialized(Sources.Num());
+	for (int32 i = 0; i < Sources.Num(); ++i)
+	{
+		SourceOrder[i] = i;
+	}
+	if (Sources.Num() == 0) return;
+
+	FBox Bounds(ForceInit);
+	for (const FSource& Source : Sources)
+	{
+		Bounds += Source.Center;
+	}
+	const FVector Extent = Bounds.GetExtent();
+	const double HalfSize = FMath::Max3(Extent.X, Extent.Y, Extent.Z) + 1.0;
+
+	Nodes.AddDefaulted();
+	BuildNode(0, Bounds.GetCenter(), HalfSize, 0, Sources.Num(), 0);
+}
+
+void FGravityOctree::BuildNode(int32 NodeIndex, const FVector& BoxCenter, double HalfSize, int32 FirstSource, int32 SourceCount, int32 Depth)
+{
+	{
+		FNode& Node = Nodes[NodeIndex];
+		Node.BoxCenter = BoxCenter;
+		Node.HalfSize = HalfSize;
+		Node.FirstSource = FirstSource;
+		Node.SourceCount = SourceCount;
+
+		FVector WeightedCenter = FVector::ZeroVector;
+		FVector PlainCenter = FVector::ZeroVector;
+		for (int32 i = FirstSource; i < FirstSource + SourceCount; ++i)
+		{
+			const FSource& Source = Sources[SourceOrder[i]];
+			Node.Mass += Source.Mass;
+			Node.MaxSourceMass = FMath::Max(Node.MaxSourceMass, Source.Mass);
+			Node.MinSourceMass = (i == FirstSource) ? Source.Mass : FMath::Min(Node.MinSourceMass, Source.Mass);
+			Node.MaxMinDistance = FMath::Max(Node.MaxMinDistance, Source.MinDistance);
+			WeightedCenter += Source.Center * Source.Mass;
+			PlainCenter += Source.Center;
+		}
+		Node.CenterOfMass = Node.Mass > 0.0 ? WeightedCenter / Node.Mass
+			: (SourceCount > 0 ? PlainCenter / SourceCount : BoxCenter);
+	}
+
+	if (SourceCount <= GravityOctree::LeafCapacity || Depth >= GravityOctree::MaxDepth)
+	{
+		return;
+	}
+
+	// Counting sort of this node's range into the 8 octants.
+	auto OctantOf = [&BoxCenter](const FVector& P)
+	{
+		return (P.X >= BoxCenter.X ? 1 : 0) | (P.Y >= BoxCenter.Y ? 2 : 0) | (P.Z >= BoxCenter.Z ? 4 : 0);
+	};
+
+	int32 Counts[8] = {};
+	for (int32 i = FirstSource; i < FirstSource + SourceCount; ++i)
+	{
+		++Counts[OctantOf(Sources[SourceOrder[i]].Center)];
+	}
+	int32 Starts[8];
+	int32 Running = FirstSource;
+	for (int32 Octant = 0; Octant < 8; ++Octant)
+	{
+		Starts[Octant] = Running;
+		Running += Counts[Octant];
+	}
+	TArray<int32, TInlineAllocator<64>> Sorted;
+	Sorted.SetNumUninitialized(SourceCount);
+	int32 Cursor[8];
+	FMemory::Memcpy(Cursor, Starts, sizeof(Cursor));
+	for (int32 i = FirstSource; i < FirstSource + SourceCount; ++i)
+	{
+		const int32 SourceIndex = SourceOrder[i];
+		Sorted[Cursor[OctantOf(Sources[SourceIndex].Center)]++ - FirstSource] = SourceIndex;
+	}
+	FMemory::Memcpy(&SourceOrder[FirstSource], Sorted.GetData(), SourceCount * sizeof(int32));
+
+	const int32 FirstChild = Nodes.Num();
+	Nodes.AddDefaulted(8);
+	Nodes[NodeIndex].FirstChild = FirstChild;
+
+	const double ChildHalf = HalfSize * 0.5;
+	for (int32 Octant = 0; Octant < 8; ++Octant)
+	{
+		const FVector ChildCenter = BoxCenter + FVector(
+			(Octant & 1) ? ChildHalf : -ChildHalf,
+			(Octant & 2) ? ChildHalf : -ChildHalf,
+			(Octant & 4) ? ChildHalf : -ChildHalf);
+		BuildNode(FirstChild + Octant, ChildCenter, ChildHalf, Starts[Octant], Counts[Octant], Depth + 1);
+	}
+}
+
+int32 FGravityOctree::Evaluate(const FVector& Point, float OpeningAngle, FVector& OutAccel, float& OutBestStrength) const
+{
+	int32 Visited = 0;
+	if (Nodes.Num() == 0) return Visited;
+
+	double Best = OutBestStrength;
+	TArray<int32, TInlineAllocator<128>> Stack;
+	Stack.Add(0);
+	while (Stack.Num() > 0)
+	{
+		const FNode& Node = Nodes[Stack.Pop(EAllowShrinking::No)];
+		if (Node.SourceCount == 0) continue;
+		++Visited;
+
+		if (Node.FirstChild == INDEX_NONE)
+		{
+			for (int32 i = Node.FirstSource; i < Node.FirstSource + Node.SourceCount; ++i)
+			{
+				const FSource& Source = Sources[SourceOrder[i]];
+				const FVector ToSource = Source.Center - Point;
+				const double Dist = ToSource.Size();
+				if (Dist < 1.0) continue;
+				const double Ratio = Source.Radius / FMath::Max(Dist, Source.MinDistance);
+				const double Strength = Source.Scale * Ratio * Ratio;
+				if (Strength <= KINDA_SMALL_NUMBER) continue;
+				Best = FMath::Max(Best, Strength);
+				OutAccel += ToSource * (Strength / Dist);
+			}
+			continue;
+		}
+
+		const double BoxDist = (Node.BoxCenter - Point).Size();
+		const double Reach = Node.HalfSize * GravityOctree::CubeReach;
+		const double NearestPossible = BoxDist - Reach;
+		const double FarthestPossible = BoxDist + Reach;
+		const bool bOutsideClamp = NearestPossible > FMath::Max(Node.MaxMinDistance, 1.0);
+
+		// Every member is below the strength floor: the scalar path would drop them all.
+		if (bOutsideClamp && Node.MaxSourceMass <= KINDA_SMALL_NUMBER * NearestPossible * NearestPossible)
+		{
+			continue;
+		}
+
+		// Opening criterion, plus: no member inside its clamp region and every member above the floor.
+		const FVector ToMass = Node.CenterOfMass - Point;
+		const double Dist = ToMass.Size();
+		if (OpeningAngle > 0.f
+			&& bOutsideClamp
+			&& 2.0 * Node.HalfSize < OpeningAngle * Dist
+			&& Node.MinSourceMass > KINDA_SMALL_NUMBER * FarthestPossible * FarthestPossible)
+		{
+			const double InvDistSq = 1.0 / (Dist * Dist);
+			const double Strength = Node.Mass * InvDistSq;
+			OutAccel += ToMass * (Strength / Dist);
+			Best = FMath::Max(Best, Node.MaxSourceMass * InvDistSq);
+			continue;
+		}
+
+		for (int32 Octant = 0; Octant < 8; ++Octant)
+		{
+			Stack.Add(Node.FirstChild + Octant);
+		}
+	}
+
+	OutBestStrength = static_cast<float>(Best);
+	return Visited;
+}
@@ -0,0 +1,74 @@
+// Copyright Federation Game. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Barnes–Hut octree over inverse-square gravity sources (FalloffExponent == 2, no cutoff).
+ * A far node is replaced by one point mass at its center of mass when
+ * NodeSize / Distance < OpeningAngle, making per-query cost ~O(log N) for large body counts.
+ *
+ * "Mass" is SurfaceGravityScale * Radius^2, so Mass / Distance^2 equals the exact per-source
+ * strength outside the MinDistance clamp. Nodes whose clamp region could reach the query point
+ * are always opened, so near-surface results stay exact. OpeningAngle 0 degenerates to the exact sum.
+ *
+ * The scalar path drops individual contributions <= KINDA_SMALL_NUMBER. To stay consistent with it,
+ * a node is skipped outright when no member can reach that floor, and only approximated when every
+ * member is above it; mixed nodes are opened.
+ */
+class FEDERATION_API FGravityOctree
+{
+public:
+	void Reset();
+
+	/** Adds one source; call Build() after the last one. */
+	void AddSource(const FVector& Center, float RadiusUU, float SurfaceGravityScale, float MinDistanceMultiplier);
+
+	/** Builds the tree over every added source. */
+	void Build();
+
+	int32 NumSources() const { return Sources.Num(); }
+	int32 NumNodes() const { return Nodes.Num(); }
+
+	/**
+	 * Same outputs as FGravityField::Evaluate for a single point: the summed (direction * strength)
+	 * and an estimate of the strongest single contribution. Returns the number of nodes/sources visited.
+	 */
+	int32 Evaluate(const FVector& Point, float OpeningAngle, FVector& OutAccel, float& OutBestStrength) const;
+
+private:
+	struct FSource
+	{
+		FVector Center = FVector::ZeroVector;
+		double Radius = 1.0;
+		double MinDistance = 1.0;
+		double Scale = 0.0;
+		double Mass = 0.0;
+	};
+
+	struct FNode
+	{
+		FVector BoxCenter = FVector::ZeroVector;
+		double HalfSize = 0.0;
+		FVector CenterOfMass = FVector::ZeroVector;
+		double Mass = 0.0;
+		/** Largest/smallest single-source mass: BestStrength estimate and the per-source strength floor. */
+		double MaxSourceMass = 0.0;
+		double MinSourceMass = 0.0;
+		/** Largest MinDistance of any source below this node. */
+		double MaxMinDistance = 0.0;
+		/** Index of the first of 8 consecutive children, or INDEX_NONE for a leaf. */
+		int32 FirstChild = INDEX_NONE;
+		/** Leaf range into SourceOrder. */
+		int32 FirstSource = 0;
+		int32 SourceCount = 0;
+	};
+
+	void BuildNode(int32 NodeIndex, const FVector& BoxCenter, double HalfSize, int32 FirstSource, int32 SourceCount, int32 Depth);
+
+	TArray<FSource> Sources;
+	/** Source indices permuted so each leaf owns a contiguous range. */
+	TArray<int32> SourceOrder;
+	TArray<FNode> Nodes;
+};
@@ -0,0 +1,692 @@
+// Copyright Federation Game. All Rights Reserved.
+
+#include "Planet/GravitySourceSubsystem.h"
+#include "Planet/PlanetGravitySourceComponent.h"
+#include "Planet/PlanetGravityComponent.h"
+#include "Planet/OrbitalMechanicsSubsystem.h"
+#include "GameFramework/Actor.h"
+#include "GameFramework/Character.h"
+#include "GameFramework/CharacterMovementComponent.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "Engine/StaticMeshActor.h"
+#include "EngineUtils.h"
+#include "HAL/IConsoleManager.h"
+#include "Async/ParallelFor.h"
+
+namespace GravitySourceSubsystem
+{
+	/** Below this many consumers the ParallelFor dispatch costs more than it saves. */
+	constexpr int32 MinConsumersForParallelBatch = 8;
+}
+
+static FAutoConsoleCommand CmdGravityBarnesHut(
+	TEXT("Fed.Gravity.BarnesHut"),
+	TEXT("Toggle Barnes-Hut gravity approximation. Usage: Fed.Gravity.BarnesHut <0|1> [OpeningAngle]"),
+	FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString>& Args)
+	{
+		if (Args.Num() < 1 || !GEngine)
+		{
+			UE_LOG(LogTemp, Warning, TEXT("Usage: Fed.Gravity.BarnesHut <0|1> [OpeningAngle]"));
+			return;
+		}
+		const bool bEnable = FCString::Atoi(*Args[0]) != 0;
+		for (const FWorldContext& Context : GEngine->GetWorldContexts())
+		{
+			UWorld* World = Context.World();
+			UGravitySourceSubsystem* Sub = World ? World->GetSubsystem<UGravitySourceSubsystem>() : nullptr;
+			if (!Sub) continue;
+			if (Args.Num() > 1)
+			{
+				Sub->SetBarnesHutOpeningAngle(FCString::Atof(*Args[1]));
+			}
+			Sub->SetBarnesHutEnabled(bEnable);
+		}
+	})
+);
+
+void FGravityBatchTickFunction::ExecuteTick(float DeltaTime, ELevelTick TickType, ENamedThreads::Type CurrentThread, const FGraphEventRef& MyCompletionGraphEvent)
+{
+	if (Subsystem && TickType != LEVELTICK_ViewportsOnly)
+	{
+		Subsystem->RunGravityBatch();
+		Subsystem->RunGroundProbes(DeltaTime);
+	}
+}
+
+void UGravitySourceSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	// Legacy planet discovery is event-driven so the per-tick fallback never scans the world.
+	if (UWorld* World = GetWorld())
+	{
+		ActorSpawnedHandle = World->AddOnActorSpawnedHandler(
+			FOnActorSpawned::FDelegate::CreateUObject(this, &UGravitySourceSubsystem::HandleActorSpawned));
+		ActorDestroyedHandle = World->AddOnActorDestroyedHandler(
+			FOnActorDestroyed::FDelegate::CreateUObject(this, &UGravitySourceSubsystem::HandleActorDestroyed));
+	}
+	LevelAddedHandle = FWorldDelegates::LevelAddedToWorld.AddUObject(this, &UGravitySourceSubsystem::HandleLevelChanged);
+	LevelRemovedHandle = FWorldDelegates::LevelRemovedFromWorld.AddUObject(this, &UGravitySourceSubsystem::HandleLevelChanged);
+	bLegacyPlanetsDirty = true;
+
+	// Configured now, registered at begin play: level-placed consumers register from OnRegister before
+	// OnWorldBeginPlay, and AddPrerequisite silently drops a target that can't ever tick.
+	BatchTickFunction.Subsystem = this;
+	BatchTickFunction.bCanEverTick = true;
+	BatchTickFunction.bStartWithTickEnabled = true;
+	BatchTickFunction.TickGroup = TG_PrePhysics;
+}
+
+void UGravitySourceSubsystem::OnWorldBeginPlay(UWorld& InWorld)
+{
+	Super::OnWorldBeginPlay(InWorld);
+
+	BatchTickFunction.RegisterTickFunction(InWorld.PersistentLevel);
+
+	// Re-assert the ordering for everyone registered so far (prerequisites are unique, so this is idempotent).
+	for (const TWeakObjectPtr<UPlanetGravityComponent>& Weak : GravityConsumers)
+	{
+		if (UPlanetGravityComponent* Consumer = Weak.Get())
+		{
+			AddBatchPrerequisites(Consumer);
+		}
+	}
+}
+
+void UGravitySourceSubsystem::Deinitialize()
+{
+	if (BatchTickFunction.IsTickFunctionRegistered())
+	{
+		BatchTickFunction.UnRegisterTickFunction();
+	}
+	BatchTickFunction.Subsystem = nullptr;
+
+	if (UWorld* World = GetWorld())
+	{
+		World->RemoveOnActorSpawnedHandler(ActorSpawnedHandle);
+		World->RemoveOnActorDestroyedHandler(ActorDestroyedHandle);
+	}
+	FWorldDelegates::LevelAddedToWorld.Remove(LevelAddedHandle);
+	FWorldDelegates::LevelRemovedFromWorld.Remove(LevelRemovedHandle);
+	LegacyPlanets.Reset();
+	QueuedGroundProbes.Reset();
+	InFlightGroundProbes.Reset();
+
+	Super::Deinitialize();
+}
+
+void UGravitySourceSubsystem::RegisterSource(UPlanetGravitySourceComponent* Source)
+{
+	if (!Source) return;
+
+	for (const TWeakObjectPtr<UPlanetGravitySourceComponent>& Existing : RegisteredSources)
+	{
+		if (Existing.Get() == Source) return;
+	}
+	RegisteredSources.Add(Source);
+	bCacheDirty = true;
+}
+
+void UGravitySourceSubsystem::UnregisterSource(UPlanetGravitySourceComponent* Source)
+{
+	RegisteredSources.RemoveAll([Source](const TWeakObjectPtr<UPlanetGravitySourceComponent>& Entry)
+	{
+		return !Entry.IsValid() || Entry.Get() == Source;
+	});
+	bCacheDirty = true;
+}
+
+int32 UGravitySourceSubsystem::GetNumRegisteredSources() const
+{
+	int32 Count = 0;
+	for (const TWeakObjectPtr<UPlanetGravitySourceComponent>& Weak : RegisteredSources)
+	{
+		if (Weak.IsValid()) ++Count;
+	}
+	return Count;
+}
+
+void UGravitySourceSubsystem::RefreshSourceCache(bool bForce)
+{
+	// Rebuilding the grid and octree every frame would cost more than the culling saves; sources
+	// flag the cache when they register, unregister or move (and orbits when they step). Parameters
+	// can be written directly (C++ or Blueprint), so those are compared instead.
+	if (!bForce && !bCacheDirty && !HaveSourceParamsChanged())
+	{
+		return;
+	}
+	QUICK_SCOPE_CYCLE_COUNTER(STAT_GravitySourceSubsystem_RebuildSourceCache);
+
+	// Orbiting sources read their propagated position rather than the (possibly lagging) actor transform.
+	const UWorld* World = GetWorld();
+	const UOrbitalMechanicsSubsystem* Orbits = World ? World->GetSubsystem<UOrbitalMechanicsSubsystem>() : nullptr;
+
+	CachedSources.Reset(RegisteredSources.Num());
+	Field.Reset();
+	InfluenceGrid.Reset();
+	Octree.Reset();
+	ResidualField.Reset();
+	SourceOwners.Reset();
+	NumEnabledSources = 0;
+	for (const TWeakObjectPtr<UPlanetGravitySourceComponent>& Weak : RegisteredSources)
+	{
+		UPlanetGravitySourceComponent* Source = Weak.Get();
+		AActor* Owner = Source ? Source->GetOwner() : nullptr;
+		if (!Owner) continue;
+
+		FGravitySourceEntry& Entry = CachedSources.AddDefaulted_GetRef();
+		Entry.Source = Source;
+		Entry.Owner = Owner;
+		Entry.OwnerKey = Owner;
+		if (!Orbits || !Orbits->GetBodyPosition(Owner, Entry.Center))
+		{
+			Entry.Center = Owner->GetActorLocation();
+		}
+		Entry.RadiusUU = Source->GetSourceRadiusUU();
+		Entry.SurfaceGravityScale = Source->SurfaceGravityScale;
+		Entry.FalloffExponent = Source->FalloffExponent;
+		Entry.MinDistanceMultiplier = Source->MinDistanceMultiplier;
+		Entry.MaxInfluenceDistanceMultiplier = Source->MaxInfluenceDistanceMultiplier;
+		Entry.bAffectsGravity = Source->bAffectsGravity;
+
+		if (Entry.bAffectsGravity)
+		{
+			++NumEnabledSources;
+			++SourceOwners.FindOrAdd(Owner);
+			Field.AddSource(Entry.Center, Entry.RadiusUU, Entry.SurfaceGravityScale, Entry.FalloffExponent,
+				Entry.MinDistanceMultiplier, Entry.MaxInfluenceDistanceMultiplier);
+
+			// Same influence limit as ComputeStrengthFromParams; <= 0 is unbounded.
+			const double InfluenceRadius = Entry.MaxInfluenceDistanceMultiplier > 0.f
+				? FMath::Max(Entry.RadiusUU, 1.f) * Entry.MaxInfluenceDistanceMultiplier
+				: 0.0;
+			InfluenceGrid.AddSource(CachedSources.Num() - 1, Entry.Center, InfluenceRadius);
+
+			if (bUseBarnesHut)
+			{
+				if (Entry.FalloffExponent == 2.f && Entry.MaxInfluenceDistanceMultiplier <= 0.f)
+				{
+					Octree.AddSource(Entry.Center, Entry.RadiusUU, Entry.SurfaceGravityScale, Entry.MinDistanceMultiplier);
+				}
+				else
+				{
+					ResidualField.AddSource(Entry.Center, Entry.RadiusUU, Entry.SurfaceGravityScale, Entry.FalloffExponent,
+						Entry.MinDistanceMultiplier, Entry.MaxInfluenceDistanceMultiplier);
+				}
+			}
+		}
+	}
+
+	InfluenceGrid.Build();
+	if (bUseBarnesHut)
+	{
+		Octree.Build();
+	}
+
+	++NumCacheRebuilds;
+	bCacheDirty = false;
+}
+
+void UGravitySourceSubsystem::ApplyOriginOffset(const FVector& Offset)
+{
+	for (TPair<TObjectKey<UPlanetGravityComponent>, FGroundProbe>& Pair : QueuedGroundProbes)
+	{
+		FGroundProbe& Probe = Pair.Value;
+		Probe.Start += Offset;
+		Probe.End += Offset;
+	}
+	// Consumers still falling queue a fresh probe next frame.
+	InFlightGroundProbes.Reset();
+	RefreshSourceCache(true);
+}
+
+bool UGravitySourceSubsystem::HaveSourceParamsChanged() const
+{
+	for (const FGravitySourceEntry& Entry : CachedSources)
+	{
+		// A source that went away unregistered, which already flagged the cache.
+		const UPlanetGravitySourceComponent* Source = Entry.Source.Get();
+		if (!Source) continue;
+
+		if (Source->bAffectsGravity != Entry.bAffectsGravity
+			|| Source->SurfaceGravityScale != Entry.SurfaceGravityScale
+			|| Source->FalloffExponent != Entry.FalloffExponent
+			|| Source->MinDistanceMultiplier != Entry.MinDistanceMultiplier
+			|| Source->MaxInfluenceDistanceMultiplier != Entry.MaxInfluenceDistanceMultiplier
+			|| Source->GetSourceRadiusUU() != Entry.RadiusUU)
+		{
+			return true;
+		}
+	}
+	return false;
+}
+
+FGravityQueryResult UGravitySourceSubsystem::QueryGravityAt(const FVector& Location, const AActor* IgnoreActor)
+{
+	RefreshSourceCache();
+
+	return QueryGravityAtCached(Location, IgnoreActor);
+}
+
+FGravityQueryResult UGravitySourceSubsystem::QueryGravityAtCached(const FVector& Location, const AActor* IgnoreActor) const
+{
+	// The approximation can't exclude one source from a cluster, so a querying source owner gets the exact sum.
+	if (bUseBarnesHut && !(IgnoreActor && SourceOwners.Contains(IgnoreActor)))
+	{
+		return QueryGravityApproximate(Location);
+	}
+
+	FGravityQueryResult Result;
+	Result.NumSources = NumEnabledSources - (IgnoreActor ? SourceOwners.FindRef(IgnoreActor) : 0);
+	float NearestDistSq = FLT_MAX;
+
+	auto AccumulateSource = [&Result, &NearestDistSq, &Location, IgnoreActor](const FGravitySourceEntry& Entry)
+	{
+		if (!Entry.bAffectsGravity) return;
+		if (IgnoreActor && Entry.OwnerKey == IgnoreActor) return;
+		++Result.NumVisitedSources;
+
+		const FVector ToSource = Entry.Center - Location;
+		const float DistSq = ToSource.SizeSquared();
+		if (DistSq >= 1.f && DistSq < NearestDistSq)
+		{
+			NearestDistSq = DistSq;
+			Result.NearestSourceCenter = Entry.Center;
+			Result.bHasNearestSource = true;
+		}
+
+		const float Dist = ToSource.Size();
+		if (Dist < 1.f) return;
+
+		const float Strength = UPlanetGravitySourceComponent::ComputeStrengthFromParams(
+			Entry.RadiusUU, Entry.SurfaceGravityScale, Entry.FalloffExponent,
+			Entry.MinDistanceMultiplier, Entry.MaxInfluenceDistanceMultiplier, Dist);
+		if (Strength <= KINDA_SMALL_NUMBER) return;
+
+		Result.BestStrength = FMath::Max(Result.BestStrength, Strength);
+		Result.WeightedGravity += ToSource.GetSafeNormal() * Strength;
+	};
+
+	if (bUseInfluenceCulling)
+	{
+		// Deep space (no volume contains the point) visits nothing and returns zero gravity.
+		InfluenceGrid.ForEachCandidate(Location, [this, &AccumulateSource](int32 EntryIndex)
+		{
+			AccumulateSource(CachedSources[EntryIndex]);
+		});
+	}
+	else
+	{
+		for (const FGravitySourceEntry& Entry : CachedSources)
+		{
+			AccumulateSource(Entry);
+		}
+	}
+
+	return Result;
+}
+
+FGravityQueryResult UGravitySourceSubsystem::QueryGravityApproximate(const FVector& Location) const
+{
+	FGravityQueryResult Result;
+	Result.NumSources = NumEnabledSources;
+
+	Octree.Evaluate(Location, BarnesHutOpeningAngle, Result.WeightedGravity, Result.BestStrength);
+	if (ResidualField.Num() > 0)
+	{
+		FVector ResidualAccel = FVector::ZeroVector;
+		float ResidualBest = 0.f;
+		ResidualField.Evaluate(MakeArrayView(&Location, 1), MakeArrayView(&ResidualAccel, 1), MakeArrayView(&ResidualBest, 1));
+		Result.WeightedGravity += ResidualAccel;
+		Result.BestStrength = FMath::Max(Result.BestStrength, ResidualBest);
+	}
+
+	// Nearest source only matters when the field cancels out; only pay for the linear scan then.
+	if (Result.WeightedGravity.IsNearlyZero())
+	{
+		float NearestDistSq = FLT_MAX;
+		for (const FGravitySourceEntry& Entry : CachedSources)
+		{
+			if (!Entry.bAffectsGravity) continue;
+			const float DistSq = (Entry.Center - Location).SizeSquared();
+			if (DistSq >= 1.f && DistSq < NearestDistSq)
+			{
+				NearestDistSq = DistSq;
+				Result.NearestSourceCenter = Entry.Center;
+				Result.bHasNearestSource = true;
+			}
+		}
+	}
+	return Result;
+}
+
+void UGravitySourceSubsystem::RegisterGravityConsumer(UPlanetGravityComponent* Consumer)
+{
+	if (!Consumer) return;
+
+	for (const TWeakObjectPtr<UPlanetGravityComponent>& Existing : GravityConsumers)
+	{
+		if (Existing.Get() == Consumer) return;
+	}
+	GravityConsumers.Add(Consumer);
+	AddBatchPrerequisites(Consumer);
+}
+
+void UGravitySourceSubsystem::AddBatchPrerequisites(UPlanetGravityComponent* Consumer)
+{
+	// Results must land before the consumer's own tick (alignment/camera) and before its CMC moves.
+	Consumer->PrimaryComponentTick.AddPrerequisite(this, BatchTickFunction);
+	if (ACharacter* Char = Cast<ACharacter>(Consumer->GetOwner()))
+	{
+		if (UCharacterMovementComponent* CMC = Char->GetCharacterMovement())
+		{
+			CMC->PrimaryComponentTick.AddPrerequisite(this, BatchTickFunction);
+		}
+	}
+}
+
+void UGravitySourceSubsystem::UnregisterGravityConsumer(UPlanetGravityComponent* Consumer)
+{
+	GravityConsumers.RemoveAll([Consumer](const TWeakObjectPtr<UPlanetGravityComponent>& Entry)
+	{
+		return !Entry.IsValid() || Entry.Get() == Consumer;
+	});
+
+	if (!Consumer) return;
+	Consumer->PrimaryComponentTick.RemovePrerequisite(this, BatchTickFunction);
+	if (ACharacter* Char = Cast<ACharacter>(Consumer->GetOwner()))
+	{
+		if (UCharacterMovementComponent* CMC = Char->GetCharacterMovement())
+		{
+			CMC->PrimaryComponentTick.RemovePrerequisite(this, BatchTickFunction);
+		}
+	}
+}
+
+void UGravitySourceSubsystem::RunGravityBatch()
+{
+	QUICK_SCOPE_CYCLE_COUNTER(STAT_GravitySourceSubsystem_RunGravityBatch);
+	RefreshSourceCache();
+
+	// Legacy levels without registered sources: consumers fall back to their own serial path.
+	if (NumEnabledSources == 0 || GravityConsumers.Num() == 0) return;
+
+	// Game thread: snapshot every consumer into plain data.
+	BatchJobs.Reset(GravityConsumers.Num());
+	for (const TWeakObjectPtr<UPlanetGravityComponent>& Weak : GravityConsumers)
+	{
+		UPlanetGravityComponent* Consumer = Weak.Get();
+		AActor* Owner = Consumer ? Consumer->GetOwner() : nullptr;
+		if (!Owner) continue;
+		// Surface handoff turns planet gravity off by disabling the component's tick; respect that here.
+		if (!Consumer->IsComponentTickEnabled()) continue;
+
+		FGravityBatchJob& Job = BatchJobs.AddDefaulted_GetRef();
+		Job.Consumer = Consumer;
+		Job.IgnoreActor = Owner;
+		Job.Params = Consumer->MakeSolveParams(Owner->GetActorLocation());
+	}
+
+	// Workers: source summation + solve, no UObject access.
+	ParallelFor(BatchJobs.Num(), [this](int32 Index)
+	{
+		FGravityBatchJob& Job = BatchJobs[Index];
+		Job.Query = QueryGravityAtCached(Job.Params.Location, Job.IgnoreActor);
+		Job.Solution = UPlanetGravityComponent::SolveGravity(Job.Query, Job.Params);
+	}, BatchJobs.Num() < GravitySourceSubsystem::MinConsumersForParallelBatch ? EParallelForFlags::ForceSingleThread : EParallelForFlags::None);
+
+	// Game thread: write back.
+	for (const FGravityBatchJob& Job : BatchJobs)
+	{
+		if (Job.Query.NumSources == 0) continue;
+		Job.Consumer->ApplyGravitySolution(Job.Solution);
+		Job.Consumer->MarkGravityBatched(GFrameCounter);
+	}
+}
+
+void UGravitySourceSubsystem::QueueGroundProbe(UPlanetGravityComponent* Consumer, const FVector& Start, const FVector& End)
+{
+	if (!Consumer) return;
+
+	// Keyed by consumer: a repeat call this frame replaces the probe without scanning the queue.
+	FGroundProbe& Probe = QueuedGroundProbes.FindOrAdd(Consumer);
+	Probe.Consumer = Consumer;
+	Probe.Start = Start;
+	Probe.End = End;
+}
+
+bool UGravitySourceSubsystem::GetQueuedGroundProbe(const UPlanetGravityComponent* Consumer, FVector& OutStart, FVector& OutEnd) const
+{
+	const FGroundProbe* Probe = QueuedGroundProbes.Find(Consumer);
+	if (!Probe) return false;
+	OutStart = Probe->Start;
+	OutEnd = Probe->End;
+	return true;
+}
+
+void UGravitySourceSubsystem::RunGroundProbes(float DeltaTime)
+{
+	UWorld* World = GetWorld();
+	if (!World) return;
+
+	// Last frame's traces completed at end of frame; hand hits back before anyone moves this frame.
+	for (const FGroundProbe& Probe : InFlightGroundProbes)
+	{
+		UPlanetGravityComponent* Consumer = Probe.Consumer.Get();
+		FTraceDatum Datum;
+		if (!Consumer || !World->QueryTraceData(Probe.Handle, Datum)) continue;
+
+		if (const FHitResult* Hit = Datum.OutHits.FindByPredicate([](const FHitResult& H) { return H.bBlockingHit; }))
+		{
+			Consumer->ApplyGroundProbeHit(*Hit);
+		}
+	}
+	InFlightGroundProbes.Reset();
+
+	for (const TWeakObjectPtr<UPlanetGravityComponent>& Weak : GravityConsumers)
+	{
+		UPlanetGravityComponent* Consumer = Weak.Get();
+		if (Consumer && Consumer->IsComponentTickEnabled())
+		{
+			Consumer->RecoverGroundContact(DeltaTime);
+		}
+	}
+
+	// One submission pass for every falling consumer instead of a blocking trace per component tick.
+	InFlightGroundProbes.Reserve(QueuedGroundProbes.Num());
+	for (TPair<TObjectKey<UPlanetGravityComponent>, FGroundProbe>& Pair : QueuedGroundProbes)
+	{
+		FGroundProbe& Probe = Pair.Value;
+		UPlanetGravityComponent* Consumer = Probe.Consumer.Get();
+		if (!Consumer) continue;
+
+		const FCollisionQueryParams Params(SCENE_QUERY_STAT(GroundRecover), false, Consumer->GetOwner());
+		Probe.Handle = World->AsyncLineTraceByChannel(EAsyncTraceType::Single, Probe.Start, Probe.End, ECC_Visibility, Params);
+		InFlightGroundProbes.Add(Probe);
+	}
+	QueuedGroundProbes.Reset();
+}
+
+void UGravitySourceSubsystem::SetBarnesHutEnabled(bool bEnabled)
+{
+	if (bUseBarnesHut != bEnabled)
+	{
+		bUseBarnesHut = bEnabled;
+		bCacheDirty = true;
+	}
+}
+
+float UGravitySourceSubsystem::GetLegacyActorRadius(const AActor* Actor)
+{
+	if (!Actor) return 1.f;
+
+	const FQuat Rotation = Actor->GetActorQuat();
+	const FVector Scale = Actor->GetActorScale3D();
+	if (const FLegacyRadiusEntry* Entry = LegacyRadiusCache.Find(Actor))
+	{
+		if (Entry->Rotation.Equals(Rotation, KINDA_SMALL_NUMBER) && Entry->Scale.Equals(Scale, KINDA_SMALL_NUMBER))
+		{
+			return Entry->RadiusUU;
+		}
+	}
+
+	const FBox Box = Actor->GetComponentsBoundingBox();
+	const FVector Extent = Box.GetExtent();
+	FLegacyRadiusEntry& Entry = LegacyRadiusCache.Add(Actor);
+	Entry.Rotation = Rotation;
+	Entry.Scale = Scale;
+	Entry.RadiusUU = FMath::Max(1.f, FMath::Max(Extent.X, FMath::Max(Extent.Y, Extent.Z)));
+	return Entry.RadiusUU;
+}
+
+FGravityQueryResult UGravitySourceSubsystem::QueryLegacyGravityAt(const FVector& Location, const AActor* IgnoreActor)
+{
+	FGravityQueryResult Result;
+	float NearestDistSq = FLT_MAX;
+
+	for (const TWeakObjectPtr<AActor>& Weak : GetLegacyPlanets())
+	{
+		AActor* Planet = Weak.Get();
+		if (!Planet || Planet == IgnoreActor) continue;
+		++Result.NumSources;
+		++Result.NumVisitedSources;
+
+		const FVector Center = Planet->GetActorLocation();
+		const FVector ToPlanet = Center - Location;
+		const float DistSq = ToPlanet.SizeSquared();
+		if (DistSq >= 1.f && DistSq < NearestDistSq)
+		{
+			NearestDistSq = DistSq;
+			Result.NearestSourceCenter = Center;
+			Result.bHasNearestSource = true;
+		}
+
+		const float Dist = ToPlanet.Size();
+		if (Dist < 1.f) continue;
+
+		float Strength = 0.f;
+		if (UPlanetGravitySourceComponent* Source = Planet->FindComponentByClass<UPlanetGravitySourceComponent>())
+		{
+			Strength = Source->ComputeGravityStrengthAtDistance(Dist);
+		}
+		else
+		{
+			// Backward-compatible fallback for legacy planet actors without a gravity source component.
+			const float Radius = GetLegacyActorRadius(Planet);
+			const float Ratio = Radius / FMath::Max(Dist, Radius);
+			Strength = FMath::Pow(Ratio, 2.f);
+		}
+
+		if (Strength <= KINDA_SMALL_NUMBER) continue;
+		Result.BestStrength = FMath::Max(Result.BestStrength, Strength);
+		Result.WeightedGravity += ToPlanet.GetSafeNormal() * Strength;
+	}
+
+	return Result;
+}
+
+const TArray<TWeakObjectPtr<AActor>>& UGravitySourceSubsystem::GetLegacyPlanets()
+{
+	if (bLegacyPlanetsDirty)
+	{
+		ResolveLegacyPlanets();
+	}
+	return LegacyPlanets;
+}
+
+void UGravitySourceSubsystem::ResolveLegacyPlanets()
+{
+	LegacyPlanets.Reset();
+	bLegacyPlanetsDirty = false;
+	++LegacyResolveCount;
+
+	UWorld* World = GetWorld();
+	if (!World) return;
+
+	const FName PlanetTag(TEXT("Planet"));
+	AActor* Largest = nullptr;
+	float MaxScaleSq = 0.f;
+	for (TActorIterator<AActor> It(World); It; ++It)
+	{
+		AActor* Actor = *It;
+		if (Actor->ActorHasTag(PlanetTag))
+		{
+			LegacyPlanets.Add(Actor);
+			continue;
+		}
+
+		// Untagged levels: guess the largest roughly uniform static mesh.
+		const AStaticMeshActor* SMA = Cast<AStaticMeshActor>(Actor);
+		if (!SMA) continue;
+		const FVector S = SMA->GetActorScale3D();
+		const float ScaleSq = S.X * S.X + S.Y * S.Y + S.Z * S.Z;
+		if (ScaleSq < 100.f) continue;
+		const float MaxS = FMath::Max3(S.X, S.Y, S.Z);
+		const float MinS = FMath::Min3(S.X, S.Y, S.Z);
+		if (MaxS > 0.f && (MinS / MaxS) < 0.2f) continue;
+		if (ScaleSq > MaxScaleSq)
+		{
+			MaxScaleSq = ScaleSq;
+			Largest = Actor;
+		}
+	}
+
+	if (LegacyPlanets.Num() == 0 && Largest)
+	{
+		LegacyPlanets.Add(Largest);
+	}
+}
+
+void UGravitySourceSubsystem::HandleActorSpawned(AActor* Actor)
+{
+	if (Actor && (Actor->IsA<AStaticMeshActor>() || Actor->ActorHasTag(FName(TEXT("Planet")))))
+	{
+		bLegacyPlanetsDirty = true;
+	}
+}
+
+void UGravitySourceSubsystem::HandleActorDestroyed(AActor* Actor)
+{
+	for (const TWeakObjectPtr<AActor>& Weak : LegacyPlanets)
+	{
+		if (Weak.Get() == Actor)
+		{
+			bLegacyPlanetsDirty = true;
+			break;
+		}
+	}
+	LegacyRadiusCache.Remove(Actor);
+}
+
+void UGravitySourceSubsystem::HandleLevelChanged(ULevel* Level, UWorld* World)
+{
+	if (World == GetWorld())
+	{
+		bLegacyPlanetsDirty = true;
+	}
+}
+
+void UGravitySourceSubsystem::EvaluateGravityField(TConstArrayView<FVector> Points, TArrayView<FVector> OutAccel, TArrayView<float> OutBestStrength)
+{
+	RefreshSourceCache();
+
+	if (!bUseBarnesHut)
+	{
+		Field.Evaluate(Points, OutAccel, OutBestStrength);
+		return;
+	}
+
+	// Exact part in one SIMD pass, then add the octree approximation per point.
+	ResidualField.Evaluate(Points, OutAccel, OutBestStrength);
+	const bool bWantBest = OutBestStrength.Num() > 0;
+	for (int32 i = 0; i < Points.Num(); ++i)
+	{
+		float Best = bWantBest ? OutBestStrength[i] : 0.f;
+		Octree.Evaluate(Points[i], BarnesHutOpeningAngle, OutAccel[i], Best);
+		if (bWantBest)
+		{
+			OutBestStrength[i] = Best;
+		}
+	}
+}
@@ -0,0 +1,293 @@
+// Copyright Federation Game. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Engine/EngineBaseTypes.h"
+#include "Planet/GravityField.h"
+#include "Planet/GravityInfluenceGrid.h"
+#include "Planet/GravityOctree.h"
+#include "Planet/PlanetGravityComponent.h"
+#include "UObject/ObjectKey.h"
+#include "WorldCollision.h"
+#include "GravitySourceSubsystem.generated.h"
+
+class UPlanetGravitySourceComponent;
+class UPlanetGravityComponent;
+class UGravitySourceSubsystem;
+
+/** Cached, per-frame copy of a gravity source's placement and falloff parameters. */
+struct FGravitySourceEntry
+{
+	TWeakObjectPtr<UPlanetGravitySourceComponent> Source;
+	TWeakObjectPtr<AActor> Owner;
+	/** Identity-only copy of Owner for IgnoreActor checks off the game thread (never dereferenced). */
+	const AActor* OwnerKey = nullptr;
+	FVector Center = FVector::ZeroVector;
+	float RadiusUU = 0.f;
+	float SurfaceGravityScale = 1.f;
+	float FalloffExponent = 2.f;
+	float MinDistanceMultiplier = 1.f;
+	float MaxInfluenceDistanceMultiplier = 0.f;
+	bool bAffectsGravity = true;
+};
+
+/** Result of summing all registered sources at one world location. */
+struct FGravityQueryResult
+{
+	/** Sum of (direction to source * strength) over all contributing sources. */
+	FVector WeightedGravity = FVector::ZeroVector;
+
+	/** Strongest single-source contribution. */
+	float BestStrength = 0.f;
+
+	/** Center of the nearest enabled source (valid when bHasNearestSource). */
+	FVector NearestSourceCenter = FVector::ZeroVector;
+	bool bHasNearestSource = false;
+
+	/** Number of enabled sources in the registry (excluding the ignored actor's), culled or not. */
+	int32 NumSources = 0;
+
+	/** Sources actually evaluated after influence-volume culling (0 in deep space). */
+	int32 NumVisitedSources = 0;
+};
+
+/** Pre-physics tick that solves gravity for every registered UPlanetGravityComponent in one parallel pass. */
+USTRUCT()
+struct FGravityBatchTickFunction : public FTickFunction
+{
+	GENERATED_BODY()
+
+	UGravitySourceSubsystem* Subsystem = nullptr;
+
+	virtual void ExecuteTick(float DeltaTime, ELevelTick TickType, ENamedThreads::Type CurrentThread, const FGraphEventRef& MyCompletionGraphEvent) override;
+	virtual FString DiagnosticMessage() override { return TEXT("FGravityBatchTickFunction"); }
+};
+
+template<>
+struct TStructOpsTypeTraits<FGravityBatchTickFunction> : public TStructOpsTypeTraitsBase2<FGravityBatchTickFunction>
+{
+	enum { WithCopy = false };
+};
+
+/**
+ * Registry of every UPlanetGravitySourceComponent in the world.
+ * Auto-created per UWorld; sources register/unregister themselves.
+ *
+ * Keeps a packed array of cached center/radius/falloff so gravity consumers
+ * cost O(sources) per query instead of walking every actor in the level.
+ *
+ * Also owns the batched gravity pass: UPlanetGravityComponents register as consumers, and a
+ * TG_PrePhysics tick (ordered before their own ticks and their CMCs) solves all of them in a
+ * ParallelFor, then writes results back on the game thread.
+ */
+UCLASS()
+class FEDERATION_API UGravitySourceSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void OnWorldBeginPlay(UWorld& InWorld) override;
+	virtual void Deinitialize() override;
+
+	void RegisterSource(UPlanetGravitySourceComponent* Source);
+	void UnregisterSource(UPlanetGravitySourceComponent* Source);
+
+	/** Number of live registered sources (enabled or not). */
+	int32 GetNumRegisteredSources() const;
+
+	/**
+	 * Re-reads center/radius/falloff from every registered component and rebuilds the influence grid and
+	 * octree. Only runs when the cache is dirty (a source registered, unregistered or moved) or a source's
+	 * parameters no longer match the cached copy, unless forced.
+	 */
+	void RefreshSourceCache(bool bForce = false);
+
+	/** Flags the cache for a rebuild on the next refresh (e.g. after swapping a source's meshes at runtime). */
+	UFUNCTION(BlueprintCallable, Category = "Gravity")
+	void MarkSourcesDirty() { bCacheDirty = true; }
+	bool IsSourceCacheDirty() const { return bCacheDirty; }
+
+	/** Number of cache rebuilds so far (exposed for tests and benchmarks). */
+	int32 GetNumCacheRebuilds() const { return NumCacheRebuilds; }
+
+	/**
+	 * Follows a world origin shift (called by UFloatingOriginSubsystem): queued probes move with it, probes
+	 * already in flight are dropped (their hits would land in the old frame) and the source cache is rebuilt.
+	 */
+	void ApplyOriginOffset(const FVector& Offset);
+
+	/**
+	 * Sums every enabled source at Location. IgnoreActor (usually the querying pawn) never contributes.
+	 * In Barnes–Hut mode, far clusters of inverse-square sources are approximated (see SetBarnesHutEnabled).
+	 */
+	FGravityQueryResult QueryGravityAt(const FVector& Location, const AActor* IgnoreActor = nullptr);
+
+	/** QueryGravityAt without the refresh: read-only, safe from worker threads once the cache is current. */
+	FGravityQueryResult QueryGravityAtCached(const FVector& Location, const AActor* IgnoreActor = nullptr) const;
+
+	void RegisterGravityConsumer(UPlanetGravityComponent* Consumer);
+	void UnregisterGravityConsumer(UPlanetGravityComponent* Consumer);
+	int32 GetNumGravityConsumers() const { return GravityConsumers.Num(); }
+
+	/** The pre-physics batch tick every consumer and its CMC wait on (exposed for tests). */
+	const FTickFunction& GetBatchTickFunction() const { return BatchTickFunction; }
+
+	/**
+	 * Solves gravity for every consumer (ParallelFor over plain data) and applies the results on the game thread.
+	 * Runs from the pre-physics batch tick; public so tests can drive it in editor worlds.
+	 * Consumers with no registered source in range keep their own serial path (legacy Planet-tag levels).
+	 */
+	void RunGravityBatch();
+
+	/**
+	 * Queues a ground-contact probe for Consumer (one per consumer per frame; a later call replaces it).
+	 * Called from UPlanetGravityComponent::RecoverGroundContact.
+	 */
+	void QueueGroundProbe(UPlanetGravityComponent* Consumer, const FVector& Start, const FVector& End);
+
+	/**
+	 * Hands last frame's async probe hits back to their consumers, then collects this frame's probes
+	 * from every consumer and submits them together as async line traces (results arrive next frame).
+	 * Runs from the pre-physics batch tick; public so tests can drive it.
+	 */
+	void RunGroundProbes(float DeltaTime);
+
+	/** Probe queued for Consumer and not yet submitted (exposed for tests). */
+	bool GetQueuedGroundProbe(const UPlanetGravityComponent* Consumer, FVector& OutStart, FVector& OutEnd) const;
+	int32 GetNumQueuedGroundProbes() const { return QueuedGroundProbes.Num(); }
+	int32 GetNumInFlightGroundProbes() const { return InFlightGroundProbes.Num(); }
+
+	/**
+	 * Batched evaluation for many query points (NPCs, projectiles, debris) in one pass.
+	 * OutAccel[i] receives the same value as QueryGravityAt(Points[i]).WeightedGravity.
+	 * OutBestStrength is optional; pass an empty view to skip it.
+	 */
+	void EvaluateGravityField(TConstArrayView<FVector> Points, TArrayView<FVector> OutAccel,
+		TArrayView<float> OutBestStrength = TArrayView<float>());
+
+	/**
+	 * Bounding-box radius for legacy planet actors without a gravity source component.
+	 * Cached per actor and re-measured only when the actor's rotation or scale changes.
+	 */
+	float GetLegacyActorRadius(const AActor* Actor);
+
+	/** True when Actor has a cached legacy radius (exposed for tests). */
+	bool HasCachedLegacyRadius(const AActor* Actor) const { return LegacyRadiusCache.Contains(Actor); }
+
+	/**
+	 * Fallback for older levels with no registered sources: sums the legacy planets
+	 * (Planet-tagged actors, else the largest roughly uniform StaticMeshActor).
+	 */
+	FGravityQueryResult QueryLegacyGravityAt(const FVector& Location, const AActor* IgnoreActor = nullptr);
+
+	/**
+	 * Legacy planet list. Resolved with one world scan on first use, then only re-resolved after a
+	 * level is added/removed or a relevant actor (StaticMeshActor or Planet-tagged) spawns or a
+	 * resolved planet is destroyed. Tags added to existing actors later need MarkLegacyPlanetsDirty().
+	 */
+	const TArray<TWeakObjectPtr<AActor>>& GetLegacyPlanets();
+	void MarkLegacyPlanetsDirty() { bLegacyPlanetsDirty = true; }
+	bool IsLegacyPlanetListDirty() const { return bLegacyPlanetsDirty; }
+
+	/** Number of world scans done for legacy discovery (exposed for tests). */
+	int32 GetLegacyResolveCount() const { return LegacyResolveCount; }
+
+	/**
+	 * Optional Barnes–Hut approximation for star-system-scale body counts. Inverse-square sources without
+	 * a cutoff go into an octree; every other source is still summed exactly. Off by default.
+	 * OpeningAngle (theta) trades accuracy for speed: 0 = exact, ~0.5 = typical, 1+ = coarse.
+	 */
+	void SetBarnesHutEnabled(bool bEnabled);
+	bool IsBarnesHutEnabled() const { return bUseBarnesHut; }
+	void SetBarnesHutOpeningAngle(float InOpeningAngle) { BarnesHutOpeningAngle = FMath::Max(0.f, InOpeningAngle); }
+	float GetBarnesHutOpeningAngle() const { return BarnesHutOpeningAngle; }
+
+	/**
+	 * Influence-volume culling (on by default): queries only visit sources whose
+	 * Radius * MaxInfluenceDistanceMultiplier sphere can contain the point. Sources without a
+	 * cutoff are always visited. When a point is outside every volume, the nearest-source
+	 * fallback is skipped too and the query returns zero gravity.
+	 */
+	void SetInfluenceCullingEnabled(bool bEnabled) { bUseInfluenceCulling = bEnabled; }
+	bool IsInfluenceCullingEnabled() const { return bUseInfluenceCulling; }
+	const FGravityInfluenceGrid& GetInfluenceGrid() const { return InfluenceGrid; }
+
+	/** SoA field built from the cache of enabled sources on each refresh. */
+	const FGravityField& GetGravityField() const { return Field; }
+
+	/** Packed cache as of the last refresh (exposed for tests and debug drawing). */
+	const TArray<FGravitySourceEntry>& GetCachedSources() const { return CachedSources; }
+
+private:
+	/** True if any cached source's gravity parameters or radius differ from its component's current values. */
+	bool HaveSourceParamsChanged() const;
+
+	TArray<TWeakObjectPtr<UPlanetGravitySourceComponent>> RegisteredSources;
+	TArray<FGravitySourceEntry> CachedSources;
+	FGravityField Field;
+	FGravityInfluenceGrid InfluenceGrid;
+	bool bUseInfluenceCulling = true;
+
+	/** Enabled sources per owning actor, so IgnoreActor can be discounted without a scan. */
+	TMap<TObjectKey<AActor>, int32> SourceOwners;
+
+	/** Barnes–Hut mode: octree of eligible sources plus an exact field for the rest. */
+	FGravityOctree Octree;
+	FGravityField ResidualField;
+	int32 NumEnabledSources = 0;
+	bool bUseBarnesHut = false;
+	float BarnesHutOpeningAngle = 0.5f;
+
+	FGravityQueryResult QueryGravityApproximate(const FVector& Location) const;
+
+	struct FGravityBatchJob
+	{
+		UPlanetGravityComponent* Consumer = nullptr;
+		const AActor* IgnoreActor = nullptr;
+		FPlanetGravitySolveParams Params;
+		FGravityQueryResult Query;
+		FPlanetGravitySolution Solution;
+	};
+
+	TArray<TWeakObjectPtr<UPlanetGravityComponent>> GravityConsumers;
+	TArray<FGravityBatchJob> BatchJobs;
+	void AddBatchPrerequisites(UPlanetGravityComponent* Consumer);
+
+	struct FGroundProbe
+	{
+		TWeakObjectPtr<UPlanetGravityComponent> Consumer;
+		FVector Start = FVector::ZeroVector;
+		FVector End = FVector::ZeroVector;
+		FTraceHandle Handle;
+	};
+	TMap<TObjectKey<UPlanetGravityComponent>, FGroundProbe> QueuedGroundProbes;
+	TArray<FGroundProbe> InFlightGroundProbes;
+	FGravityBatchTickFunction BatchTickFunction;
+
+	struct FLegacyRadiusEntry
+	{
+		FQuat Rotation = FQuat::Identity;
+		FVector Scale = FVector::OneVector;
+		float RadiusUU = 0.f;
+	};
+	TMap<TObjectKey<AActor>, FLegacyRadiusEntry> LegacyRadiusCache;
+
+	void ResolveLegacyPlanets();
+	void HandleActorSpawned(AActor* Actor);
+	void HandleActorDestroyed(AActor* Actor);
+	void HandleLevelChanged(ULevel* Level, UWorld* World);
+
+	TArray<TWeakObjectPtr<AActor>> LegacyPlanets;
+	FDelegateHandle ActorSpawnedHandle;
+	FDelegateHandle ActorDestroyedHandle;
+	FDelegateHandle LevelAddedHandle;
+	FDelegateHandle LevelRemovedHandle;
+	int32 LegacyResolveCount = 0;
+	bool bLegacyPlanetsDirty = true;
+
+	int32 NumCacheRebuilds = 0;
+	bool bCacheDirty = true;
+};
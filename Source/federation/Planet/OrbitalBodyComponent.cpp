@@ -0,0 +1,62 @@
+// Copyright Federation Game. All Rights Reserved.
+
+#include "Planet/OrbitalBodyComponent.h"
+#include "Planet/OrbitalMechanicsSubsystem.h"
+#include "Planet/PlanetGravitySourceComponent.h"
+#include "GameFramework/Actor.h"
+#include "Engine/World.h"
+
+namespace OrbitalBody
+{
+	/** Default world gravity (UU/s^2) that SurfaceGravityScale 1.0 corresponds to. */
+	constexpr double ReferenceSurfaceGravity = 980.0;
+}
+
+UOrbitalBodyComponent::UOrbitalBodyComponent()
+{
+	PrimaryComponentTick.bCanEverTick = false;
+}
+
+void UOrbitalBodyComponent::OnRegister()
+{
+	Super::OnRegister();
+
+	if (UWorld* World = GetWorld())
+	{
+		if (UOrbitalMechanicsSubsystem* Sub = World->GetSubsystem<UOrbitalMechanicsSubsystem>())
+		{
+			Sub->RegisterBody(this);
+		}
+	}
+}
+
+void UOrbitalBodyComponent::OnUnregister()
+{
+	if (UWorld* World = GetWorld())
+	{
+		if (UOrbitalMechanicsSubsystem* Sub = World->GetSubsystem<UOrbitalMechanicsSubsystem>())
+		{
+			Sub->UnregisterBody(this);
+		}
+	}
+
+	Super::OnUnregister();
+}
+
+double UOrbitalBodyComponent::ComputeMu() const
+{
+	if (MuOverride > 0.0)
+	{
+		return MuOverride;
+	}
+
+	// Surface gravity g = Mu / R^2, so the source's falloff and the orbit agree at the surface.
+	const AActor* Owner = GetOwner();
+	const UPlanetGravitySourceComponent* Source = Owner ? Owner->FindComponentByClass<UPlanetGravitySourceComponent>() : nullptr;
+	if (!Source || !Source->bAffectsGravity)
+	{
+		return 0.0;
+	}
+	const double Radius = FMath::Max(1.0, static_cast<double>(Source->GetSourceRadiusUU()));
+	return FMath::Max(0.0, static_cast<double>(Source->SurfaceGravityScale)) * OrbitalBody::ReferenceSurfaceGravity * Radius * Radius;
+}
@@ -0,0 +1,80 @@
+// Copyright Federation Game. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Components/ActorComponent.h"
+#include "OrbitalBodyComponent.generated.h"
+
+UENUM(BlueprintType)
+enum class EOrbitMode : uint8
+{
+	/** Fixed in place; still attracts N-body bodies if its Mu > 0. */
+	Static,
+	/** Closed-form Kepler orbit around OrbitParent (on rails, exactly periodic). */
+	Kepler,
+	/** Integrated under every massive body (symplectic leapfrog). */
+	NBody
+};
+
+/**
+ * Puts the owning actor (planet, moon, station) into UOrbitalMechanicsSubsystem.
+ * The subsystem steps all bodies on a fixed timestep in double precision; gravity queries and
+ * UPlanetSurfaceStreamer read positions from that state. Registers while the component is registered.
+ */
+UCLASS(ClassGroup = "Federation", meta = (BlueprintSpawnableComponent))
+class FEDERATION_API UOrbitalBodyComponent : public UActorComponent
+{
+	GENERATED_BODY()
+
+public:
+	UOrbitalBodyComponent();
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Orbit")
+	EOrbitMode OrbitMode = EOrbitMode::Static;
+
+	/** Body this one orbits (Kepler), or whose velocity it inherits for bStartInCircularOrbit (NBody). Needs its own UOrbitalBodyComponent. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Orbit")
+	TObjectPtr<AActor> OrbitParent;
+
+	/** Gravitational parameter G*M (UU^3/s^2). 0 = derive from a sibling gravity source: SurfaceGravityScale * 980 * Radius^2. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Orbit", meta = (ClampMin = "0.0"))
+	double MuOverride = 0.0;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Orbit|Kepler", meta = (ClampMin = "1.0"))
+	double SemiMajorAxis = 1000000.0;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Orbit|Kepler", meta = (ClampMin = "0.0", ClampMax = "0.99"))
+	double Eccentricity = 0.0;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Orbit|Kepler")
+	double InclinationDegrees = 0.0;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Orbit|Kepler")
+	double LongitudeOfAscendingNodeDegrees = 0.0;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Orbit|Kepler")
+	double ArgumentOfPeriapsisDegrees = 0.0;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Orbit|Kepler")
+	double MeanAnomalyAtEpochDegrees = 0.0;
+
+	/** NBody only: initial velocity (UU/s), relative to OrbitParent's velocity if a parent is set. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Orbit|NBody")
+	FVector InitialVelocity = FVector::ZeroVector;
+
+	/** NBody only: ignore InitialVelocity and start on a circular orbit around OrbitParent. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Orbit|NBody")
+	bool bStartInCircularOrbit = false;
+
+	/** Move the owning actor to the propagated position after each step. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Orbit")
+	bool bDriveActorTransform = true;
+
+	/** Effective gravitational parameter (MuOverride or derived from the gravity source). */
+	double ComputeMu() const;
+
+protected:
+	virtual void OnRegister() override;
+	virtual void OnUnregister() override;
+};
@@ -0,0 +1,287 @@
+// Copyright Federation Game. All Rights Reserved.
+
+#include "Planet/OrbitalMechanicsSubsystem.h"
+#include "Planet/OrbitalBodyComponent.h"
+#include "Planet/GravitySourceSubsystem.h"
+#include "GameFramework/Actor.h"
+#include "Engine/World.h"
+#include "HAL/PlatformTime.h"
+
+void UOrbitalMechanicsSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	const UWorld* World = GetWorld();
+	if (!World || !World->IsGameWorld()) return;
+
+	AdvanceTime(DeltaTime);
+}
+
+TStatId UOrbitalMechanicsSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UOrbitalMechanicsSubsystem, STATGROUP_Tickables);
+}
+
+void UOrbitalMechanicsSubsystem::RegisterBody(UOrbitalBodyComponent* Body)
+{
+	if (!Body) return;
+
+	for (const TWeakObjectPtr<UOrbitalBodyComponent>& Existing : RegisteredBodies)
+	{
+		if (Existing.Get() == Body) return;
+	}
+	RegisteredBodies.Add(Body);
+	bSystemDirty = true;
+	MarkGravitySourcesDirty();
+}
+
+void UOrbitalMechanicsSubsystem::UnregisterBody(UOrbitalBodyComponent* Body)
+{
+	RegisteredBodies.RemoveAll([Body](const TWeakObjectPtr<UOrbitalBodyComponent>& Entry)
+	{
+		return !Entry.IsValid() || Entry.Get() == Body;
+	});
+	bSystemDirty = true;
+	MarkGravitySourcesDirty();
+}
+
+int32 UOrbitalMechanicsSubsystem::GetNumBodies() const
+{
+	int32 Count = 0;
+	for (const TWeakObjectPtr<UOrbitalBodyComponent>& Weak : RegisteredBodies)
+	{
+		if (Weak.IsValid()) ++Count;
+	}
+	return Count;
+}
+
+bool UOrbitalMechanicsSubsystem::GetBodyPosition(const AActor* Actor, FVector& OutPosition) const
+{
+	if (bSystemDirty || !Actor) return false;
+	const int32* Index = ActorToBody.Find(Actor);
+	if (!Index) return false;
+	OutPosition = System.GetPosition(*Index);
+	return true;
+}
+
+bool UOrbitalMechanicsSubsystem::GetBodyVelocity(const AActor* Actor, FVector& OutVelocity) const
+{
+	if (bSystemDirty || !Actor) return false;
+	const int32* Index = ActorToBody.Find(Actor);
+	if (!Index) return false;
+	OutVelocity = System.GetVelocity(*Index);
+	return true;
+}
+
+int32 UOrbitalMechanicsSubsystem::AdvanceTime(double DeltaSeconds)
+{
+	RebuildIfDirty();
+
+	LastFrameStepCount = 0;
+	if (FixedTimeStep <= 0.0 || System.Num() == 0) return 0;
+
+	Accumulator += FMath::Max(0.0, DeltaSeconds) * TimeScale;
+
+	const double StartTime = FPlatformTime::Seconds();
+	while (Accumulator >= FixedTimeStep && LastFrameStepCount < MaxStepsPerFrame)
+	{
+		System.Step(FixedTimeStep);
+		Accumulator -= FixedTimeStep;
+		++LastFrameStepCount;
+
+		if ((FPlatformTime::Seconds() - StartTime) * 1000.0 >= FrameBudgetMs) break;
+	}
+
+	// Over budget: drop the backlog beyond one frame's worth rather than spiralling.
+	Accumulator = FMath::Min(Accumulator, FixedTimeStep * MaxStepsPerFrame);
+
+	if (LastFrameStepCount > 0)
+	{
+		WriteBackActorTransforms();
+		MarkGravitySourcesDirty();
+	}
+	return LastFrameStepCount;
+}
+
+void UOrbitalMechanicsSubsystem::StepFixed(int32 NumSteps)
+{
+	RebuildIfDirty();
+	for (int32 Step = 0; Step < NumSteps; ++Step)
+	{
+		System.Step(FixedTimeStep);
+	}
+	if (NumSteps > 0)
+	{
+		WriteBackActorTransforms();
+		MarkGravitySourcesDirty();
+	}
+}
+
+void UOrbitalMechanicsSubsystem::ApplyOriginOffset(const FVector& Offset)
+{
+	System.ApplyOriginOffset(Offset);
+}
+
+void UOrbitalMechanicsSubsystem::RebuildIfDirty()
+{
+	if (!bSystemDirty) return;
+
+	// Carry over integrated state so registering one new body doesn't reset everyone else's orbit.
+	TMap<TObjectKey<AActor>, TPair<FVector, FVector>> PreviousState;
+	for (int32 i = 0; i < SystemBodies.Num(); ++i)
+	{
+		const UOrbitalBodyComponent* Body = SystemBodies[i].Get();
+		if (Body && Body->GetOwner())
+		{
+			PreviousState.Add(Body->GetOwner(), TPair<FVector, FVector>(System.GetPosition(i), System.GetVelocity(i)));
+		}
+	}
+
+	const double SimulationTime = System.GetSimulationTime();
+	System.Reset();
+	System.SetSimulationTime(SimulationTime);
+	SystemBodies.Reset();
+	ActorToBody.Reset();
+
+	RegisteredBodies.RemoveAll([](const TWeakObjectPtr<UOrbitalBodyComponent>& Entry) { return !Entry.IsValid(); });
+
+	TMap<TObjectKey<AActor>, UOrbitalBodyComponent*> ByActor;
+	for (const TWeakObjectPtr<UOrbitalBodyComponent>& Weak : RegisteredBodies)
+	{
+		UOrbitalBodyComponent* Body = Weak.Get();
+		if (Body && Body->GetOwner())
+		{
+			ByActor.Add(Body->GetOwner(), Body);
+		}
+	}
+
+	TMap<UOrbitalBodyComponent*, int32> Added;
+	TSet<UOrbitalBodyComponent*> InProgress;
+	for (const TWeakObjectPtr<UOrbitalBodyComponent>& Weak : RegisteredBodies)
+	{
+		if (UOrbitalBodyComponent* Body = Weak.Get())
+		{
+			AddBodyRecursive(Body, ByActor, Added, InProgress, PreviousState);
+		}
+	}
+
+	bSystemDirty = false;
+}
+
+int32 UOrbitalMechanicsSubsystem::AddBodyRecursive(UOrbitalBodyComponent* Body, const TMap<TObjectKey<AActor>, UOrbitalBodyComponent*>& ByActor,
+	TMap<UOrbitalBodyComponent*, int32>& Added, TSet<UOrbitalBodyComponent*>& InProgress,
+	const TMap<TObjectKey<AActor>, TPair<FVector, FVector>>& PreviousState)
+{
+	if (const int32* Existing = Added.Find(Body))
+	{
+		return *Existing;
+	}
+	AActor* Owner = Body->GetOwner();
+	if (!Owner) return INDEX_NONE;
+
+	// Parents are added first so the system can evaluate hierarchies in one in-order pass.
+	int32 ParentIndex = INDEX_NONE;
+	if (Body->OrbitParent && Body->OrbitParent != Owner && !InProgress.Contains(Body))
+	{
+		if (UOrbitalBodyComponent* const* ParentBody = ByActor.Find(Body->OrbitParent.Get()))
+		{
+			InProgress.Add(Body);
+			ParentIndex = AddBodyRecursive(*ParentBody, ByActor, Added, InProgress, PreviousState);
+			InProgress.Remove(Body);
+		}
+	}
+
+	// A parent cycle may have added this body while resolving its own ancestors.
+	if (const int32* Existing = Added.Find(Body))
+	{
+		return *Existing;
+	}
+
+	const double Mu = Body->ComputeMu();
+	const TPair<FVector, FVector>* Previous = PreviousState.Find(Owner);
+	int32 Index = INDEX_NONE;
+
+	if (Body->OrbitMode == EOrbitMode::Kepler && ParentIndex != INDEX_NONE)
+	{
+		FKeplerElements Elements;
+		Elements.SemiMajorAxis = Body->SemiMajorAxis;
+		Elements.Eccentricity = Body->Eccentricity;
+		Elements.Inclination = FMath::DegreesToRadians(Body->InclinationDegrees);
+		Elements.LongitudeOfAscendingNode = FMath::DegreesToRadians(Body->LongitudeOfAscendingNodeDegrees);
+		Elements.ArgumentOfPeriapsis = FMath::DegreesToRadians(Body->ArgumentOfPeriapsisDegrees);
+		Elements.MeanAnomalyAtEpoch = FMath::DegreesToRadians(Body->MeanAnomalyAtEpochDegrees);
+		Index = System.AddKeplerBody(ParentIndex, Elements, Mu);
+	}
+	else if (Body->OrbitMode == EOrbitMode::NBody)
+	{
+		FVector Position = Owner->GetActorLocation();
+		FVector Velocity = Body->InitialVelocity;
+		if (Previous)
+		{
+			Position = Previous->Key;
+			Velocity = Previous->Value;
+		}
+		else if (ParentIndex != INDEX_NONE)
+		{
+			const FVector ParentPos = System.GetPosition(ParentIndex);
+			const FVector ParentVel = System.GetVelocity(ParentIndex);
+			if (Body->bStartInCircularOrbit)
+			{
+				// Prograde circular orbit in the plane containing world up where possible.
+				const FVector Radial = Position - ParentPos;
+				const double Dist = Radial.Size();
+				FVector Tangent = FVector::CrossProduct(FVector::UpVector, Radial).GetSafeNormal();
+				if (Tangent.IsNearlyZero())
+				{
+					Tangent = FVector::CrossProduct(FVector::ForwardVector, Radial).GetSafeNormal();
+				}
+				const double Speed = Dist > 1.0 ? FMath::Sqrt(System.GetMu(ParentIndex) / Dist) : 0.0;
+				Velocity = ParentVel + Tangent * Speed;
+			}
+			else
+			{
+				Velocity = ParentVel + Body->InitialVelocity;
+			}
+		}
+		Index = System.AddNBodyBody(Position, Velocity, Mu);
+	}
+	else
+	{
+		Index = System.AddStaticBody(Previous ? Previous->Key : Owner->GetActorLocation(), Mu);
+	}
+
+	Added.Add(Body, Index);
+	ActorToBody.Add(Owner, Index);
+	if (SystemBodies.Num() <= Index)
+	{
+		SystemBodies.SetNum(Index + 1);
+	}
+	SystemBodies[Index] = Body;
+	return Index;
+}
+
+void UOrbitalMechanicsSubsystem::MarkGravitySourcesDirty() const
+{
+	// Orbiting sources are cached at their propagated position, which moves without a transform update
+	// when the body doesn't drive its actor.
+	const UWorld* World = GetWorld();
+	if (UGravitySourceSubsystem* GravitySources = World ? World->GetSubsystem<UGravitySourceSubsystem>() : nullptr)
+	{
+		GravitySources->MarkSourcesDirty();
+	}
+}
+
+void UOrbitalMechanicsSubsystem::WriteBackActorTransforms()
+{
+	for (int32 i = 0; i < SystemBodies.Num(); ++i)
+	{
+		UOrbitalBodyComponent* Body = SystemBodies[i].Get();
+		if (!Body || !Body->bDriveActorTransform) continue;
+		if (System.GetKind(i) == FOrbitalSystem::EBodyKind::Static) continue;
+
+		if (AActor* Owner = Body->GetOwner())
+		{
+			Owner->SetActorLocation(System.GetPosition(i), false, nullptr, ETeleportType::TeleportPhysics);
+		}
+	}
+}
@@ -0,0 +1,82 @@
+// Copyright Federation Game. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Planet/OrbitalSystem.h"
+#include "UObject/ObjectKey.h"
+#include "OrbitalMechanicsSubsystem.generated.h"
+
+class UOrbitalBodyComponent;
+
+/**
+ * Owns every UOrbitalBodyComponent in the world and advances them on a fixed timestep.
+ *
+ * Frame time accumulates and is consumed in whole FixedTimeStep steps, capped by MaxStepsPerFrame and
+ * FrameBudgetMs; leftover time carries over, so the state depends only on the step count (deterministic).
+ * UGravitySourceSubsystem and UPlanetSurfaceStreamer read body positions from here.
+ */
+UCLASS()
+class FEDERATION_API UOrbitalMechanicsSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	void RegisterBody(UOrbitalBodyComponent* Body);
+	void UnregisterBody(UOrbitalBodyComponent* Body);
+	int32 GetNumBodies() const;
+
+	/** Propagated position of Actor's orbital body. False if Actor has no registered body. */
+	bool GetBodyPosition(const AActor* Actor, FVector& OutPosition) const;
+	bool GetBodyVelocity(const AActor* Actor, FVector& OutVelocity) const;
+
+	/** Adds DeltaSeconds * TimeScale to the accumulator and runs as many fixed steps as the budget allows. Returns steps taken. */
+	int32 AdvanceTime(double DeltaSeconds);
+
+	/** Runs exactly NumSteps fixed steps regardless of budget (tests, scripted warps). */
+	void StepFixed(int32 NumSteps);
+
+	/** Shifts all propagated positions (floating-origin rebasing). */
+	void ApplyOriginOffset(const FVector& Offset);
+
+	const FOrbitalSystem& GetSystem() const { return System; }
+	int32 GetLastFrameStepCount() const { return LastFrameStepCount; }
+	double GetPendingTime() const { return Accumulator; }
+
+	// --- Settings ---
+
+	/** Seconds of simulated time per step. */
+	double FixedTimeStep = 1.0 / 60.0;
+
+	/** Simulated seconds per real second. */
+	double TimeScale = 1.0;
+
+	/** Hard cap on steps per frame; excess backlog is dropped so a hitch can't cause a spiral. */
+	int32 MaxStepsPerFrame = 8;
+
+	/** Stop stepping for this frame once this much wall time has been spent. */
+	double FrameBudgetMs = 2.0;
+
+private:
+	void RebuildIfDirty();
+	int32 AddBodyRecursive(UOrbitalBodyComponent* Body, const TMap<TObjectKey<AActor>, UOrbitalBodyComponent*>& ByActor,
+		TMap<UOrbitalBodyComponent*, int32>& Added, TSet<UOrbitalBodyComponent*>& InProgress,
+		const TMap<TObjectKey<AActor>, TPair<FVector, FVector>>& PreviousState);
+	void WriteBackActorTransforms();
+	void MarkGravitySourcesDirty() const;
+
+	TArray<TWeakObjectPtr<UOrbitalBodyComponent>> RegisteredBodies;
+
+	FOrbitalSystem System;
+	/** Index-aligned with System bodies. */
+	TArray<TWeakObjectPtr<UOrbitalBodyComponent>> SystemBodies;
+	TMap<TObjectKey<AActor>, int32> ActorToBody;
+
+	double Accumulator = 0.0;
+	int32 LastFrameStepCount = 0;
+	bool bSystemDirty = true;
+};
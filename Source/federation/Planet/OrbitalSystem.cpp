@@ -0,0 +1,238 @@
+// Copyright Federation Game. All Rights Reserved.
+
+#include "Planet/OrbitalSystem.h"
+#include "Async/ParallelFor.h"
+
+namespace OrbitalSystem
+{
+	constexpr double MaxEccentricity = 0.99;
+	constexpr int32 KeplerSolverIterations = 12;
+
+	/** Below this many N-body bodies the acceleration pass stays on the calling thread. */
+	constexpr int32 MinBodiesForParallelAccel = 64;
+}
+
+void FOrbitalSystem::Reset()
+{
+	Positions.Reset();
+	Velocities.Reset();
+	Accelerations.Reset();
+	Mu.Reset();
+	Kinds.Reset();
+	Parents.Reset();
+	Elements.Reset();
+	KeplerBodies.Reset();
+	NBodies.Reset();
+	Attractors.Reset();
+	SimulationTime = 0.0;
+	bAccelerationsValid = false;
+}
+
+int32 FOrbitalSystem::AddStaticBody(const FVector& Position, double InMu)
+{
+	const int32 Index = Positions.Add(Position);
+	Velocities.Add(FVector::ZeroVector);
+	Accelerations.Add(FVector::ZeroVector);
+	Mu.Add(FMath::Max(0.0, InMu));
+	Kinds.Add(EBodyKind::Static);
+	Parents.Add(INDEX_NONE);
+	Elements.AddDefaulted();
+	if (Mu[Index] > 0.0) Attractors.Add(Index);
+	bAccelerationsValid = false;
+	return Index;
+}
+
+int32 FOrbitalSystem::AddKeplerBody(int32 ParentIndex, const FKeplerElements& InElements, double InMu)
+{
+	check(Positions.IsValidIndex(ParentIndex));
+
+	FKeplerElements Clamped = InElements;
+	Clamped.SemiMajorAxis = FMath::Max(1.0, Clamped.SemiMajorAxis);
+	Clamped.Eccentricity = FMath::Clamp(Clamped.Eccentricity, 0.0, OrbitalSystem::MaxEccentricity);
+
+	const int32 Index = Positions.AddZeroed();
+	Velocities.AddZeroed();
+	Accelerations.AddZeroed();
+	Mu.Add(FMath::Max(0.0, InMu));
+	Kinds.Add(EBodyKind::Kepler);
+	Parents.Add(ParentIndex);
+	Elements.Add(Clamped);
+	KeplerBodies.Add(Index);
+	if (Mu[Index] > 0.0) Attractors.Add(Index);
+
+	FVector Local, LocalVel;
+	EvaluateKepler(Clamped, Mu[ParentIndex], SimulationTime, Local, LocalVel);
+	Positions[Index] = Positions[ParentIndex] + Local;
+	Velocities[Index] = Velocities[ParentIndex] + LocalVel;
+	bAccelerationsValid = false;
+	return Index;
+}
+
+int32 FOrbitalSystem::AddNBodyBody(const FVector& Position, const FVector& Velocity, double InMu)
+{
+	const int32 Index = Positions.Add(Position);
+	Velocities.Add(Velocity);
+	Accelerations.Add(FVector::ZeroVector);
+	Mu.Add(FMath::Max(0.0, InMu));
+	Kinds.Add(EBodyKind::NBody);
+	Parents.Add(INDEX_NONE);
+	Elements.AddDefaulted();
+	NBodies.Add(Index);
+	if (Mu[Index] > 0.0) Attractors.Add(Index);
+	bAccelerationsValid = false;
+	return Index;
+}
+
+void FOrbitalSystem::EvaluateKepler(const FKeplerElements& E, double ParentMu, double Time, FVector& OutPosition, FVector& OutVelocity)
+{
+	const double A = E.SemiMajorAxis;
+	const double Ecc = E.Eccentricity;
+	const double SafeMu = FMath::Max(ParentMu, UE_DOUBLE_SMALL_NUMBER);
+	const double MeanMotion = FMath::Sqrt(SafeMu / (A * A * A));
+	const double M = FMath::Fmod(E.MeanAnomalyAtEpoch + MeanMotion * Time, UE_DOUBLE_TWO_PI);
+
+	// Newton iteration on Kepler's equation E - e sin E = M.
+	double EA = Ecc > 0.8 ? UE_DOUBLE_PI : M;
+	for (int32 Iter = 0; Iter < OrbitalSystem::KeplerSolverIterations; ++Iter)
+	{
+		const double F = EA - Ecc * FMath::Sin(EA) - M;
+		const double Delta = F / (1.0 - Ecc * FMath::Cos(EA));
+		EA -= Delta;
+		if (FMath::Abs(Delta) < 1e-14) break;
+	}
+
+	const double CosE = FMath::Cos(EA);
+	const double SinE = FMath::Sin(EA);
+	const double Root = FMath::Sqrt(1.0 - Ecc * Ecc);
+	const double R = A * (1.0 - Ecc * CosE);
+	const double VelFactor = FMath::Sqrt(SafeMu * A) / R;
+
+	// Perifocal frame (periapsis along +X, orbit normal +Z).
+	const double Px = A * (CosE - Ecc);
+	const double Py = A * Root * SinE;
+	const double Vx = -VelFactor * SinE;
+	const double Vy = VelFactor * Root * CosE;
+
+	// Rotate by Rz(Omega) * Rx(i) * Rz(omega).
+	const double CosO = FMath::Cos(E.LongitudeOfAscendingNode), SinO = FMath::Sin(E.LongitudeOfAscendingNode);
+	const double CosI = FMath::Cos(E.Inclination), SinI = FMath::Sin(E.Inclination);
+	const double CosW = FMath::Cos(E.ArgumentOfPeriapsis), SinW = FMath::Sin(E.ArgumentOfPeriapsis);
+
+	const double R11 = CosO * CosW - SinO * SinW * CosI;
+	const double R12 = -CosO * SinW - SinO * CosW * CosI;
+	const double R21 = SinO * CosW + CosO * SinW * CosI;
+	const double R22 = -SinO * SinW + CosO * CosW * CosI;
+	const double R31 = SinW * SinI;
+	const double R32 = CosW * SinI;
+
+	OutPosition = FVector(R11 * Px + R12 * Py, R21 * Px + R22 * Py, R31 * Px + R32 * Py);
+	OutVelocity = FVector(R11 * Vx + R12 * Vy, R21 * Vx + R22 * Vy, R31 * Vx + R32 * Vy);
+}
+
+void FOrbitalSystem::UpdateKeplerBodies()
+{
+	// Parents always precede children, so one in-order pass resolves whole hierarchies.
+	for (const int32 Index : KeplerBodies)
+	{
+		const int32 Parent = Parents[Index];
+		FVector Local, LocalVel;
+		EvaluateKepler(Elements[Index], Mu[Parent], SimulationTime, Local, LocalVel);
+		Positions[Index] = Positions[Parent] + Local;
+		Velocities[Index] = Velocities[Parent] + LocalVel;
+	}
+}
+
+void FOrbitalSystem::ComputeNBodyAccelerations()
+{
+	const double Eps2 = SofteningLength * SofteningLength;
+	auto AccelFor = [this, Eps2](int32 BodyIndex)
+	{
+		const FVector& P = Positions[BodyIndex];
+		FVector Accel = FVector::ZeroVector;
+		for (const int32 Other : Attractors)
+		{
+			if (Other == BodyIndex) continue;
+			const FVector Delta = Positions[Other] - P;
+			const double DistSq = Delta.SizeSquared() + Eps2;
+			if (DistSq <= UE_DOUBLE_SMALL_NUMBER) continue;
+			const double InvDist = 1.0 / FMath::Sqrt(DistSq);
+			Accel += Delta * (Mu[Other] * InvDist * InvDist * InvDist);
+		}
+		Accelerations[BodyIndex] = Accel;
+	};
+
+	// Each body writes only its own slot, so the parallel pass stays deterministic.
+	ParallelFor(NBodies.Num(), [this, &AccelFor](int32 i) { AccelFor(NBodies[i]); },
+		NBodies.Num() < OrbitalSystem::MinBodiesForParallelAccel ? EParallelForFlags::ForceSingleThread : EParallelForFlags::None);
+	bAccelerationsValid = true;
+}
+
+void FOrbitalSystem::Step(double Dt)
+{
+	if (Dt <= 0.0) return;
+
+	if (!bAccelerationsValid)
+	{
+		ComputeNBodyAccelerations();
+	}
+
+	// Kick-drift-kick leapfrog: symplectic, second order, time-reversible.
+	const double HalfDt = 0.5 * Dt;
+	for (const int32 Index : NBodies)
+	{
+		Velocities[Index] += Accelerations[Index] * HalfDt;
+		Positions[Index] += Velocities[Index] * Dt;
+	}
+
+	SimulationTime += Dt;
+	UpdateKeplerBodies();
+	ComputeNBodyAccelerations();
+
+	for (const int32 Index : NBodies)
+	{
+		Velocities[Index] += Accelerations[Index] * HalfDt;
+	}
+}
+
+void FOrbitalSystem::ApplyOriginOffset(const FVector& Offset)
+{
+	for (FVector& Position : Positions)
+	{
+		Position += Offset;
+	}
+}
+
+double FOrbitalSystem::ComputeTotalEnergy() const
+{
+	double Kinetic = 0.0;
+	double Potential = 0.0;
+	for (int32 i = 0; i < Positions.Num(); ++i)
+	{
+		if (Kinds[i] == EBodyKind::Kepler) continue;
+		Kinetic += 0.5 * Mu[i] * Velocities[i].SizeSquared();
+		for (int32 j = i + 1; j < Positions.Num(); ++j)
+		{
+			if (Kinds[j] == EBodyKind::Kepler) continue;
+			const double Dist = FMath::Sqrt(FVector::DistSquared(Positions[i], Positions[j]) + SofteningLength * SofteningLength);
+			if (Dist > UE_DOUBLE_SMALL_NUMBER)
+			{
+				Potential -= Mu[i] * Mu[j] / Dist;
+			}
+		}
+	}
+	return Kinetic + Potential;
+}
+
+double FOrbitalSystem::ComputeSpecificEnergy(int32 Body, int32 Primary) const
+{
+	const FVector RelVel = Velocities[Body] - Velocities[Primary];
+	const double Dist = FMath::Sqrt(FVector::DistSquared(Positions[Body], Positions[Primary]) + SofteningLength * SofteningLength);
+	return 0.5 * RelVel.SizeSquared() - Mu[Primary] / FMath::Max(Dist, UE_DOUBLE_SMALL_NUMBER);
+}
+
+double FOrbitalSystem::GetKeplerPeriod(int32 Index) const
+{
+	if (Kinds[Index] != EBodyKind::Kepler) return 0.0;
+	const double A = Elements[Index].SemiMajorAxis;
+	return UE_DOUBLE_TWO_PI * FMath::Sqrt(A * A * A / FMath::Max(Mu[Parents[Index]], UE_DOUBLE_SMALL_NUMBER));
+}
@@ -0,0 +1,101 @@
+// Copyright Federation Game. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/** Classical orbital elements relative to a parent body. Angles in radians, distances in UU. */
+struct FKeplerElements
+{
+	double SemiMajorAxis = 0.0;
+	/** Clamped to [0, 0.99]; only closed orbits are supported. */
+	double Eccentricity = 0.0;
+	double Inclination = 0.0;
+	double LongitudeOfAscendingNode = 0.0;
+	double ArgumentOfPeriapsis = 0.0;
+	double MeanAnomalyAtEpoch = 0.0;
+};
+
+/**
+ * Deterministic fixed-step orbital propagation over a packed, double-precision state array.
+ * Plain data (no UObjects) so it can be stepped headless by tests and by UOrbitalMechanicsSubsystem.
+ *
+ * Three body kinds share one index space:
+ * - Static: fixed position, attracts others if Mu > 0.
+ * - Kepler: on rails around an earlier body, evaluated in closed form at the current simulation time.
+ * - NBody: integrated with kick-drift-kick leapfrog (symplectic) under every body with Mu > 0.
+ *
+ * Mu is the gravitational parameter G*M in UU^3/s^2. Bodies with Mu == 0 are test particles and cost
+ * nothing as attractors, so thousands of small bodies scale as O(bodies * attractors).
+ */
+class FEDERATION_API FOrbitalSystem
+{
+public:
+	enum class EBodyKind : uint8
+	{
+		Static,
+		Kepler,
+		NBody
+	};
+
+	void Reset();
+
+	int32 AddStaticBody(const FVector& Position, double Mu);
+	/** ParentIndex must refer to an already-added body (parents are always evaluated first). */
+	int32 AddKeplerBody(int32 ParentIndex, const FKeplerElements& Elements, double Mu);
+	int32 AddNBodyBody(const FVector& Position, const FVector& Velocity, double Mu);
+
+	/** Advances one fixed step of Dt seconds. Identical inputs and step counts give bit-identical state. */
+	void Step(double Dt);
+
+	int32 Num() const { return Positions.Num(); }
+	double GetSimulationTime() const { return SimulationTime; }
+	/** Sets the clock on an empty/rebuilt system so Kepler bodies resume where they were. */
+	void SetSimulationTime(double Time) { SimulationTime = Time; }
+	EBodyKind GetKind(int32 Index) const { return Kinds[Index]; }
+	double GetMu(int32 Index) const { return Mu[Index]; }
+	const FVector& GetPosition(int32 Index) const { return Positions[Index]; }
+	const FVector& GetVelocity(int32 Index) const { return Velocities[Index]; }
+
+	/** Shifts every position (e.g. origin rebasing); velocities and orbital elements are relative and unaffected. */
+	void ApplyOriginOffset(const FVector& Offset);
+
+	/**
+	 * Total mechanical energy of the NBody/Static subset, in mass units of Mu (i.e. scaled by 1/G).
+	 * Conserved up to the integrator's bounded oscillation when no Kepler body has Mu > 0.
+	 */
+	double ComputeTotalEnergy() const;
+
+	/** Specific orbital energy of Body relative to Primary: v^2/2 - Mu_primary / r. */
+	double ComputeSpecificEnergy(int32 Body, int32 Primary) const;
+
+	/** Orbital period of a Kepler body around its parent, in seconds. */
+	double GetKeplerPeriod(int32 Index) const;
+
+	/** Closed-form Kepler position/velocity relative to the parent at Time (no parent offset applied). */
+	static void EvaluateKepler(const FKeplerElements& Elements, double ParentMu, double Time, FVector& OutPosition, FVector& OutVelocity);
+
+	/** Plummer softening length (UU) for N-body accelerations; avoids blow-ups on close passes. */
+	double SofteningLength = 0.0;
+
+private:
+	void UpdateKeplerBodies();
+	void ComputeNBodyAccelerations();
+
+	// Packed SoA state: index i describes one body across every array.
+	TArray<FVector> Positions;
+	TArray<FVector> Velocities;
+	TArray<FVector> Accelerations;
+	TArray<double> Mu;
+	TArray<EBodyKind> Kinds;
+	TArray<int32> Parents;
+	TArray<FKeplerElements> Elements;
+
+	/** Index lists per role, kept in insertion order for determinism. */
+	TArray<int32> KeplerBodies;
+	TArray<int32> NBodies;
+	TArray<int32> Attractors;
+
+	double SimulationTime = 0.0;
+	bool bAccelerationsValid = false;
+};
@@ -60,5 +60,11 @@ void APlanet::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent
 	{
 		WaypointComp->DisplayName = PlanetName;
 	}
+
+	// Mesh or scale edits change the bounds the gravity source measures its radius from.
+	if (PlanetGravitySource)
+	{
+		PlanetGravitySource->InvalidateRadiusCache();
+	}
 }
 #endif
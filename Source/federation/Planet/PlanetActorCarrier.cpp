@@ -0,0 +1,160 @@
+// Copyright Federation Game. All Rights Reserved.
+
+#include "Planet/PlanetActorCarrier.h"
+#include "Planet/PlanetSurfaceMapping.h"
+#include "Camera/PlayerCameraManager.h"
+#include "Components/PrimitiveComponent.h"
+#include "Components/SceneComponent.h"
+#include "Engine/OverlapResult.h"
+#include "Engine/World.h"
+#include "GameFramework/Controller.h"
+#include "GameFramework/Info.h"
+#include "GameFramework/MovementComponent.h"
+
+const FName FPlanetActorCarrier::NoCarryTag(TEXT("NoPlanetCarry"));
+
+int32 FPlanetActorCarrier::Gather(UWorld* World, const FVector& Center, double Radius, const AActor* Planet, const AActor* Ignore)
+{
+	Reset();
+	if (!World || Radius <= 0.0) return 0;
+
+	// Only what collides near the player is looked at, not every actor in the world.
+	TArray<FOverlapResult> Overlaps;
+	FCollisionQueryParams QueryParams(SCENE_QUERY_STAT(PlanetActorCarrierGather), false, Ignore);
+	World->OverlapMultiByObjectType(Overlaps, Center, FQuat::Identity,
+		FCollisionObjectQueryParams(FCollisionObjectQueryParams::InitType::AllObjects), FCollisionShape::MakeSphere(Radius), QueryParams);
+
+	const FName PlanetTag(TEXT("Planet"));
+	const double RadiusSq = Radius * Radius;
+	TSet<const AActor*> Visited;
+	for (const FOverlapResult& Overlap : Overlaps)
+	{
+		// One result per overlapping component; look at each actor once.
+		AActor* Actor = Overlap.GetActor();
+		if (!Actor) continue;
+		bool bAlreadyVisited = false;
+		Visited.Add(Actor, &bAlreadyVisited);
+		if (bAlreadyVisited) continue;
+
+		const USceneComponent* Root = Actor->GetRootComponent();
+		if (!Root || Root->Mobility != EComponentMobility::Movable || Actor == Ignore) continue;
+		if (FVector::DistSquared(Root->GetComponentLocation(), Center) > RadiusSq) continue;
+
+		// Surface level content stays put; attached actors move with their parent.
+		if (Actor->GetLevel() != World->PersistentLevel || Actor->GetAttachParentActor()) continue;
+		if (Actor == Planet || (Planet && Actor->IsOwnedBy(Planet))) continue;
+		if (Actor->ActorHasTag(PlanetTag) || Actor->ActorHasTag(NoCarryTag)) continue;
+		if (Actor->IsA<AController>() || Actor->IsA<AInfo>() || Actor->IsA<APlayerCameraManager>()) continue;
+
+		Actors.Add(Actor);
+	}
+	return Actors.Num();
+}
+
+void FPlanetActorCarrier::Add(AActor* Actor)
+{
+	if (Actor && Actor->GetRootComponent())
+	{
+		Actors.AddUnique(Actor);
+	}
+}
+
+void FPlanetActorCarrier::Reset()
+{
+	Actors.Reset();
+	Locations.Reset();
+	Rotations.Reset();
+	Velocities.Reset();
+	AngularVelocities.Reset();
+	Mapped.Reset();
+}
+
+void FPlanetActorCarrier::Capture()
+{
+	Actors.RemoveAll([](const TWeakObjectPtr<AActor>& Actor) { return !Actor.IsValid() || !Actor->GetRootComponent(); });
+	Locations.Reset(Actors.Num());
+	Rotations.Reset(Actors.Num());
+	Velocities.Reset(Actors.Num());
+	AngularVelocities.Reset(Actors.Num());
+	for (const TWeakObjectPtr<AActor>& Actor : Actors)
+	{
+		const USceneComponent* Root = Actor->GetRootComponent();
+		const UPrimitiveComponent* Body = Cast<UPrimitiveComponent>(Root);
+		Locations.Add(Root->GetComponentLocation());
+		Rotations.Add(Root->GetComponentQuat());
+		Velocities.Add(Actor->GetVelocity());
+		AngularVelocities.Add(Body && Body->IsSimulatingPhysics() ? Body->GetPhysicsAngularVelocityInRadians() : FVector::ZeroVector);
+	}
+	Mapped.SetNumUninitialized(Actors.Num());
+}
+
+int32 FPlanetActorCarrier::MoveToSurface(const FPlanetSurfaceMapping& Mapping)
+{
+	Capture();
+	Mapping.SpaceToSurface(Locations, Mapped);
+	for (int32 i = 0; i < Actors.Num(); ++i)
+	{
+		// Local up on the sphere becomes the frame normal.
+		const FVector SpaceUp = (Locations[i] - Mapping.GetPlanetCenter()).GetSafeNormal();
+		const FQuat Turn = FQuat::FindBetweenNormals(SpaceUp.IsNearlyZero() ? Mapping.GetNormal() : SpaceUp, Mapping.GetNormal());
+		Locations[i] = Mapped[i];
+		Rotations[i] = Turn * Rotations[i];
+		Velocities[i] = Turn.RotateVector(Velocities[i]);
+		AngularVelocities[i] = Turn.RotateVector(AngularVelocities[i]);
+	}
+	return Apply();
+}
+
+int32 FPlanetActorCarrier::MoveToSpace(const FPlanetSurfaceMapping& Mapping)
+{
+	Capture();
+	Mapping.SurfaceToSpace(Locations, Mapped);
+	for (int32 i = 0; i < Actors.Num(); ++i)
+	{
+		const FVector SpaceUp = (Mapped[i] - Mapping.GetPlanetCenter()).GetSafeNormal();
+		const FQuat Turn = FQuat::FindBetweenNormals(Mapping.GetNormal(), SpaceUp.IsNearlyZero() ? Mapping.GetNormal() : SpaceUp);
+		Locations[i] = Mapped[i];
+		Rotations[i] = Turn * Rotations[i];
+		Velocities[i] = Turn.RotateVector(Velocities[i]);
+		AngularVelocities[i] = Turn.RotateVector(AngularVelocities[i]);
+	}
+	return Apply();
+}
+
+int32 FPlanetActorCarrier::Apply() const
+{
+	// Every scope stays open until the whole group is placed, so children and overlaps are brought up
+	// to date once, against everyone's new positions rather than half of them.
+	TArray<TUniquePtr<FScopedMovementUpdate>, TInlineAllocator<16>> DeferredUpdates;
+	DeferredUpdates.Reserve(Actors.Num());
+
+	int32 NumMoved = 0;
+	for (int32 i = 0; i < Actors.Num(); ++i)
+	{
+		AActor* Actor = Actors[i].Get();
+		USceneComponent* Root = Actor ? Actor->GetRootComponent() : nullptr;
+		if (!Root) continue;
+
+		DeferredUpdates.Add(MakeUnique<FScopedMovementUpdate>(Root, EScopedUpdate::DeferredUpdates));
+		Root->SetWorldLocationAndRotation(Locations[i], Rotations[i], false, nullptr, ETeleportType::TeleportPhysics);
+
+		if (UMovementComponent* Movement = Actor->FindComponentByClass<UMovementComponent>())
+		{
+			Movement->Velocity = Velocities[i];
+			Movement->UpdateComponentVelocity();
+		}
+		else if (UPrimitiveComponent* Body = Cast<UPrimitiveComponent>(Root); Body && Body->IsSimulatingPhysics())
+		{
+			Body->SetPhysicsLinearVelocity(Velocities[i]);
+			Body->SetPhysicsAngularVelocityInRadians(AngularVelocities[i]);
+		}
+		++NumMoved;
+	}
+
+	// Closing the scopes applies the deferred updates, last opened first.
+	while (DeferredUpdates.Num() > 0)
+	{
+		DeferredUpdates.Pop();
+	}
+	return NumMoved;
+}
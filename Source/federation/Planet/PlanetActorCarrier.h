@@ -0,0 +1,57 @@
+// Copyright Federation Game. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class AActor;
+class UWorld;
+class FPlanetSurfaceMapping;
+
+/**
+ * Carries the actors around the player (ships, companions, projectiles) across a space/surface
+ * handoff so they keep their place relative to the player. Gather picks them once; MoveToSurface and
+ * MoveToSpace then read every transform and velocity, convert all locations through the surface
+ * mapping in one batch, turn rotations and velocities with the local up, and apply the results.
+ *
+ * Actors are moved as teleports inside deferred movement scopes that stay open until the whole group
+ * is placed, so attached components and overlaps update once and no sweep runs. A moved physics body
+ * keeps its (turned) linear and angular velocity.
+ */
+class FEDERATION_API FPlanetActorCarrier
+{
+public:
+	/** Actors with this tag are never carried. */
+	static const FName NoCarryTag;
+
+	/**
+	 * Replaces the set with every movable, unattached actor of the persistent level whose root is within
+	 * Radius of Center, found with a sphere overlap query (so only actors with a query-enabled primitive).
+	 * Skips Ignore (the player, moved separately), anything owned by Planet (tiles, LOD mesh),
+	 * planets, controllers and info actors. Returns the number gathered.
+	 */
+	int32 Gather(UWorld* World, const FVector& Center, double Radius, const AActor* Planet, const AActor* Ignore);
+
+	/** Adds Actor without filtering. */
+	void Add(AActor* Actor);
+
+	/** Each returns the number of actors moved; the set is kept for a later move back. */
+	int32 MoveToSurface(const FPlanetSurfaceMapping& Mapping);
+	int32 MoveToSpace(const FPlanetSurfaceMapping& Mapping);
+
+	void Reset();
+	int32 Num() const { return Actors.Num(); }
+
+private:
+	/** Reads transforms and velocities of the live actors (dead ones are dropped). */
+	void Capture();
+	int32 Apply() const;
+
+	TArray<TWeakObjectPtr<AActor>> Actors;
+	TArray<FVector> Locations;
+	TArray<FQuat> Rotations;
+	TArray<FVector> Velocities;
+	/** Radians per second; zero for actors that aren't simulating physics. */
+	TArray<FVector> AngularVelocities;
+	TArray<FVector> Mapped;
+};
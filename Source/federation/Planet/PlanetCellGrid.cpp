@@ -0,0 +1,148 @@
+// Copyright Federation Game. All Rights Reserved.
+
+#include "Planet/PlanetCellGrid.h"
+
+namespace PlanetCellGrid
+{
+	/** Per face: outward normal, then the axes that face-local A and B run along. */
+	const FVector FaceNormal[6] = { FVector(1, 0, 0), FVector(-1, 0, 0), FVector(0, 1, 0), FVector(0, -1, 0), FVector(0, 0, 1), FVector(0, 0, -1) };
+	const FVector FaceAxisA[6] = { FVector(0, 1, 0), FVector(0, -1, 0), FVector(-1, 0, 0), FVector(1, 0, 0), FVector(0, 1, 0), FVector(0, 1, 0) };
+	const FVector FaceAxisB[6] = { FVector(0, 0, 1), FVector(0, 0, 1), FVector(0, 0, 1), FVector(0, 0, 1), FVector(-1, 0, 0), FVector(1, 0, 0) };
+
+	constexpr int32 MaxCellsPerFaceEdge = 1 << 16;
+}
+
+FPlanetCellGrid::FPlanetCellGrid(int32 InCellsPerFaceEdge)
+	: CellsPerFaceEdge(FMath::Clamp(InCellsPerFaceEdge, 1, PlanetCellGrid::MaxCellsPerFaceEdge))
+{
+}
+
+bool FPlanetCellGrid::IsValidCell(const FPlanetCellId& Cell) const
+{
+	return Cell.Face >= 0 && Cell.Face < 6
+		&& Cell.X >= 0 && Cell.X < CellsPerFaceEdge
+		&& Cell.Y >= 0 && Cell.Y < CellsPerFaceEdge;
+}
+
+FPlanetCellId FPlanetCellGrid::CellFromDirection(const FVector& Direction) const
+{
+	using namespace PlanetCellGrid;
+
+	const FVector Abs = Direction.GetAbs();
+	if (Abs.IsNearlyZero())
+	{
+		return FPlanetCellId();
+	}
+
+	int32 Face;
+	if (Abs.X >= Abs.Y && Abs.X >= Abs.Z)
+	{
+		Face = Direction.X >= 0.0 ? 0 : 1;
+	}
+	else if (Abs.Y >= Abs.Z)
+	{
+		Face = Direction.Y >= 0.0 ? 2 : 3;
+	}
+	else
+	{
+		Face = Direction.Z >= 0.0 ? 4 : 5;
+	}
+
+	// Gnomonic face coordinates in [-1, 1], then equal-angle: atan spreads cells evenly in arc.
+	const double N = FVector::DotProduct(Direction, FaceNormal[Face]);
+	const double U = FVector::DotProduct(Direction, FaceAxisA[Face]) / N;
+	const double V = FVector::DotProduct(Direction, FaceAxisB[Face]) / N;
+	const double A = FMath::Atan(U) / UE_DOUBLE_QUARTER_PI;
+	const double B = FMath::Atan(V) / UE_DOUBLE_QUARTER_PI;
+
+	const int32 Last = CellsPerFaceEdge - 1;
+	return FPlanetCellId(Face,
+		FMath::Clamp(FMath::FloorToInt32((A + 1.0) * 0.5 * CellsPerFaceEdge), 0, Last),
+		FMath::Clamp(FMath::FloorToInt32((B + 1.0) * 0.5 * CellsPerFaceEdge), 0, Last));
+}
+
+FVector FPlanetCellGrid::GetCellCenterDirection(const FPlanetCellId& Cell) const
+{
+	return DirectionFromFaceCoords(Cell.Face, CellCenterCoord(Cell.X), CellCenterCoord(Cell.Y));
+}
+
+void FPlanetCellGrid::GetNeighbors(const FPlanetCellId& Cell, TArray<FPlanetCellId, TInlineAllocator<8>>& OutNeighbors) const
+{
+	OutNeighbors.Reset();
+	for (int32 DY = -1; DY <= 1; ++DY)
+	{
+		for (int32 DX = -1; DX <= 1; ++DX)
+		{
+			if (DX == 0 && DY == 0) continue;
+
+			FPlanetCellId Neighbor(Cell.Face, Cell.X + DX, Cell.Y + DY);
+			if (!IsValidCell(Neighbor))
+			{
+				// Off this face: the center of the would-be cell points into the adjacent face.
+				Neighbor = CellFromDirection(DirectionFromFaceCoords(Cell.Face, CellCenterCoord(Cell.X + DX), CellCenterCoord(Cell.Y + DY)));
+				if (Neighbor == Cell) continue;
+			}
+			OutNeighbors.AddUnique(Neighbor);
+		}
+	}
+}
+
+void FPlanetCellGrid::GatherCellsInRings(const FPlanetCellId& Center, int32 MaxRing, TMap<FPlanetCellId, int32>& OutRings) const
+{
+	OutRings.Reset();
+	if (!IsValidCell(Center)) return;
+
+	// Breadth-first over the 8-neighbourhood: the first visit to a cell is its ring.
+	TArray<FPlanetCellId> Frontier;
+	TArray<FPlanetCellId> Next;
+	TArray<FPlanetCellId, TInlineAllocator<8>> Neighbors;
+	OutRings.Add(Center, 0);
+	Frontier.Add(Center);
+	for (int32 Ring = 1; Ring <= MaxRing && Frontier.Num() > 0; ++Ring)
+	{
+		Next.Reset();
+		for (const FPlanetCellId& Cell : Frontier)
+		{
+			GetNeighbors(Cell, Neighbors);
+			for (const FPlanetCellId& Neighbor : Neighbors)
+			{
+				if (!OutRings.Contains(Neighbor))
+				{
+					OutRings.Add(Neighbor, Ring);
+					Next.Add(Neighbor);
+				}
+			}
+		}
+		Swap(Frontier, Next);
+	}
+}
+
+int32 FPlanetCellGrid::GetRingDistance(const FPlanetCellId& A, const FPlanetCellId& B, int32 MaxRing) const
+{
+	if (A == B) return 0;
+	if (A.Face == B.Face)
+	{
+		// Same face: plain Chebyshev distance unless a shorter path crosses a seam (only near corners).
+		const int32 Direct = FMath::Max(FMath::Abs(A.X - B.X), FMath::Abs(A.Y - B.Y));
+		if (Direct <= 1) return Direct <= MaxRing ? Direct : INDEX_NONE;
+	}
+
+	TMap<FPlanetCellId, int32> Rings;
+	GatherCellsInRings(A, MaxRing, Rings);
+	const int32* Ring = Rings.Find(B);
+	return Ring ? *Ring : INDEX_NONE;
+}
+
+FVector FPlanetCellGrid::DirectionFromFaceCoords(int32 Face, double A, double B)
+{
+	using namespace PlanetCellGrid;
+
+	const double U = FMath::Tan(A * UE_DOUBLE_QUARTER_PI);
+	const double V = FMath::Tan(B * UE_DOUBLE_QUARTER_PI);
+	return (FaceNormal[Face] + FaceAxisA[Face] * U + FaceAxisB[Face] * V).GetSafeNormal();
+}
+
+double FPlanetCellGrid::CellCenterCoord(int32 Index) const
+{
+	return (Index + 0.5) * 2.0 / CellsPerFaceEdge - 1.0;
+}
@@ -0,0 +1,74 @@
+// Copyright Federation Game. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/** One cell of a FPlanetCellGrid: cube face (0..5 = +X, -X, +Y, -Y, +Z, -Z) and column/row on that face. */
+struct FPlanetCellId
+{
+	int32 Face = 0;
+	int32 X = 0;
+	int32 Y = 0;
+
+	FPlanetCellId() = default;
+	FPlanetCellId(int32 InFace, int32 InX, int32 InY) : Face(InFace), X(InX), Y(InY) {}
+
+	bool operator==(const FPlanetCellId& Other) const { return Face == Other.Face && X == Other.X && Y == Other.Y; }
+	bool operator!=(const FPlanetCellId& Other) const { return !(*this == Other); }
+
+	friend uint32 GetTypeHash(const FPlanetCellId& Cell)
+	{
+		return HashCombine(GetTypeHash(Cell.Face), HashCombine(GetTypeHash(Cell.X), GetTypeHash(Cell.Y)));
+	}
+};
+
+/**
+ * Cube-sphere tiling of a planet into 6 * N * N cells. Directions are projected onto the cube face
+ * they point at, then split with an equal-angle mapping so every cell spans about the same arc
+ * (within ~30%), unlike a plain gnomonic split whose corner cells shrink.
+ *
+ * Pure math on unit directions: scale by the planet radius and add its center for world positions.
+ * Neighbours across face seams come from stepping the cell center past the edge and re-projecting,
+ * so ring distance works the same everywhere on the sphere (three faces meet at a cube corner,
+ * so corner cells have 7 neighbours instead of 8).
+ */
+class FEDERATION_API FPlanetCellGrid
+{
+public:
+	explicit FPlanetCellGrid(int32 InCellsPerFaceEdge = 8);
+
+	int32 GetCellsPerFaceEdge() const { return CellsPerFaceEdge; }
+	int32 GetNumCells() const { return 6 * CellsPerFaceEdge * CellsPerFaceEdge; }
+
+	/** Arc spanned by one cell edge, in radians. */
+	double GetCellAngle() const { return UE_DOUBLE_HALF_PI / CellsPerFaceEdge; }
+
+	bool IsValidCell(const FPlanetCellId& Cell) const;
+
+	/** Cell containing Direction (need not be normalized; zero maps to cell 0). */
+	FPlanetCellId CellFromDirection(const FVector& Direction) const;
+
+	/** Unit direction from the planet center through the middle of Cell. */
+	FVector GetCellCenterDirection(const FPlanetCellId& Cell) const;
+
+	/** The (up to) 8 cells sharing an edge or corner with Cell. */
+	void GetNeighbors(const FPlanetCellId& Cell, TArray<FPlanetCellId, TInlineAllocator<8>>& OutNeighbors) const;
+
+	/** Every cell within MaxRing steps of Center (Chebyshev rings; Center is ring 0), mapped to its ring. */
+	void GatherCellsInRings(const FPlanetCellId& Center, int32 MaxRing, TMap<FPlanetCellId, int32>& OutRings) const;
+
+	/** Ring distance from A to B, or INDEX_NONE if it is greater than MaxRing. */
+	int32 GetRingDistance(const FPlanetCellId& A, const FPlanetCellId& B, int32 MaxRing) const;
+
+	/**
+	 * Unit direction at face-local equal-angle coordinates A, B in [-1, 1] (values past +-1 step onto
+	 * the neighbouring face). Every face has AxisA x AxisB = outward normal.
+	 */
+	static FVector DirectionFromFaceCoords(int32 Face, double A, double B);
+
+private:
+	double CellCenterCoord(int32 Index) const;
+
+	int32 CellsPerFaceEdge = 8;
+};
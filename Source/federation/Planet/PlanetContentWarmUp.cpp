@@ -0,0 +1,90 @@
+// Copyright Federation Game. All Rights Reserved.
+
+#include "Planet/PlanetContentWarmUp.h"
+#include "Components/PrimitiveComponent.h"
+#include "Components/StaticMeshComponent.h"
+#include "Engine/Level.h"
+#include "Engine/StaticMesh.h"
+#include "Engine/Texture.h"
+#include "GameFramework/Actor.h"
+
+int32 FPlanetContentWarmUp::Begin(const ULevel* Level, float ResidentSeconds)
+{
+	Reset();
+	TSet<UStreamableRenderAsset*> Assets;
+	if (Level)
+	{
+		for (const AActor* Actor : Level->Actors)
+		{
+			AddActor(Actor, Assets);
+		}
+	}
+	return Finish(Assets, ResidentSeconds);
+}
+
+int32 FPlanetContentWarmUp::Begin(const AActor* Actor, float ResidentSeconds)
+{
+	Reset();
+	TSet<UStreamableRenderAsset*> Assets;
+	AddActor(Actor, Assets);
+	return Finish(Assets, ResidentSeconds);
+}
+
+void FPlanetContentWarmUp::AddActor(const AActor* Actor, TSet<UStreamableRenderAsset*>& Assets)
+{
+	if (!Actor) return;
+
+	TInlineComponentArray<UPrimitiveComponent*> Primitives;
+	Actor->GetComponents(Primitives);
+	TArray<UTexture*> Textures;
+	for (UPrimitiveComponent* Primitive : Primitives)
+	{
+		Textures.Reset();
+		Primitive->GetUsedTextures(Textures, EMaterialQualityLevel::Num);
+		Assets.Append(Textures);
+
+		if (const UStaticMeshComponent* MeshComponent = Cast<UStaticMeshComponent>(Primitive))
+		{
+			Assets.Add(MeshComponent->GetStaticMesh());
+		}
+		if (Primitive->IsPSOPrecaching())
+		{
+			PendingPrimitives.Add(Primitive);
+		}
+	}
+}
+
+int32 FPlanetContentWarmUp::Finish(const TSet<UStreamableRenderAsset*>& Assets, float ResidentSeconds)
+{
+	for (UStreamableRenderAsset* Asset : Assets)
+	{
+		if (!Asset) continue;
+		Asset->SetForceMipLevelsToBeResident(ResidentSeconds);
+		PendingAssets.Add(Asset);
+	}
+	NumRequests = GetNumOutstanding();
+	bActive = true;
+	return NumRequests;
+}
+
+int32 FPlanetContentWarmUp::Update()
+{
+	// Gone counts as done: nothing left to hitch on.
+	PendingAssets.RemoveAllSwap([](const TWeakObjectPtr<UStreamableRenderAsset>& Asset)
+	{
+		return !Asset.IsValid() || Asset->IsFullyStreamedIn();
+	});
+	PendingPrimitives.RemoveAllSwap([](const TWeakObjectPtr<const UPrimitiveComponent>& Primitive)
+	{
+		return !Primitive.IsValid() || !Primitive->IsPSOPrecaching();
+	});
+	return GetNumOutstanding();
+}
+
+void FPlanetContentWarmUp::Reset()
+{
+	PendingAssets.Reset();
+	PendingPrimitives.Reset();
+	NumRequests = 0;
+	bActive = false;
+}
@@ -0,0 +1,45 @@
+// Copyright Federation Game. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class AActor;
+class ULevel;
+class UPrimitiveComponent;
+class UStreamableRenderAsset;
+
+/**
+ * Warms freshly loaded surface content so the first frames on the surface don't hitch on first use.
+ * Begin walks the content's primitives once and forces every texture and static mesh they use to be
+ * fully resident for ResidentSeconds (the render asset streaming manager streams them in the
+ * background). It also tracks the primitives whose PSOs are still being precached; those requests
+ * start when the components load. Update re-checks only what is still outstanding, so it gets cheaper
+ * as the content warms. Nothing blocks: the owner decides how long to wait.
+ */
+class FEDERATION_API FPlanetContentWarmUp
+{
+public:
+	/** Replaces the current set with Level's actors (or Actor and its components). Returns the number of requests. */
+	int32 Begin(const ULevel* Level, float ResidentSeconds);
+	int32 Begin(const AActor* Actor, float ResidentSeconds);
+
+	/** Drops requests that are done and returns how many are still outstanding. */
+	int32 Update();
+
+	void Reset();
+
+	/** True between Begin and Reset. */
+	bool IsActive() const { return bActive; }
+	int32 GetNumRequests() const { return NumRequests; }
+	int32 GetNumOutstanding() const { return PendingAssets.Num() + PendingPrimitives.Num(); }
+
+private:
+	void AddActor(const AActor* Actor, TSet<UStreamableRenderAsset*>& Assets);
+	int32 Finish(const TSet<UStreamableRenderAsset*>& Assets, float ResidentSeconds);
+
+	TArray<TWeakObjectPtr<UStreamableRenderAsset>> PendingAssets;
+	TArray<TWeakObjectPtr<const UPrimitiveComponent>> PendingPrimitives;
+	int32 NumRequests = 0;
+	bool bActive = false;
+};
@@ -2,14 +2,13 @@
 
 #include "Planet/PlanetGravityComponent.h"
 #include "Planet/PlanetGravitySourceComponent.h"
+#include "Planet/GravitySourceSubsystem.h"
 #include "GameFramework/CharacterMovementComponent.h"
 #include "GameFramework/Character.h"
 #include "GameFramework/SpringArmComponent.h"
 #include "Components/CapsuleComponent.h"
 #include "Camera/CameraComponent.h"
-#include "Kismet/GameplayStatics.h"
-#include "Engine/StaticMeshActor.h"
-#include "EngineUtils.h"
+#include "Engine/World.h"
 
 UPlanetGravityComponent::UPlanetGravityComponent()
 {
@@ -23,12 +22,43 @@ void UPlanetGravityComponent::SetSurfaceBlendAlpha(float InAlpha)
 
 void UPlanetGravityComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
 {
+	QUICK_SCOPE_CYCLE_COUNTER(STAT_PlanetGravityComponent_Tick);
 	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
 
-	UpdatePlanetGravity();
+	// Gravity is normally solved for all consumers in UGravitySourceSubsystem's pre-physics batch.
+	if (LastBatchedGravityFrame != GFrameCounter)
+	{
+		UpdatePlanetGravity();
+	}
 	UpdateGravityAlignment(DeltaTime);
 	UpdateCameraOrientation();
-	RecoverGroundContact();
+	// Ground-contact recovery runs from the subsystem's batch tick (async probes for all consumers).
+}
+
+void UPlanetGravityComponent::OnRegister()
+{
+	Super::OnRegister();
+
+	if (UWorld* World = GetWorld())
+	{
+		if (UGravitySourceSubsystem* Sub = World->GetSubsystem<UGravitySourceSubsystem>())
+		{
+			Sub->RegisterGravityConsumer(this);
+		}
+	}
+}
+
+void UPlanetGravityComponent::OnUnregister()
+{
+	if (UWorld* World = GetWorld())
+	{
+		if (UGravitySourceSubsystem* Sub = World->GetSubsystem<UGravitySourceSubsystem>())
+		{
+			Sub->UnregisterGravityConsumer(this);
+		}
+	}
+
+	Super::OnUnregister();
 }
 
 void UPlanetGravityComponent::SetCameraReferences(USceneComponent* InFirstPersonRoot, USpringArmComponent* InThirdPersonArm)
@@ -57,161 +87,94 @@ void UPlanetGravityComponent::UpdatePlanetGravity()
 {
 	AActor* Owner = GetOwner();
 	UWorld* World = Owner ? Owner->GetWorld() : nullptr;
-	UCharacterMovementComponent* CMC = GetOwnerCMC();
 	if (!World || !Owner) return;
 
-	// Preferred modular path: any actor with a gravity source component contributes.
-	TArray<AActor*> Planets;
-	for (TActorIterator<AActor> It(World); It; ++It)
-	{
-		AActor* Candidate = *It;
-		if (!Candidate || Candidate == Owner) continue;
-		if (UPlanetGravitySourceComponent* Source = Candidate->FindComponentByClass<UPlanetGravitySourceComponent>())
-		{
-			if (Source->bAffectsGravity)
-			{
-				Planets.Add(Candidate);
-			}
-		}
-	}
+	const FVector MyLoc = Owner->GetActorLocation();
 
-	if (Planets.Num() == 0)
+	// Preferred modular path: every registered gravity source contributes (O(sources), no actor scan).
+	FGravityQueryResult Query;
+	UGravitySourceSubsystem* GravitySources = World->GetSubsystem<UGravitySourceSubsystem>();
+	if (GravitySources)
 	{
-		// Legacy fallback for older levels that only use a Planet tag and no component.
-		UGameplayStatics::GetAllActorsWithTag(World, FName(TEXT("Planet")), Planets);
+		Query = GravitySources->QueryGravityAt(MyLoc, Owner);
 	}
 
-	if (Planets.Num() == 0)
+	// Legacy fallback for older levels with no gravity source components (Planet tag or largest
+	// static mesh). Discovery is cached in the registry, so this never scans the world per tick.
+	if (Query.NumSources == 0 && GravitySources)
 	{
-		AActor* Largest = nullptr;
-		float MaxScaleSq = 0.f;
-		for (TActorIterator<AActor> It(World); It; ++It)
-		{
-			AStaticMeshActor* SMA = Cast<AStaticMeshActor>(*It);
-			if (!SMA || *It == Owner) continue;
-			FVector S = SMA->GetActorScale3D();
-			float ScaleSq = S.X * S.X + S.Y * S.Y + S.Z * S.Z;
-			if (ScaleSq < 100.f) continue;
-			float MaxS = FMath::Max3(S.X, S.Y, S.Z);
-			float MinS = FMath::Min3(S.X, S.Y, S.Z);
-			if (MaxS > 0.f && (MinS / MaxS) < 0.2f) continue;
-			if (ScaleSq > MaxScaleSq)
-			{
-				MaxScaleSq = ScaleSq;
-				Largest = *It;
-			}
-		}
-		if (Largest) Planets.Add(Largest);
+		Query = GravitySources->QueryLegacyGravityAt(MyLoc, Owner);
 	}
 
-	if (Planets.Num() == 0)
+	if (Query.NumSources == 0)
 	{
-		if (CMC)
-		{
-			CMC->SetGravityDirection(FVector::ZeroVector);
-			CMC->GravityScale = 0.f;
-		}
-		GravityDir = FVector::ZeroVector;
-		LastComputedGravityScale = 0.f;
+		ApplyGravitySolution(FPlanetGravitySolution());
 		return;
 	}
 
-	FVector MyLoc = Owner->GetActorLocation();
-	FVector WeightedGravity = FVector::ZeroVector;
-	float BestStrength = 0.f;
-	for (AActor* P : Planets)
-	{
-		if (!P) continue;
-		const FVector ToPlanet = P->GetActorLocation() - MyLoc;
-		const float Dist = ToPlanet.Size();
-		if (Dist < 1.f) continue;
+	ApplyGravitySolution(SolveGravity(Query, MakeSolveParams(MyLoc)));
+}
 
-		float Strength = 0.f;
-		if (UPlanetGravitySourceComponent* Source = P->FindComponentByClass<UPlanetGravitySourceComponent>())
-		{
-			Strength = Source->ComputeGravityStrengthAtDistance(Dist);
-		}
-		else
-		{
-			// Backward-compatible fallback for legacy planet actors without a gravity source component.
-			const FBox Box = P->GetComponentsBoundingBox();
-			const FVector Extent = Box.GetExtent();
-			const float Radius = FMath::Max(1.f, FMath::Max(Extent.X, FMath::Max(Extent.Y, Extent.Z)));
-			const float Ratio = Radius / FMath::Max(Dist, Radius);
-			Strength = FMath::Pow(Ratio, 2.f);
-		}
+FPlanetGravitySolveParams UPlanetGravityComponent::MakeSolveParams(const FVector& Location) const
+{
+	FPlanetGravitySolveParams Params;
+	Params.Location = Location;
+	Params.SurfaceBlendAlpha = SurfaceBlendAlpha;
+	Params.bUseDistanceScaledGravity = bUseDistanceScaledGravity;
+	Params.BaseGravityScale = BaseGravityScale;
+	Params.MinGravityScale = MinGravityScale;
+	Params.MaxGravityScale = MaxGravityScale;
+	return Params;
+}
 
-		if (Strength <= KINDA_SMALL_NUMBER) continue;
-		BestStrength = FMath::Max(BestStrength, Strength);
-		WeightedGravity += ToPlanet.GetSafeNormal() * Strength;
-	}
+FPlanetGravitySolution UPlanetGravityComponent::SolveGravity(const FGravityQueryResult& Query, const FPlanetGravitySolveParams& Params)
+{
+	FPlanetGravitySolution Solution;
 
 	// When net gravity cancels (e.g. between two planets), don't set zero — CMC would fall back to
 	// world down and you'd fall "perpendicular to both planets". Use direction to nearest planet
 	// with a small scale so you drift toward the closer one.
-	if (WeightedGravity.IsNearlyZero())
+	if (Query.WeightedGravity.IsNearlyZero())
 	{
-		AActor* Nearest = nullptr;
-		float NearestDistSq = FLT_MAX;
-		for (AActor* P : Planets)
+		if (Query.bHasNearestSource)
 		{
-			if (!P) continue;
-			const float DistSq = (P->GetActorLocation() - MyLoc).SizeSquared();
-			if (DistSq >= 1.f && DistSq < NearestDistSq)
-			{
-				NearestDistSq = DistSq;
-				Nearest = P;
-			}
-		}
-		if (Nearest)
-		{
-			FVector ToNearest = (Nearest->GetActorLocation() - MyLoc).GetSafeNormal();
+			const FVector ToNearest = (Query.NearestSourceCenter - Params.Location).GetSafeNormal();
 			if (!ToNearest.IsNearlyZero())
 			{
-				if (CMC)
-				{
-					CMC->SetGravityDirection(ToNearest);
-					CMC->GravityScale = MinGravityScale;
-				}
-				GravityDir = ToNearest;
-				LastComputedGravityScale = MinGravityScale;
-				return;
+				Solution.Direction = ToNearest;
+				Solution.GravityScale = Params.MinGravityScale;
 			}
 		}
-		if (CMC)
-		{
-			CMC->SetGravityDirection(FVector::ZeroVector);
-			CMC->GravityScale = 0.f;
-		}
-		GravityDir = FVector::ZeroVector;
-		LastComputedGravityScale = 0.f;
-		return;
+		return Solution;
 	}
 
-	FVector Dir = WeightedGravity.GetSafeNormal();
-	if (SurfaceBlendAlpha > 0.f)
+	FVector Dir = Query.WeightedGravity.GetSafeNormal();
+	if (Params.SurfaceBlendAlpha > 0.f)
 	{
 		// Blend from radial gravity to world-down near surface transitions.
-		Dir = FMath::Lerp(Dir, FVector::DownVector, SurfaceBlendAlpha).GetSafeNormal();
+		Dir = FMath::Lerp(Dir, FVector::DownVector, Params.SurfaceBlendAlpha).GetSafeNormal();
 		if (Dir.IsNearlyZero())
 		{
 			Dir = FVector::DownVector;
 		}
 	}
-	if (CMC)
+
+	Solution.Direction = Dir;
+	Solution.GravityScale = Params.bUseDistanceScaledGravity
+		? FMath::Clamp(Params.BaseGravityScale * Query.BestStrength, Params.MinGravityScale, Params.MaxGravityScale)
+		: Params.BaseGravityScale;
+	return Solution;
+}
+
+void UPlanetGravityComponent::ApplyGravitySolution(const FPlanetGravitySolution& Solution)
+{
+	if (UCharacterMovementComponent* CMC = GetOwnerCMC())
 	{
-		CMC->SetGravityDirection(Dir);
-		if (bUseDistanceScaledGravity)
-		{
-			LastComputedGravityScale = FMath::Clamp(BaseGravityScale * BestStrength, MinGravityScale, MaxGravityScale);
-		}
-		else
-		{
-			LastComputedGravityScale = BaseGravityScale;
-		}
-		CMC->GravityScale = LastComputedGravityScale;
+		CMC->SetGravityDirection(Solution.Direction);
+		CMC->GravityScale = Solution.GravityScale;
 	}
-	GravityDir = Dir;
+	GravityDir = Solution.Direction;
+	LastComputedGravityScale = Solution.GravityScale;
 }
 
 // ---------------------------------------------------------------------------
@@ -395,7 +358,7 @@ void UPlanetGravityComponent::ApplyLookInput(float YawDegrees, float PitchDegree
 // Ground contact recovery (curved-surface floor detection)
 // ---------------------------------------------------------------------------
 
-void UPlanetGravityComponent::RecoverGroundContact()
+void UPlanetGravityComponent::RecoverGroundContact(float DeltaTime)
 {
 	UCharacterMovementComponent* CMC = GetOwnerCMC();
 	if (!CMC || CMC->MovementMode != MOVE_Falling) return;
@@ -408,16 +371,33 @@ void UPlanetGravityComponent::RecoverGroundContact()
 	if (!Capsule) return;
 
 	AActor* Owner = GetOwner();
-	if (!Owner) return;
+	UWorld* World = Owner ? Owner->GetWorld() : nullptr;
+	UGravitySourceSubsystem* GravitySources = World ? World->GetSubsystem<UGravitySourceSubsystem>() : nullptr;
+	if (!GravitySources) return;
 
 	const float CapsuleHalfHeight = Capsule->GetScaledCapsuleHalfHeight();
 	const FVector CapsuleBottom = Owner->GetActorLocation() + GravityDir * CapsuleHalfHeight;
-	const float TraceLen = 15.f;
-	const FVector End = CapsuleBottom + GravityDir * TraceLen;
+	const float Lookahead = FMath::Max(0.f, VelAlongGravity) * DeltaTime * GroundRecoveryLookaheadFrames;
+	const FVector End = CapsuleBottom + GravityDir * (GroundRecoveryTraceLength + Lookahead);
+
+	GravitySources->QueueGroundProbe(this, CapsuleBottom, End);
+}
+
+void UPlanetGravityComponent::ApplyGroundProbeHit(const FHitResult& Hit)
+{
+	UCharacterMovementComponent* CMC = GetOwnerCMC();
+	if (!CMC || CMC->MovementMode != MOVE_Falling) return;
+	if (GravityDir.IsNearlyZero() || !Hit.bBlockingHit) return;
+	if (FVector::DotProduct(CMC->Velocity, GravityDir) < -10.f) return;
+
+	UCapsuleComponent* Capsule = GetOwnerCapsule();
+	AActor* Owner = GetOwner();
+	if (!Capsule || !Owner) return;
 
-	FHitResult Hit;
-	FCollisionQueryParams Params(SCENE_QUERY_STAT(GroundRecover), false, Owner);
-	if (Owner->GetWorld()->LineTraceSingleByChannel(Hit, CapsuleBottom, End, ECC_Visibility, Params) && Hit.bBlockingHit)
+	// The probe was cast from last frame's position; measure the gap from where we are now.
+	const FVector CapsuleBottom = Owner->GetActorLocation() + GravityDir * Capsule->GetScaledCapsuleHalfHeight();
+	const float Gap = FVector::DotProduct(Hit.ImpactPoint - CapsuleBottom, GravityDir);
+	if (Gap <= GroundRecoveryTraceLength)
 	{
 		CMC->SetMovementMode(MOVE_Walking);
 	}
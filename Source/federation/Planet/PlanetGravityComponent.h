@@ -10,6 +10,25 @@ class USceneComponent;
 class USpringArmComponent;
 class UCapsuleComponent;
 class UCharacterMovementComponent;
+struct FGravityQueryResult;
+
+/** Per-consumer inputs for the data-only gravity solve. Plain data so it can run on worker threads. */
+struct FPlanetGravitySolveParams
+{
+	FVector Location = FVector::ZeroVector;
+	float SurfaceBlendAlpha = 0.f;
+	bool bUseDistanceScaledGravity = true;
+	float BaseGravityScale = 1.f;
+	float MinGravityScale = 0.1f;
+	float MaxGravityScale = 3.f;
+};
+
+/** Output of the gravity solve; written back to the component/CMC on the game thread. */
+struct FPlanetGravitySolution
+{
+	FVector Direction = FVector::ZeroVector;
+	float GravityScale = 0.f;
+};
 
 /**
  * Reusable component that provides radial planet gravity, capsule alignment,
@@ -50,6 +69,17 @@ public:
 	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Gravity", meta = (ClampMin = "0.0"))
 	float MaxGravityScale = 3.0f;
 
+	/** While falling, snap to walking when the surface along gravity is within this distance of the capsule bottom. */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Gravity|Ground", meta = (ClampMin = "0.0"))
+	float GroundRecoveryTraceLength = 15.f;
+
+	/**
+	 * Ground probes are async and land a frame late, so the trace is extended by
+	 * fall speed * DeltaTime * this many frames to still catch the surface after the next move.
+	 */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Gravity|Ground", meta = (ClampMin = "0.0"))
+	float GroundRecoveryLookaheadFrames = 1.5f;
+
 	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Gravity|Camera")
 	bool bUseGravityRelativeLook = true;
 
@@ -81,9 +111,35 @@ public:
 	void ApplyLookInput(float YawDegrees, float PitchDegrees);
 
 	void UpdatePlanetGravity();
+
+	/**
+	 * Pure gravity math: zero-sum nearest-planet fallback, SurfaceBlendAlpha blend and scale clamp.
+	 * Touches no UObjects, so UGravitySourceSubsystem can run it for every consumer in a ParallelFor.
+	 */
+	static FPlanetGravitySolution SolveGravity(const FGravityQueryResult& Query, const FPlanetGravitySolveParams& Params);
+
+	/** Snapshot of this component's tuning for SolveGravity. */
+	FPlanetGravitySolveParams MakeSolveParams(const FVector& Location) const;
+
+	/** Writes a solve result to GravityDir / LastComputedGravityScale and the owner's CMC. Game thread only. */
+	void ApplyGravitySolution(const FPlanetGravitySolution& Solution);
+
+	/** Called by the batched pre-physics pass; TickComponent skips its own gravity update that frame. */
+	void MarkGravityBatched(uint64 FrameNumber) { LastBatchedGravityFrame = FrameNumber; }
+
 	void UpdateGravityAlignment(float DeltaTime);
 	void UpdateCameraOrientation();
-	void RecoverGroundContact();
+
+	/**
+	 * While falling toward the surface, queues an async ground probe along gravity with
+	 * UGravitySourceSubsystem, which submits every consumer's probe together and hands the
+	 * hit back through ApplyGroundProbeHit next frame.
+	 */
+	void RecoverGroundContact(float DeltaTime = 0.f);
+
+	/** Async probe result: switches to walking if still falling and the hit is within GroundRecoveryTraceLength. */
+	void ApplyGroundProbeHit(const FHitResult& Hit);
+
 	void InitializeGravityRelativeView(const FVector& Up);
 
 	// --- State (public for testing and direct access) ---
@@ -96,7 +152,14 @@ public:
 	float SurfaceBlendAlpha = 0.f;
 	float LastComputedGravityScale = 1.f;
 
+protected:
+	virtual void OnRegister() override;
+	virtual void OnUnregister() override;
+
 private:
+	/** GFrameCounter of the last batched gravity result applied to this component. */
+	uint64 LastBatchedGravityFrame = MAX_uint64;
+
 	UPROPERTY()
 	TObjectPtr<USceneComponent> FirstPersonCameraRoot;
 
@@ -1,14 +1,61 @@
 // Copyright Federation Game. All Rights Reserved.
 
 #include "Planet/PlanetGravitySourceComponent.h"
+#include "Planet/GravitySourceSubsystem.h"
 #include "Components/SceneComponent.h"
 #include "GameFramework/Actor.h"
+#include "Engine/World.h"
 
 UPlanetGravitySourceComponent::UPlanetGravitySourceComponent()
 {
 	PrimaryComponentTick.bCanEverTick = false;
 }
 
+void UPlanetGravitySourceComponent::OnRegister()
+{
+	Super::OnRegister();
+
+	// OnRegister rather than BeginPlay so editor-world automation tests (which never
+	// BeginPlay) see the same registry contents as PIE/game worlds.
+	if (UWorld* World = GetWorld())
+	{
+		if (UGravitySourceSubsystem* Sub = World->GetSubsystem<UGravitySourceSubsystem>())
+		{
+			Sub->RegisterSource(this);
+		}
+	}
+
+	InvalidateRadiusCache();
+	if (AActor* Owner = GetOwner())
+	{
+		if (USceneComponent* Root = Owner->GetRootComponent())
+		{
+			TransformUpdatedHandle = Root->TransformUpdated.AddUObject(this, &UPlanetGravitySourceComponent::HandleOwnerTransformUpdated);
+			BoundRootComponent = Root;
+		}
+	}
+}
+
+void UPlanetGravitySourceComponent::OnUnregister()
+{
+	if (USceneComponent* Root = BoundRootComponent.Get())
+	{
+		Root->TransformUpdated.Remove(TransformUpdatedHandle);
+	}
+	BoundRootComponent.Reset();
+	TransformUpdatedHandle.Reset();
+
+	if (UWorld* World = GetWorld())
+	{
+		if (UGravitySourceSubsystem* Sub = World->GetSubsystem<UGravitySourceSubsystem>())
+		{
+			Sub->UnregisterSource(this);
+		}
+	}
+
+	Super::OnUnregister();
+}
+
 float UPlanetGravitySourceComponent::GetSourceRadiusUU() const
 {
 	if (ManualRadius > 0.f)
@@ -16,21 +63,74 @@ float UPlanetGravitySourceComponent::GetSourceRadiusUU() const
 		return ManualRadius;
 	}
 
+	if (bRadiusCacheValid)
+	{
+		return CachedRadiusUU;
+	}
+
 	const AActor* Owner = GetOwner();
 	if (!Owner) return 0.f;
 
+	float Radius = 0.f;
 	const FBox Box = Owner->GetComponentsBoundingBox();
+	const USceneComponent* Root = Owner->GetRootComponent();
 	if (Box.IsValid)
 	{
 		const FVector Extent = Box.GetExtent();
-		return FMath::Max(Extent.X, FMath::Max(Extent.Y, Extent.Z));
+		Radius = FMath::Max(Extent.X, FMath::Max(Extent.Y, Extent.Z));
+	}
+	else if (Root)
+	{
+		Radius = Root->Bounds.SphereRadius;
 	}
 
-	if (const USceneComponent* Root = Owner->GetRootComponent())
+	// Zero means no geometry yet (mesh not assigned); keep retrying rather than caching it.
+	if (Radius > 0.f && Root)
 	{
-		return Root->Bounds.SphereRadius;
+		CachedRadiusUU = Radius;
+		CachedRadiusRotation = Root->GetComponentQuat();
+		CachedRadiusScale = Root->GetComponentScale();
+		bRadiusCacheValid = true;
+	}
+	return Radius;
+}
+
+void UPlanetGravitySourceComponent::InvalidateRadiusCache()
+{
+	bRadiusCacheValid = false;
+	MarkRegistryDirty();
+}
+
+void UPlanetGravitySourceComponent::HandleOwnerTransformUpdated(USceneComponent* UpdatedComponent, EUpdateTransformFlags UpdateTransformFlags, ETeleportType Teleport)
+{
+	MarkRegistryDirty();
+	if (!bRadiusCacheValid || !UpdatedComponent) return;
+
+	// Orbiting/rebased planets only translate; the box extent only depends on rotation and scale.
+	if (!UpdatedComponent->GetComponentQuat().Equals(CachedRadiusRotation, KINDA_SMALL_NUMBER)
+		|| !UpdatedComponent->GetComponentScale().Equals(CachedRadiusScale, KINDA_SMALL_NUMBER))
+	{
+		InvalidateRadiusCache();
+	}
+}
+
+#if WITH_EDITOR
+void UPlanetGravitySourceComponent::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
+{
+	Super::PostEditChangeProperty(PropertyChangedEvent);
+	InvalidateRadiusCache();
+}
+#endif
+
+void UPlanetGravitySourceComponent::MarkRegistryDirty() const
+{
+	if (UWorld* World = GetWorld())
+	{
+		if (UGravitySourceSubsystem* Sub = World->GetSubsystem<UGravitySourceSubsystem>())
+		{
+			Sub->MarkSourcesDirty();
+		}
 	}
-	return 0.f;
 }
 
 float UPlanetGravitySourceComponent::ComputeGravityStrengthAtDistance(float DistanceUU) const
@@ -40,15 +140,22 @@ float UPlanetGravitySourceComponent::ComputeGravityStrengthAtDistance(float Dist
 		return 0.f;
 	}
 
-	const float Radius = FMath::Max(GetSourceRadiusUU(), 1.f);
-	const float InfluenceLimit = Radius * MaxInfluenceDistanceMultiplier;
-	if (MaxInfluenceDistanceMultiplier > 0.f && DistanceUU > InfluenceLimit)
+	return ComputeStrengthFromParams(GetSourceRadiusUU(), SurfaceGravityScale, FalloffExponent,
+		MinDistanceMultiplier, MaxInfluenceDistanceMultiplier, DistanceUU);
+}
+
+float UPlanetGravitySourceComponent::ComputeStrengthFromParams(float RadiusUU, float InSurfaceGravityScale, float InFalloffExponent,
+	float InMinDistanceMultiplier, float InMaxInfluenceDistanceMultiplier, float DistanceUU)
+{
+	const float Radius = FMath::Max(RadiusUU, 1.f);
+	const float InfluenceLimit = Radius * InMaxInfluenceDistanceMultiplier;
+	if (InMaxInfluenceDistanceMultiplier > 0.f && DistanceUU > InfluenceLimit)
 	{
 		return 0.f;
 	}
 
-	const float MinDistance = Radius * FMath::Max(0.1f, MinDistanceMultiplier);
+	const float MinDistance = Radius * FMath::Max(0.1f, InMinDistanceMultiplier);
 	const float EffectiveDistance = FMath::Max(DistanceUU, MinDistance);
 	const float Ratio = Radius / EffectiveDistance;
-	return FMath::Max(0.f, SurfaceGravityScale) * FMath::Pow(Ratio, FMath::Max(0.1f, FalloffExponent));
+	return FMath::Max(0.f, InSurfaceGravityScale) * FMath::Pow(Ratio, FMath::Max(0.1f, InFalloffExponent));
 }
@@ -4,11 +4,15 @@
 
 #include "CoreMinimal.h"
 #include "Components/ActorComponent.h"
+#include "Components/SceneComponent.h"
 #include "PlanetGravitySourceComponent.generated.h"
 
 /**
  * Gravity source definition for celestial bodies.
  * Attach to planets/moons and tune falloff without changing consumer logic.
+ * Registers itself with UGravitySourceSubsystem while the component is registered.
+ * Moving the owner flags the registry's cache automatically, and runtime writes to the parameters below
+ * (C++ or Blueprint) are picked up by the registry's next refresh.
  */
 UCLASS(ClassGroup = "Federation", meta = (BlueprintSpawnableComponent))
 class FEDERATION_API UPlanetGravitySourceComponent : public UActorComponent
@@ -42,9 +46,47 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Gravity Source", meta = (ClampMin = "0.0"))
 	float ManualRadius = 0.f;
 
+	/** ManualRadius if set, otherwise the owner's bounding-box radius (cached; see InvalidateRadiusCache). */
 	UFUNCTION(BlueprintCallable, Category = "Gravity Source")
 	float GetSourceRadiusUU() const;
 
+	/**
+	 * Drops the cached bounding-box radius so the next query recomputes it.
+	 * Rotation/scale changes of the owner's root invalidate automatically; call this after swapping meshes at runtime.
+	 */
+	void InvalidateRadiusCache();
+
+	/** True when GetSourceRadiusUU will return the cached radius without walking the owner's components (exposed for tests). */
+	bool IsRadiusCacheValid() const { return bRadiusCacheValid; }
+
 	UFUNCTION(BlueprintCallable, Category = "Gravity Source")
 	float ComputeGravityStrengthAtDistance(float DistanceUU) const;
+
+	/** Shared falloff math so the registry's cached path and the per-component path stay identical. */
+	static float ComputeStrengthFromParams(float RadiusUU, float InSurfaceGravityScale, float InFalloffExponent,
+		float InMinDistanceMultiplier, float InMaxInfluenceDistanceMultiplier, float DistanceUU);
+
+#if WITH_EDITOR
+	virtual void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
+#endif
+
+protected:
+	virtual void OnRegister() override;
+	virtual void OnUnregister() override;
+
+private:
+	void HandleOwnerTransformUpdated(USceneComponent* UpdatedComponent, EUpdateTransformFlags UpdateTransformFlags, ETeleportType Teleport);
+
+	/** The registry only rebuilds its cache when a source flags it (moved, re-measured or edited). */
+	void MarkRegistryDirty() const;
+
+	/** Root the transform delegate is bound to (so we can unbind even if the owner swaps roots). */
+	TWeakObjectPtr<USceneComponent> BoundRootComponent;
+	FDelegateHandle TransformUpdatedHandle;
+
+	/** Bounding-box radius and the root rotation/scale it was measured at; translation never changes it. */
+	mutable float CachedRadiusUU = 0.f;
+	mutable FQuat CachedRadiusRotation = FQuat::Identity;
+	mutable FVector CachedRadiusScale = FVector::OneVector;
+	mutable bool bRadiusCacheValid = false;
 };
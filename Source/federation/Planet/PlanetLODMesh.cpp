@@ -0,0 +1,383 @@
+// Copyright Federation Game. All Rights Reserved.
+
+#include "Planet/PlanetLODMesh.h"
+#include "Camera/PlayerCameraManager.h"
+#include "Components/DynamicMeshComponent.h"
+#include "Components/SceneComponent.h"
+#include "DynamicMesh/DynamicMesh3.h"
+#include "Engine/CollisionProfile.h"
+#include "Engine/World.h"
+#include "GameFramework/Pawn.h"
+#include "GameFramework/PlayerController.h"
+#include "Materials/MaterialInterface.h"
+
+using UE::Geometry::FDynamicMesh3;
+
+namespace PlanetLODMesh
+{
+	/** Chunk tasks in flight at once; a fast fly-by can't queue the whole tree. */
+	constexpr int32 MaxPendingChunks = 64;
+
+	/**
+	 * Node chunk mesh (worker thread): sphere-projected heightfield relative to the node center, with
+	 * normals from a one-sample apron (so they match across node borders) and a skirt below the border.
+	 */
+	TSharedPtr<FDynamicMesh3> BuildNodeMesh(const FPlanetTerrainSettings& Terrain, const FPlanetQuadtree& Quadtree,
+		const FPlanetQuadNodeId& Node, int32 Res, float SkirtDepthFraction)
+	{
+		const double R = Quadtree.GetPlanetRadius();
+		const FPlanetTerrainGenerator Generator(Terrain, R);
+		const FVector Origin = Quadtree.GetNodeCenterDirection(Node) * R;
+		const double Step = 1.0 / (Res - 1);
+
+		const int32 Apron = Res + 2;
+		const int32 NumApron = Apron * Apron;
+		TArray<FVector> Dirs;
+		TArray<float> DirX, DirY, DirZ, Heights;
+		Dirs.SetNumUninitialized(NumApron);
+		DirX.SetNumUninitialized(NumApron);
+		DirY.SetNumUninitialized(NumApron);
+		DirZ.SetNumUninitialized(NumApron);
+		Heights.SetNumUninitialized(NumApron);
+		for (int32 j = 0; j < Apron; ++j)
+		{
+			for (int32 i = 0; i < Apron; ++i)
+			{
+				const int32 Index = j * Apron + i;
+				Dirs[Index] = Quadtree.GetNodeDirection(Node, (i - 1) * Step, (j - 1) * Step);
+				DirX[Index] = static_cast<float>(Dirs[Index].X);
+				DirY[Index] = static_cast<float>(Dirs[Index].Y);
+				DirZ[Index] = static_cast<float>(Dirs[Index].Z);
+			}
+		}
+		Generator.SampleHeights(DirX, DirY, DirZ, Heights);
+
+		auto ApronPosition = [&](int32 Index) { return Dirs[Index] * (R + Heights[Index]) - Origin; };
+
+		TSharedPtr<FDynamicMesh3> Mesh = MakeShared<FDynamicMesh3>();
+		Mesh->EnableVertexNormals(FVector3f::UnitZ());
+		for (int32 j = 0; j < Res; ++j)
+		{
+			for (int32 i = 0; i < Res; ++i)
+			{
+				const int32 A = (j + 1) * Apron + (i + 1);
+				// Face axes satisfy AxisA x AxisB = outward, so dP/dU x dP/dV points away from the planet.
+				const FVector TangentU = ApronPosition(A + 1) - ApronPosition(A - 1);
+				const FVector TangentV = ApronPosition(A + Apron) - ApronPosition(A - Apron);
+				const int32 Vertex = Mesh->AppendVertex(ApronPosition(A));
+				Mesh->SetVertexNormal(Vertex, FVector3f((TangentU ^ TangentV).GetSafeNormal()));
+			}
+		}
+
+		// Front faces outward: (C - A) x (B - A) along the normal (UE winding).
+		for (int32 j = 0; j < Res - 1; ++j)
+		{
+			for (int32 i = 0; i < Res - 1; ++i)
+			{
+				const int32 V00 = j * Res + i;
+				const int32 V10 = V00 + 1;
+				const int32 V01 = V00 + Res;
+				const int32 V11 = V01 + 1;
+				Mesh->AppendTriangle(V00, V11, V10);
+				Mesh->AppendTriangle(V00, V01, V11);
+			}
+		}
+
+		// Skirt: border ring walked once around, each vertex dropped toward the center. Two-sided, so
+		// the walking direction doesn't matter.
+		const double SkirtDepth = Quadtree.GetNodeEdgeLength(Node.Depth) * SkirtDepthFraction;
+		if (SkirtDepth > 0.0)
+		{
+			TArray<int32> Border;
+			for (int32 i = 0; i < Res - 1; ++i) Border.Add(i);
+			for (int32 j = 0; j < Res - 1; ++j) Border.Add(j * Res + Res - 1);
+			for (int32 i = Res - 1; i > 0; --i) Border.Add((Res - 1) * Res + i);
+			for (int32 j = Res - 1; j > 0; --j) Border.Add(j * Res);
+
+			TArray<int32> Skirt;
+			for (const int32 Top : Border)
+			{
+				const int32 Index = (Top / Res + 1) * Apron + (Top % Res + 1);
+				const int32 Vertex = Mesh->AppendVertex(ApronPosition(Index) - Dirs[Index] * SkirtDepth);
+				Mesh->SetVertexNormal(Vertex, Mesh->GetVertexNormal(Top));
+				Skirt.Add(Vertex);
+			}
+			for (int32 k = 0; k < Border.Num(); ++k)
+			{
+				const int32 Next = (k + 1) % Border.Num();
+				Mesh->AppendTriangle(Border[k], Border[Next], Skirt[Next]);
+				Mesh->AppendTriangle(Border[k], Skirt[Next], Skirt[k]);
+				Mesh->AppendTriangle(Border[k], Skirt[Next], Border[Next]);
+				Mesh->AppendTriangle(Border[k], Skirt[k], Skirt[Next]);
+			}
+		}
+		return Mesh;
+	}
+}
+
+APlanetLODMesh::APlanetLODMesh()
+{
+	PrimaryActorTick.bCanEverTick = true;
+	RootComponent = CreateDefaultSubobject<USceneComponent>(TEXT("Root"));
+}
+
+void APlanetLODMesh::Initialize(const FPlanetLODSettings& InLODSettings, const FPlanetTerrainSettings& InTerrainSettings, double InPlanetRadius, UMaterialInterface* InMaterial)
+{
+	for (const TPair<FPlanetQuadNodeId, FLODChunk>& Pair : Chunks)
+	{
+		if (Pair.Value.Component)
+		{
+			Pair.Value.Component->SetVisibility(false);
+			Pair.Value.Component->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+			FreeComponents.Add(Pair.Value.Component);
+		}
+	}
+	Chunks.Reset();
+	// Tasks already in flight finish on their own; their results are simply never collected.
+	PendingChunks.Reset();
+	DesiredLeaves.Reset();
+	WantedNodes.Reset();
+	bCoverageComplete = false;
+	NumVisibleChunks = 0;
+	NumFallbackLeaves = 0;
+
+	LODSettings = InLODSettings;
+	LODSettings.ChunkResolution = FMath::Clamp(LODSettings.ChunkResolution, 3, 129);
+	TerrainSettings = InTerrainSettings;
+	Quadtree = FPlanetQuadtree(InPlanetRadius, LODSettings.MaxDepth, LODSettings.SplitDistanceFactor);
+	ChunkMaterial = InMaterial;
+}
+
+void APlanetLODMesh::Tick(float DeltaSeconds)
+{
+	QUICK_SCOPE_CYCLE_COUNTER(STAT_PlanetLODMesh_Tick);
+	Super::Tick(DeltaSeconds);
+
+	FVector Viewer;
+	if (!GetViewerLocation(Viewer)) return;
+
+	// Upload first so chunks finished this frame can already replace their stand-ins.
+	UploadCompletedChunks(LODSettings.MaxChunkUploadsPerTick);
+	UpdateLOD(Viewer);
+}
+
+bool APlanetLODMesh::GetViewerLocation(FVector& OutLocation) const
+{
+	APlayerController* PC = GetWorld() ? GetWorld()->GetFirstPlayerController() : nullptr;
+	if (!PC) return false;
+	if (PC->PlayerCameraManager)
+	{
+		OutLocation = PC->PlayerCameraManager->GetCameraLocation();
+		return true;
+	}
+	if (const APawn* Pawn = PC->GetPawn())
+	{
+		OutLocation = Pawn->GetActorLocation();
+		return true;
+	}
+	return false;
+}
+
+void APlanetLODMesh::UpdateLOD(const FVector& ViewerLocation)
+{
+	QUICK_SCOPE_CYCLE_COUNTER(STAT_PlanetLODMesh_UpdateLOD);
+
+	Quadtree.SelectLeaves(ViewerLocation - GetActorLocation(), DesiredLeaves);
+	WantedNodes.Reset();
+	WantedNodes.Append(DesiredLeaves);
+	if (!bCoverageComplete)
+	{
+		// Until the planet is covered, the 6 face roots are the quickest cover; ask for them first.
+		for (int32 Face = 0; Face < 6; ++Face)
+		{
+			const FPlanetQuadNodeId Root(Face, 0, 0, 0);
+			WantedNodes.Add(Root);
+			RequestChunk(Root);
+		}
+	}
+
+	// Shown set: each desired leaf if uploaded; otherwise its nearest uploaded ancestor, or the
+	// uploaded descendants that covered it last frame.
+	TSet<FPlanetQuadNodeId> Shown;
+	NumFallbackLeaves = 0;
+	bool bAllCovered = true;
+	for (const FPlanetQuadNodeId& Leaf : DesiredLeaves)
+	{
+		if (Chunks.Contains(Leaf))
+		{
+			Shown.Add(Leaf);
+			continue;
+		}
+		RequestChunk(Leaf);
+		++NumFallbackLeaves;
+
+		FPlanetQuadNodeId Ancestor = Leaf;
+		bool bFoundAncestor = false;
+		while (Ancestor.Depth > 0 && !bFoundAncestor)
+		{
+			Ancestor = Ancestor.GetParent();
+			bFoundAncestor = Chunks.Contains(Ancestor);
+		}
+		if (bFoundAncestor)
+		{
+			Shown.Add(Ancestor);
+			continue;
+		}
+
+		bool bFoundDescendant = false;
+		for (const TPair<FPlanetQuadNodeId, FLODChunk>& Pair : Chunks)
+		{
+			if (Leaf.Contains(Pair.Key))
+			{
+				Shown.Add(Pair.Key);
+				bFoundDescendant = true;
+			}
+		}
+		// Before first full coverage, descendants may be a partial patch; only an ancestor counts then.
+		bAllCovered &= bFoundDescendant && bCoverageComplete;
+	}
+	// Descendants only ever stand in for a leaf they covered before, so once the sphere is covered it stays covered.
+	bCoverageComplete |= bAllCovered;
+
+	// A stand-in ancestor hides everything below it, or the two would overlap.
+	for (auto It = Shown.CreateIterator(); It; ++It)
+	{
+		FPlanetQuadNodeId Ancestor = *It;
+		while (Ancestor.Depth > 0)
+		{
+			Ancestor = Ancestor.GetParent();
+			if (Shown.Contains(Ancestor))
+			{
+				It.RemoveCurrent();
+				break;
+			}
+		}
+	}
+
+	// Uploaded leaves waiting for their siblings stay resident (hidden) under the stand-in.
+	TArray<FPlanetQuadNodeId> Unused;
+	NumVisibleChunks = 0;
+	for (TPair<FPlanetQuadNodeId, FLODChunk>& Pair : Chunks)
+	{
+		const bool bVisible = Shown.Contains(Pair.Key);
+		if (!bVisible && !WantedNodes.Contains(Pair.Key))
+		{
+			Unused.Add(Pair.Key);
+			continue;
+		}
+		if (Pair.Value.bVisible != bVisible)
+		{
+			Pair.Value.bVisible = bVisible;
+			Pair.Value.Component->SetVisibility(bVisible);
+			const bool bCollision = bVisible && Pair.Key.Depth >= LODSettings.CollisionMinDepth;
+			Pair.Value.Component->SetCollisionEnabled(bCollision ? ECollisionEnabled::QueryAndPhysics : ECollisionEnabled::NoCollision);
+		}
+		NumVisibleChunks += bVisible ? 1 : 0;
+	}
+	for (const FPlanetQuadNodeId& Node : Unused)
+	{
+		ReleaseChunk(Node);
+	}
+}
+
+void APlanetLODMesh::RequestChunk(const FPlanetQuadNodeId& Node)
+{
+	if (Chunks.Contains(Node) || PendingChunks.Contains(Node) || PendingChunks.Num() >= PlanetLODMesh::MaxPendingChunks) return;
+
+	// Captures copies only: the task never touches this actor.
+	PendingChunks.Add(Node, UE::Tasks::Launch(UE_SOURCE_LOCATION,
+		[Terrain = TerrainSettings, Tree = Quadtree, Node, Res = LODSettings.ChunkResolution, Skirt = LODSettings.SkirtDepthFraction]()
+		{
+			return PlanetLODMesh::BuildNodeMesh(Terrain, Tree, Node, Res, Skirt);
+		}));
+}
+
+int32 APlanetLODMesh::UploadCompletedChunks(int32 MaxUploads)
+{
+	QUICK_SCOPE_CYCLE_COUNTER(STAT_PlanetLODMesh_UploadChunks);
+
+	// Coarsest first: they unblock the most stand-ins.
+	TArray<FPlanetQuadNodeId, TInlineAllocator<64>> Completed;
+	for (auto It = PendingChunks.CreateIterator(); It; ++It)
+	{
+		if (!It.Value().IsCompleted()) continue;
+		if (!WantedNodes.Contains(It.Key()))
+		{
+			// No longer wanted (the viewer moved on before it finished).
+			It.RemoveCurrent();
+			continue;
+		}
+		Completed.Add(It.Key());
+	}
+	Completed.Sort([](const FPlanetQuadNodeId& A, const FPlanetQuadNodeId& B) { return A.Depth < B.Depth; });
+
+	int32 Uploaded = 0;
+	for (const FPlanetQuadNodeId& Node : Completed)
+	{
+		if (Uploaded >= MaxUploads) break;
+
+		TSharedPtr<FDynamicMesh3> Mesh = PendingChunks.FindAndRemoveChecked(Node).GetResult();
+		UDynamicMeshComponent* Chunk = AcquireChunkComponent();
+		const bool bCollision = Node.Depth >= LODSettings.CollisionMinDepth;
+		Chunk->SetRelativeLocation(Quadtree.GetNodeCenterDirection(Node) * Quadtree.GetPlanetRadius());
+		// Collision is switched on with visibility; only the cooked data is prepared here.
+		Chunk->SetComplexAsSimpleCollisionEnabled(bCollision, false);
+		if (Mesh)
+		{
+			Chunk->SetMesh(MoveTemp(*Mesh));
+		}
+		if (bCollision)
+		{
+			Chunk->UpdateCollision(false);
+		}
+		// Shown by the next UpdateLOD, together with hiding whatever it replaces.
+		Chunks.Add(Node, FLODChunk{ Chunk, false });
+		++Uploaded;
+	}
+	return Uploaded;
+}
+
+void APlanetLODMesh::WaitForChunkTasks()
+{
+	for (TPair<FPlanetQuadNodeId, UE::Tasks::TTask<TSharedPtr<FDynamicMesh3>>>& Pair : PendingChunks)
+	{
+		Pair.Value.Wait();
+	}
+}
+
+bool APlanetLODMesh::IsChunkVisible(const FPlanetQuadNodeId& Node) const
+{
+	const FLODChunk* Chunk = Chunks.Find(Node);
+	return Chunk && Chunk->bVisible;
+}
+
+UDynamicMeshComponent* APlanetLODMesh::AcquireChunkComponent()
+{
+	if (FreeComponents.Num() > 0)
+	{
+		return FreeComponents.Pop(EAllowShrinking::No);
+	}
+
+	UDynamicMeshComponent* Chunk = NewObject<UDynamicMeshComponent>(this);
+	Chunk->SetupAttachment(RootComponent);
+	Chunk->SetCollisionProfileName(UCollisionProfile::BlockAll_ProfileName);
+	Chunk->bUseAsyncCooking = true;
+	Chunk->SetVisibility(false);
+	if (ChunkMaterial)
+	{
+		Chunk->SetMaterial(0, ChunkMaterial);
+	}
+	Chunk->RegisterComponent();
+	AllComponents.Add(Chunk);
+	return Chunk;
+}
+
+void APlanetLODMesh::ReleaseChunk(const FPlanetQuadNodeId& Node)
+{
+	FLODChunk Chunk;
+	if (!Chunks.RemoveAndCopyValue(Node, Chunk) || !Chunk.Component) return;
+
+	Chunk.Component->SetVisibility(false);
+	Chunk.Component->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+	FreeComponents.Add(Chunk.Component);
+}
@@ -0,0 +1,129 @@
+// Copyright Federation Game. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameFramework/Actor.h"
+#include "Planet/PlanetQuadtree.h"
+#include "Planet/PlanetTerrainGenerator.h"
+#include "Tasks/Task.h"
+#include "PlanetLODMesh.generated.h"
+
+class UDynamicMeshComponent;
+class UMaterialInterface;
+
+namespace UE::Geometry { class FDynamicMesh3; }
+
+/** Tuning for the continuous-LOD planet mesh (UnifiedSeamless transition mode). */
+USTRUCT(BlueprintType)
+struct FPlanetLODSettings
+{
+	GENERATED_BODY()
+
+	/** Deepest quadtree level; node edge at this depth is PlanetRadius * (pi / 2) / 2^MaxDepth. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "LOD", meta = (ClampMin = "0", ClampMax = "16"))
+	int32 MaxDepth = 10;
+
+	/** A node splits while the camera is within this many node edge lengths of it. Higher = more detail. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "LOD", meta = (ClampMin = "0.5", ClampMax = "8.0"))
+	float SplitDistanceFactor = 2.f;
+
+	/** Vertices along each node chunk edge. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "LOD", meta = (ClampMin = "3", ClampMax = "129"))
+	int32 ChunkResolution = 17;
+
+	/** Chunk meshes handed to components per frame (the game-thread cost of refinement). */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "LOD", meta = (ClampMin = "1"))
+	int32 MaxChunkUploadsPerTick = 4;
+
+	/** Chunks at this depth or deeper get collision, so the player can land on the LOD surface. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "LOD", meta = (ClampMin = "0", ClampMax = "16"))
+	int32 CollisionMinDepth = 6;
+
+	/** Skirt hanging below each chunk border, as a fraction of its edge; hides cracks between LOD levels. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "LOD", meta = (ClampMin = "0.0", ClampMax = "0.5"))
+	float SkirtDepthFraction = 0.05f;
+};
+
+/**
+ * Planet drawn as a quadtree per cube face (FPlanetQuadtree) whose leaves refine with camera
+ * distance. Each node's chunk (FPlanetTerrainGenerator heights on the sphere) is built on a
+ * UE::Tasks worker and handed to a UDynamicMeshComponent on the game thread, at most
+ * MaxChunkUploadsPerTick per frame. A node is only replaced once its replacement is uploaded, so
+ * refinement never opens a hole; until then the coarser node stays up.
+ *
+ * Spawned by UPlanetSurfaceStreamer in UnifiedSeamless mode. The actor sits at the planet center
+ * with identity rotation and scale; chunk geometry is in UU relative to each chunk's component.
+ */
+UCLASS(NotPlaceable)
+class FEDERATION_API APlanetLODMesh : public AActor
+{
+	GENERATED_BODY()
+
+public:
+	APlanetLODMesh();
+
+	virtual void Tick(float DeltaSeconds) override;
+
+	void Initialize(const FPlanetLODSettings& InLODSettings, const FPlanetTerrainSettings& InTerrainSettings, double InPlanetRadius, UMaterialInterface* InMaterial);
+
+	/** Refines for a viewer at ViewerLocation (world space): requests missing chunks and picks what to show. */
+	void UpdateLOD(const FVector& ViewerLocation);
+
+	/** Hands up to MaxUploads finished chunks to components. Returns how many were uploaded. */
+	int32 UploadCompletedChunks(int32 MaxUploads);
+
+	/** Blocks until every launched chunk task has finished (tests and benchmarks only). */
+	void WaitForChunkTasks();
+
+	/** True once the shown chunks cover the whole planet; stays true (nodes are only swapped once covered). */
+	bool IsBaseReady() const { return bCoverageComplete; }
+
+	/** True if every currently desired leaf is shown (no coarser stand-ins). */
+	bool IsFullyRefined() const { return NumFallbackLeaves == 0 && DesiredLeaves.Num() > 0; }
+
+	const FPlanetQuadtree& GetQuadtree() const { return Quadtree; }
+	const TArray<FPlanetQuadNodeId>& GetDesiredLeaves() const { return DesiredLeaves; }
+	int32 GetNumResidentChunks() const { return Chunks.Num(); }
+	int32 GetNumVisibleChunks() const { return NumVisibleChunks; }
+	int32 GetNumPendingChunks() const { return PendingChunks.Num(); }
+	bool IsChunkVisible(const FPlanetQuadNodeId& Node) const;
+
+	/** Viewer Tick refines for: the first local player's camera, else their pawn. */
+	bool GetViewerLocation(FVector& OutLocation) const;
+
+private:
+	struct FLODChunk
+	{
+		TObjectPtr<UDynamicMeshComponent> Component;
+		bool bVisible = false;
+	};
+
+	void RequestChunk(const FPlanetQuadNodeId& Node);
+	UDynamicMeshComponent* AcquireChunkComponent();
+	void ReleaseChunk(const FPlanetQuadNodeId& Node);
+
+	FPlanetLODSettings LODSettings;
+	FPlanetTerrainSettings TerrainSettings;
+	FPlanetQuadtree Quadtree = FPlanetQuadtree(1.0, 0, 2.0);
+
+	/** Resident chunks (uploaded, shown or not). Components are also held in AllComponents for GC. */
+	TMap<FPlanetQuadNodeId, FLODChunk> Chunks;
+	TMap<FPlanetQuadNodeId, UE::Tasks::TTask<TSharedPtr<UE::Geometry::FDynamicMesh3>>> PendingChunks;
+
+	UPROPERTY()
+	TArray<TObjectPtr<UDynamicMeshComponent>> AllComponents;
+
+	/** Hidden components ready for reuse by another node. */
+	TArray<TObjectPtr<UDynamicMeshComponent>> FreeComponents;
+
+	UPROPERTY()
+	TObjectPtr<UMaterialInterface> ChunkMaterial;
+
+	TArray<FPlanetQuadNodeId> DesiredLeaves;
+	/** Desired leaves plus face roots requested as stand-ins; finished chunks for anything else are dropped. */
+	TSet<FPlanetQuadNodeId> WantedNodes;
+	bool bCoverageComplete = false;
+	int32 NumVisibleChunks = 0;
+	int32 NumFallbackLeaves = 0;
+};
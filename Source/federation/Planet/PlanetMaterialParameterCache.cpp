@@ -0,0 +1,51 @@
+// Copyright Federation Game. All Rights Reserved.
+
+#include "Planet/PlanetMaterialParameterCache.h"
+#include "Materials/MaterialInstanceDynamic.h"
+#include "Materials/MaterialParameterCollectionInstance.h"
+
+bool FPlanetMaterialParameterCache::ShouldPush(const UObject* Target, FName Name, const FLinearColor& Value)
+{
+	const TPair<FObjectKey, FName> Key(FObjectKey(Target), Name);
+	auto Same = [this](float A, float B)
+	{
+		return FMath::Abs(A - B) <= Tolerance * FMath::Max3(1.f, FMath::Abs(A), FMath::Abs(B));
+	};
+	const FLinearColor* Last = Pushed.Find(Key);
+	if (Last && Same(Last->R, Value.R) && Same(Last->G, Value.G) && Same(Last->B, Value.B) && Same(Last->A, Value.A))
+	{
+		++NumSkipped;
+		return false;
+	}
+	Pushed.Add(Key, Value);
+	++NumPushes;
+	return true;
+}
+
+bool FPlanetMaterialParameterCache::SetScalar(UMaterialInstanceDynamic* Target, FName Name, float Value)
+{
+	if (!Target || !ShouldPush(Target, Name, FLinearColor(Value, 0.f, 0.f, 0.f))) return false;
+	Target->SetScalarParameterValue(Name, Value);
+	return true;
+}
+
+bool FPlanetMaterialParameterCache::SetVector(UMaterialInstanceDynamic* Target, FName Name, const FLinearColor& Value)
+{
+	if (!Target || !ShouldPush(Target, Name, Value)) return false;
+	Target->SetVectorParameterValue(Name, Value);
+	return true;
+}
+
+bool FPlanetMaterialParameterCache::SetScalar(UMaterialParameterCollectionInstance* Target, FName Name, float Value)
+{
+	if (!Target || !ShouldPush(Target, Name, FLinearColor(Value, 0.f, 0.f, 0.f))) return false;
+	Target->SetScalarParameterValue(Name, Value);
+	return true;
+}
+
+bool FPlanetMaterialParameterCache::SetVector(UMaterialParameterCollectionInstance* Target, FName Name, const FLinearColor& Value)
+{
+	if (!Target || !ShouldPush(Target, Name, Value)) return false;
+	Target->SetVectorParameterValue(Name, Value);
+	return true;
+}
@@ -0,0 +1,44 @@
+// Copyright Federation Game. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/ObjectKey.h"
+
+class UMaterialInstanceDynamic;
+class UMaterialParameterCollectionInstance;
+
+/**
+ * Remembers the last value pushed for each (material, parameter) and skips pushes that wouldn't
+ * change it. Every Set on a MID or collection instance costs a render-thread update, even for the
+ * same value, so per-tick callers should go through this rather than setting parameters directly.
+ *
+ * Values count as unchanged within Tolerance relative to their magnitude (absolute below 1), which
+ * suits both 0..1 fade alphas and world-space reveal positions. Targets are held by key only.
+ */
+class FEDERATION_API FPlanetMaterialParameterCache
+{
+public:
+	explicit FPlanetMaterialParameterCache(float InTolerance = 1.e-5f) : Tolerance(InTolerance) {}
+
+	/** Each returns true if the value was pushed, false if skipped (unchanged or no target). */
+	bool SetScalar(UMaterialInstanceDynamic* Target, FName Name, float Value);
+	bool SetVector(UMaterialInstanceDynamic* Target, FName Name, const FLinearColor& Value);
+	bool SetScalar(UMaterialParameterCollectionInstance* Target, FName Name, float Value);
+	bool SetVector(UMaterialParameterCollectionInstance* Target, FName Name, const FLinearColor& Value);
+
+	/** Forgets pushed values so the next Set always pushes (e.g. the material was replaced). */
+	void Invalidate() { Pushed.Reset(); }
+
+	int32 GetNumPushes() const { return NumPushes; }
+	int32 GetNumSkipped() const { return NumSkipped; }
+
+private:
+	/** Records Value for (Target, Name); false if within tolerance of the last push. */
+	bool ShouldPush(const UObject* Target, FName Name, const FLinearColor& Value);
+
+	TMap<TPair<FObjectKey, FName>, FLinearColor> Pushed;
+	float Tolerance = 1.e-5f;
+	int32 NumPushes = 0;
+	int32 NumSkipped = 0;
+};
@@ -0,0 +1,72 @@
+// Copyright Federation Game. All Rights Reserved.
+
+#include "Planet/PlanetQuadtree.h"
+#include "Planet/PlanetCellGrid.h"
+
+namespace PlanetQuadtree
+{
+	/** 2^16 nodes per face edge is the finest FPlanetCellGrid resolves. */
+	constexpr int32 MaxSupportedDepth = 16;
+
+	/** Node bounding radius as a fraction of its edge length (half diagonal, plus a little for curvature). */
+	constexpr double NodeBoundsFraction = 0.75;
+}
+
+FPlanetQuadtree::FPlanetQuadtree(double InPlanetRadius, int32 InMaxDepth, double InSplitDistanceFactor)
+	: PlanetRadius(FMath::Max(1.0, InPlanetRadius))
+	, MaxDepth(FMath::Clamp(InMaxDepth, 0, PlanetQuadtree::MaxSupportedDepth))
+	, SplitDistanceFactor(FMath::Max(0.0, InSplitDistanceFactor))
+{
+}
+
+bool FPlanetQuadtree::IsValidNode(const FPlanetQuadNodeId& Node) const
+{
+	if (Node.Face < 0 || Node.Face >= 6 || Node.Depth < 0 || Node.Depth > MaxDepth) return false;
+	const int32 NodesPerEdge = 1 << Node.Depth;
+	return Node.X >= 0 && Node.X < NodesPerEdge && Node.Y >= 0 && Node.Y < NodesPerEdge;
+}
+
+FVector FPlanetQuadtree::GetNodeDirection(const FPlanetQuadNodeId& Node, double U, double V) const
+{
+	const double Scale = 2.0 / static_cast<double>(1 << Node.Depth);
+	return FPlanetCellGrid::DirectionFromFaceCoords(Node.Face, (Node.X + U) * Scale - 1.0, (Node.Y + V) * Scale - 1.0);
+}
+
+bool FPlanetQuadtree::ShouldSplit(const FPlanetQuadNodeId& Node, const FVector& ViewerOffset) const
+{
+	if (Node.Depth >= MaxDepth) return false;
+
+	const double Edge = GetNodeEdgeLength(Node.Depth);
+	const double DistToBounds = FVector::Dist(ViewerOffset, GetNodeCenterDirection(Node) * PlanetRadius) - Edge * PlanetQuadtree::NodeBoundsFraction;
+	return DistToBounds < Edge * SplitDistanceFactor;
+}
+
+void FPlanetQuadtree::SelectLeaves(const FVector& ViewerOffset, TArray<FPlanetQuadNodeId>& OutLeaves) const
+{
+	QUICK_SCOPE_CYCLE_COUNTER(STAT_PlanetQuadtree_SelectLeaves);
+	OutLeaves.Reset();
+	for (int32 Face = 0; Face < 6; ++Face)
+	{
+		SelectLeavesRecursive(FPlanetQuadNodeId(Face, 0, 0, 0), ViewerOffset, OutLeaves);
+	}
+}
+
+void FPlanetQuadtree::SelectLeavesRecursive(const FPlanetQuadNodeId& Node, const FVector& ViewerOffset, TArray<FPlanetQuadNodeId>& OutLeaves) const
+{
+	if (!ShouldSplit(Node, ViewerOffset))
+	{
+		OutLeaves.Add(Node);
+		return;
+	}
+	for (int32 Child = 0; Child < 4; ++Child)
+	{
+		SelectLeavesRecursive(Node.GetChild(Child), ViewerOffset, OutLeaves);
+	}
+}
+
+FPlanetQuadNodeId FPlanetQuadtree::NodeFromDirection(const FVector& Direction, int32 Depth) const
+{
+	const int32 SafeDepth = FMath::Clamp(Depth, 0, MaxDepth);
+	const FPlanetCellId Cell = FPlanetCellGrid(1 << SafeDepth).CellFromDirection(Direction);
+	return FPlanetQuadNodeId(Cell.Face, SafeDepth, Cell.X, Cell.Y);
+}
@@ -0,0 +1,86 @@
+// Copyright Federation Game. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * One node of a FPlanetQuadtree: cube face (same numbering as FPlanetCellGrid), depth, and column/row
+ * among the 2^Depth x 2^Depth nodes of that face at this depth. Node (F, D, X, Y) covers exactly the
+ * cell (F, X, Y) of a FPlanetCellGrid with 2^D cells per face edge.
+ */
+struct FPlanetQuadNodeId
+{
+	int32 Face = 0;
+	int32 Depth = 0;
+	int32 X = 0;
+	int32 Y = 0;
+
+	FPlanetQuadNodeId() = default;
+	FPlanetQuadNodeId(int32 InFace, int32 InDepth, int32 InX, int32 InY) : Face(InFace), Depth(InDepth), X(InX), Y(InY) {}
+
+	/** Child 0..3 (bit 0 = +X half, bit 1 = +Y half). */
+	FPlanetQuadNodeId GetChild(int32 Index) const { return FPlanetQuadNodeId(Face, Depth + 1, X * 2 + (Index & 1), Y * 2 + (Index >> 1)); }
+	FPlanetQuadNodeId GetParent() const { return Depth > 0 ? FPlanetQuadNodeId(Face, Depth - 1, X >> 1, Y >> 1) : *this; }
+
+	/** True if Other is this node or lies inside it. */
+	bool Contains(const FPlanetQuadNodeId& Other) const
+	{
+		if (Other.Face != Face || Other.Depth < Depth) return false;
+		const int32 Shift = Other.Depth - Depth;
+		return (Other.X >> Shift) == X && (Other.Y >> Shift) == Y;
+	}
+
+	bool operator==(const FPlanetQuadNodeId& Other) const { return Face == Other.Face && Depth == Other.Depth && X == Other.X && Y == Other.Y; }
+	bool operator!=(const FPlanetQuadNodeId& Other) const { return !(*this == Other); }
+
+	friend uint32 GetTypeHash(const FPlanetQuadNodeId& Node)
+	{
+		return HashCombine(HashCombine(GetTypeHash(Node.Face), GetTypeHash(Node.Depth)), HashCombine(GetTypeHash(Node.X), GetTypeHash(Node.Y)));
+	}
+};
+
+/**
+ * Quadtree per cube face for continuous planet LOD. Nodes split while the viewer is closer than
+ * SplitDistanceFactor node edge lengths to them, so detail follows camera distance smoothly from
+ * orbit (6 root nodes) down to MaxDepth at ground level.
+ *
+ * Pure math on the reference sphere, like FPlanetCellGrid: the viewer is given relative to the
+ * planet center, and node geometry is built by the caller from GetNodeDirection.
+ */
+class FEDERATION_API FPlanetQuadtree
+{
+public:
+	FPlanetQuadtree(double InPlanetRadius, int32 InMaxDepth, double InSplitDistanceFactor);
+
+	int32 GetMaxDepth() const { return MaxDepth; }
+	double GetPlanetRadius() const { return PlanetRadius; }
+
+	bool IsValidNode(const FPlanetQuadNodeId& Node) const;
+
+	/** Arc spanned by one node edge, in radians. */
+	static double GetNodeAngle(int32 Depth) { return UE_DOUBLE_HALF_PI / static_cast<double>(1 << Depth); }
+
+	/** Node edge length along the reference sphere, in UU. */
+	double GetNodeEdgeLength(int32 Depth) const { return PlanetRadius * GetNodeAngle(Depth); }
+
+	/** Unit direction at U, V in [0, 1] across Node (U along the face's A axis, V along B). */
+	FVector GetNodeDirection(const FPlanetQuadNodeId& Node, double U, double V) const;
+	FVector GetNodeCenterDirection(const FPlanetQuadNodeId& Node) const { return GetNodeDirection(Node, 0.5, 0.5); }
+
+	/** True if a viewer at ViewerOffset (from the planet center) is close enough for Node to split. */
+	bool ShouldSplit(const FPlanetQuadNodeId& Node, const FVector& ViewerOffset) const;
+
+	/** Leaves of the tree refined for a viewer at ViewerOffset; together they cover the sphere exactly once. */
+	void SelectLeaves(const FVector& ViewerOffset, TArray<FPlanetQuadNodeId>& OutLeaves) const;
+
+	/** Node at Depth containing Direction. */
+	FPlanetQuadNodeId NodeFromDirection(const FVector& Direction, int32 Depth) const;
+
+private:
+	void SelectLeavesRecursive(const FPlanetQuadNodeId& Node, const FVector& ViewerOffset, TArray<FPlanetQuadNodeId>& OutLeaves) const;
+
+	double PlanetRadius = 1.0;
+	int32 MaxDepth = 12;
+	double SplitDistanceFactor = 2.0;
+};
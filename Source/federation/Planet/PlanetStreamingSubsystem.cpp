@@ -0,0 +1,588 @@
+// Copyright Federation Game. All Rights Reserved.
+
+#include "Planet/PlanetStreamingSubsystem.h"
+#include "Planet/PlanetSurfaceStreamer.h"
+#include "Planet/GravitySourceSubsystem.h"
+#include "Planet/PlanetGravityComponent.h"
+#include "Core/FederationGameState.h"
+#include "Core/FloatingOriginSubsystem.h"
+#include "Engine/LevelStreamingDynamic.h"
+#include "Engine/World.h"
+#include "Engine/Level.h"
+#include "LevelUtils.h"
+#include "GameFramework/Pawn.h"
+#include "Kismet/GameplayStatics.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+
+namespace PlanetStreamingSubsystem
+{
+	bool IsSameLevelTransform(const FTransform& A, const FTransform& B)
+	{
+		return A.GetLocation().Equals(B.GetLocation(), 1.0)
+			&& A.GetRotation().Equals(B.GetRotation(), 1.e-4)
+			&& A.GetScale3D().Equals(B.GetScale3D(), 1.e-4);
+	}
+
+	/** Re-places a loaded, non-partitioned level instance at NewTransform (partitioned levels place cells from LevelTransform at load). */
+	bool TryMoveLoadedLevel(ULevelStreamingDynamic* Level, const FTransform& NewTransform)
+	{
+		ULevel* Loaded = Level ? Level->GetLoadedLevel() : nullptr;
+		if (!Loaded || Loaded->IsPartitioned()) return false;
+
+		FLevelUtils::ApplyLevelTransform(Loaded, Level->LevelTransform.Inverse() * NewTransform, false);
+		Level->LevelTransform = NewTransform;
+		return true;
+	}
+}
+
+static FAutoConsoleCommand CmdSurfacePoolStats(
+	TEXT("Fed.Streaming.PoolStats"),
+	TEXT("Log surface level pool hit rate, evictions and reload time saved for every world."),
+	FConsoleCommandDelegate::CreateLambda([]()
+	{
+		if (!GEngine) return;
+		for (const FWorldContext& Context : GEngine->GetWorldContexts())
+		{
+			UWorld* World = Context.World();
+			const UPlanetStreamingSubsystem* Sub = World ? World->GetSubsystem<UPlanetStreamingSubsystem>() : nullptr;
+			if (!Sub) continue;
+			const FSurfaceLevelPoolStats& Stats = Sub->GetSurfacePoolStats();
+			UE_LOG(LogTemp, Log, TEXT("%s: surface pool %d/%d pooled, hits %d, misses %d (hit rate %.0f%%), evictions %d, reload time saved %.1fs"),
+				*World->GetName(), Sub->GetNumPooledSurfaceLevels(), Sub->MaxPooledSurfaceLevels, Stats.Hits, Stats.Misses,
+				Stats.GetHitRate() * 100.f, Stats.Evictions, Stats.ReloadSecondsSaved);
+		}
+	})
+);
+
+static FAutoConsoleCommand CmdStreamingTelemetry(
+	TEXT("Fed.Streaming.Telemetry"),
+	TEXT("Log surface transition timing histograms (load, reveal wait, handoff frame, unload, warm-up) for every world."),
+	FConsoleCommandDelegate::CreateLambda([]()
+	{
+		if (!GEngine) return;
+		for (const FWorldContext& Context : GEngine->GetWorldContexts())
+		{
+			UWorld* World = Context.World();
+			const UPlanetStreamingSubsystem* Sub = World ? World->GetSubsystem<UPlanetStreamingSubsystem>() : nullptr;
+			if (!Sub) continue;
+			for (int32 i = 0; i < static_cast<int32>(EPlanetStreamingMetric::Count); ++i)
+			{
+				UE_LOG(LogTemp, Log, TEXT("%s: %s"), *World->GetName(), *Sub->GetTelemetry().GetSummary(static_cast<EPlanetStreamingMetric>(i)));
+			}
+			const FSurfaceLoadSchedulerStats& Scheduler = Sub->GetLoadSchedulerStats();
+			UE_LOG(LogTemp, Log, TEXT("%s: load scheduler %d deferrals, %d demotions, %d cancellations"),
+				*World->GetName(), Scheduler.Deferrals, Scheduler.Demotions, Scheduler.Cancellations);
+		}
+	})
+);
+
+static FAutoConsoleCommand CmdStreamingTelemetryCsv(
+	TEXT("Fed.Streaming.TelemetryCsv"),
+	TEXT("Write surface transition histograms as CSV. Optional arg: file path (default Saved/Profiling/StreamingTelemetry_<World>.csv)."),
+	FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString>& Args)
+	{
+		if (!GEngine) return;
+		for (const FWorldContext& Context : GEngine->GetWorldContexts())
+		{
+			UWorld* World = Context.World();
+			const UPlanetStreamingSubsystem* Sub = World ? World->GetSubsystem<UPlanetStreamingSubsystem>() : nullptr;
+			if (!Sub || Sub->GetTelemetry().IsEmpty()) continue;
+			const FString Path = Args.Num() > 0 ? Args[0] : FPaths::ProfilingDir() / FString::Printf(TEXT("StreamingTelemetry_%s.csv"), *World->GetName());
+			if (FFileHelper::SaveStringToFile(Sub->GetTelemetry().ToCsv(), *Path))
+			{
+				UE_LOG(LogTemp, Log, TEXT("%s: streaming telemetry written to %s"), *World->GetName(), *FPaths::ConvertRelativePathToFull(Path));
+			}
+			else
+			{
+				UE_LOG(LogTemp, Warning, TEXT("%s: could not write streaming telemetry to %s"), *World->GetName(), *Path);
+			}
+		}
+	})
+);
+
+static FAutoConsoleCommand CmdStreamingTelemetryReset(
+	TEXT("Fed.Streaming.TelemetryReset"),
+	TEXT("Clear the surface transition histograms for every world."),
+	FConsoleCommandDelegate::CreateLambda([]()
+	{
+		if (!GEngine) return;
+		for (const FWorldContext& Context : GEngine->GetWorldContexts())
+		{
+			UWorld* World = Context.World();
+			if (UPlanetStreamingSubsystem* Sub = World ? World->GetSubsystem<UPlanetStreamingSubsystem>() : nullptr)
+			{
+				Sub->GetTelemetry().Reset();
+			}
+		}
+	})
+);
+
+void UPlanetStreamingSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	UWorld* World = GetWorld();
+	if (!World || !World->IsGameWorld()) return;
+
+	UpdateStreamers(UGameplayStatics::GetPlayerPawn(World, 0));
+}
+
+TStatId UPlanetStreamingSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UPlanetStreamingSubsystem, STATGROUP_Tickables);
+}
+
+void UPlanetStreamingSubsystem::Deinitialize()
+{
+	SurfacePool.Reset();
+	Super::Deinitialize();
+}
+
+void UPlanetStreamingSubsystem::RegisterStreamer(UPlanetSurfaceStreamer* Streamer)
+{
+	if (!Streamer) return;
+
+	for (const FStreamerEntry& Existing : Streamers)
+	{
+		if (Existing.Streamer.Get() == Streamer) return;
+	}
+	FStreamerEntry& Entry = Streamers.AddDefaulted_GetRef();
+	Entry.Streamer = Streamer;
+}
+
+void UPlanetStreamingSubsystem::UnregisterStreamer(UPlanetSurfaceStreamer* Streamer)
+{
+	Streamers.RemoveAll([Streamer](const FStreamerEntry& Entry)
+	{
+		return !Entry.Streamer.IsValid() || Entry.Streamer.Get() == Streamer;
+	});
+}
+
+int32 UPlanetStreamingSubsystem::GetNumStreamers() const
+{
+	int32 Count = 0;
+	for (const FStreamerEntry& Entry : Streamers)
+	{
+		if (Entry.Streamer.IsValid()) ++Count;
+	}
+	return Count;
+}
+
+void UPlanetStreamingSubsystem::UpdateStreamers(const APawn* PlayerPawn)
+{
+	QUICK_SCOPE_CYCLE_COUNTER(STAT_PlanetStreamingSubsystem_UpdateStreamers);
+
+	const FVector PlayerLocation = PlayerPawn ? PlayerPawn->GetActorLocation() : FVector::ZeroVector;
+	bool bAnyTransitioning = false;
+
+	// Pass 1: distances and candidates. Non-Idle streamers are awake regardless of rank.
+	CandidateScratch.Reset();
+	for (int32 i = 0; i < Streamers.Num(); ++i)
+	{
+		FStreamerEntry& Entry = Streamers[i];
+		UPlanetSurfaceStreamer* Streamer = Entry.Streamer.Get();
+		const AActor* Owner = Streamer ? Streamer->GetOwner() : nullptr;
+		if (!Owner) continue;
+
+		// Bounds only change with scale for planet actors; measure once, not every frame.
+		const FVector Scale = Owner->GetActorScale3D();
+		if (!Entry.bRadiusValid || !Scale.Equals(Entry.CachedScale))
+		{
+			Entry.ActivationRadius = Streamer->GetMaxStreamingRadius() * FMath::Max(1.f, ActivationMargin);
+			Entry.CachedScale = Scale;
+			Entry.bRadiusValid = true;
+		}
+		Entry.DistanceSq = PlayerPawn ? FVector::DistSquared(Streamer->GetPlanetCenter(), PlayerLocation) : 0.0;
+
+		if (Streamer->GetStreamingState() != EPlanetStreamingState::Idle)
+		{
+			// A predictive load waiting for the player isn't a transition yet (it leaves the HUD alone).
+			bAnyTransitioning |= !Streamer->HasPredictiveHold();
+			continue;
+		}
+		if (!PlayerPawn) continue;
+
+		if (Entry.DistanceSq <= FMath::Square(static_cast<double>(Entry.ActivationRadius)))
+		{
+			CandidateScratch.Add(i);
+		}
+	}
+
+	// Predictive loads move streamers out of Idle, so they run before the wake/sleep decision.
+	UpdatePredictiveStreaming(PlayerPawn);
+	UpdateLoadScheduler(PlayerPawn);
+
+	// Pass 2: nearest candidates first, capped.
+	CandidateScratch.Sort([this](int32 A, int32 B)
+	{
+		return Streamers[A].DistanceSq < Streamers[B].DistanceSq;
+	});
+	if (CandidateScratch.Num() > MaxActiveStreamers)
+	{
+		CandidateScratch.SetNum(FMath::Max(0, MaxActiveStreamers));
+	}
+
+	// Pass 3: wake candidates and transitioning streamers, put everything else to sleep.
+	NumActiveStreamers = 0;
+	for (int32 i = 0; i < Streamers.Num(); ++i)
+	{
+		UPlanetSurfaceStreamer* Streamer = Streamers[i].Streamer.Get();
+		if (!Streamer) continue;
+
+		const bool bActive = Streamer->GetStreamingState() != EPlanetStreamingState::Idle
+			|| CandidateScratch.Contains(i);
+		Streamer->SetStreamingDormant(!bActive);
+		if (bActive) ++NumActiveStreamers;
+	}
+
+	// Idle streamers no longer write the HUD state; report deep space once when nothing is transitioning.
+	if (!bAnyTransitioning)
+	{
+		if (AFederationGameState* GS = GetWorld() ? GetWorld()->GetGameState<AFederationGameState>() : nullptr)
+		{
+			GS->DebugStreamingState = TEXT("Idle");
+			GS->DebugStreamingLevelName.Reset();
+		}
+	}
+}
+
+int32 UPlanetStreamingSubsystem::GetNumPredictiveLoads() const
+{
+	int32 Count = 0;
+	for (const FStreamerEntry& Entry : Streamers)
+	{
+		const UPlanetSurfaceStreamer* Streamer = Entry.Streamer.Get();
+		if (Streamer && Streamer->HasPredictiveHold()) ++Count;
+	}
+	return Count;
+}
+
+void UPlanetStreamingSubsystem::UpdatePredictiveStreaming(const APawn* PlayerPawn)
+{
+	UWorld* World = GetWorld();
+	const double Now = World ? World->GetTimeSeconds() : 0.0;
+
+	// 1. Predict which planets the player's path reaches (at their handoff radius) within the horizon.
+	PredictedArrivals.Reset();
+	if (bPredictiveStreaming && PlayerPawn && World)
+	{
+		UGravitySourceSubsystem* GravitySources = World->GetSubsystem<UGravitySourceSubsystem>();
+		const UPlanetGravityComponent* GravComp = PlayerPawn->FindComponentByClass<UPlanetGravityComponent>();
+		if (GravitySources)
+		{
+			GravitySources->RefreshSourceCache();
+		}
+		const float WorldGravity = FMath::Abs(World->GetGravityZ());
+		auto Acceleration = [GravitySources, GravComp, PlayerPawn, WorldGravity](const FVector& Point)
+		{
+			if (!GravitySources || !GravComp || !GravComp->IsActive()) return FVector::ZeroVector;
+			const FPlanetGravitySolution Solution = UPlanetGravityComponent::SolveGravity(
+				GravitySources->QueryGravityAtCached(Point, PlayerPawn), GravComp->MakeSolveParams(Point));
+			return Solution.Direction * (Solution.GravityScale * WorldGravity);
+		};
+
+		// Only planets the path could possibly reach: speed * horizon plus a gravity allowance.
+		const FVector Start = PlayerPawn->GetActorLocation();
+		const FVector Velocity = PlayerPawn->GetVelocity();
+		const double Horizon = FMath::Max(0.f, Predictor.HorizonSeconds);
+		const double Reach = Velocity.Size() * Horizon + 0.5 * Acceleration(Start).Size() * Horizon * Horizon;
+
+		PredictTargets.Reset();
+		for (int32 i = 0; i < Streamers.Num(); ++i)
+		{
+			const FStreamerEntry& Entry = Streamers[i];
+			const UPlanetSurfaceStreamer* Streamer = Entry.Streamer.Get();
+			if (!Streamer || !Entry.bRadiusValid) continue;
+			const bool bEligible = Streamer->GetStreamingState() == EPlanetStreamingState::Idle || Streamer->HasPredictiveHold();
+			if (!bEligible) continue;
+			if (FMath::Sqrt(Entry.DistanceSq) - Entry.ActivationRadius > Reach) continue;
+
+			PredictTargets.Add({ i, Streamer->GetPlanetCenter(), Streamer->GetEffectiveHandoffRadius() });
+		}
+		Predictor.PredictArrivals(Start, Velocity, PredictTargets, Acceleration, PredictedArrivals);
+	}
+	for (const FPlanetArrival& Arrival : PredictedArrivals)
+	{
+		Streamers[Arrival.Id].LastPredictedTime = Now;
+	}
+
+	// 2. Release holds the path no longer reaches; what stays held is charged against the budget.
+	int32 NumHeld = 0;
+	float HeldMemoryMB = 0.f;
+	for (FStreamerEntry& Entry : Streamers)
+	{
+		UPlanetSurfaceStreamer* Streamer = Entry.Streamer.Get();
+		if (!Streamer || !Streamer->HasPredictiveHold()) continue;
+
+		if (!bPredictiveStreaming || Now - Entry.LastPredictedTime > PredictiveHoldGraceSeconds)
+		{
+			Streamer->ReleasePredictiveHold();
+			continue;
+		}
+		++NumHeld;
+		HeldMemoryMB += Streamer->EstimatedSurfaceMemoryMB;
+	}
+
+	// 3. Start new loads soonest-arrival first while the IO and memory budgets allow.
+	LoadQueue.Reset();
+	for (const FPlanetArrival& Arrival : PredictedArrivals)
+	{
+		const UPlanetSurfaceStreamer* Streamer = Streamers[Arrival.Id].Streamer.Get();
+		if (Streamer && Streamer->GetStreamingState() == EPlanetStreamingState::Idle)
+		{
+			LoadQueue.HeapPush({ Arrival.Id, Arrival.TimeSeconds, Arrival.EntryPoint });
+		}
+	}
+	while (LoadQueue.Num() > 0 && NumHeld < MaxPredictiveLoads)
+	{
+		FPredictiveLoadRequest Request;
+		LoadQueue.HeapPop(Request, EAllowShrinking::No);
+
+		UPlanetSurfaceStreamer* Streamer = Streamers[Request.EntryIndex].Streamer.Get();
+		if (HeldMemoryMB + Streamer->EstimatedSurfaceMemoryMB > PredictiveMemoryBudgetMB) continue;
+
+		if (Streamer->BeginPredictiveStreamIn(Request.EntryPoint))
+		{
+			++NumHeld;
+			HeldMemoryMB += Streamer->EstimatedSurfaceMemoryMB;
+			UE_LOG(LogTemp, Log, TEXT("PlanetStreamingSubsystem: predictive load '%s', arrival in %.2fs"), *Streamer->SurfaceLevelPath, Request.TimeSeconds);
+		}
+	}
+}
+
+void UPlanetStreamingSubsystem::UpdateLoadScheduler(const APawn* PlayerPawn)
+{
+	QUICK_SCOPE_CYCLE_COUNTER(STAT_PlanetStreamingSubsystem_UpdateLoadScheduler);
+
+	// 1. Arrival times: the predicted path where it reaches the planet, else straight in at the current closing speed.
+	for (FStreamerEntry& Entry : Streamers)
+	{
+		Entry.ArrivalSeconds = TNumericLimits<double>::Max();
+	}
+	for (const FPlanetArrival& Arrival : PredictedArrivals)
+	{
+		Streamers[Arrival.Id].ArrivalSeconds = Arrival.TimeSeconds;
+	}
+
+	ScheduleScratch.Reset();
+	for (int32 i = 0; i < Streamers.Num(); ++i)
+	{
+		FStreamerEntry& Entry = Streamers[i];
+		UPlanetSurfaceStreamer* Streamer = Entry.Streamer.Get();
+		if (!Streamer || !Streamer->GetOwner() || Streamer->UsesSeamlessLOD()) continue;
+
+		if (Streamer->GetStreamingState() == EPlanetStreamingState::Idle)
+		{
+			// Idle planets only compete once the player is in their streaming range.
+			const bool bWantsLoad = PlayerPawn && Entry.bRadiusValid
+				&& Entry.DistanceSq <= FMath::Square(static_cast<double>(Entry.ActivationRadius))
+				&& Streamer->ShouldStreamIn(static_cast<float>(Entry.DistanceSq));
+			if (!bWantsLoad)
+			{
+				Streamer->SetLoadDeferred(false);
+				continue;
+			}
+		}
+
+		if (PlayerPawn && Entry.ArrivalSeconds == TNumericLimits<double>::Max())
+		{
+			const FVector ToPlanet = Streamer->GetPlanetCenter() - PlayerPawn->GetActorLocation();
+			const double Gap = ToPlanet.Size() - Streamer->GetEffectiveHandoffRadius();
+			const double ClosingSpeed = FVector::DotProduct(PlayerPawn->GetVelocity(), ToPlanet.GetSafeNormal());
+			if (Gap <= 0.0) Entry.ArrivalSeconds = 0.0;
+			else if (ClosingSpeed > KINDA_SMALL_NUMBER) Entry.ArrivalSeconds = Gap / ClosingSpeed;
+		}
+		ScheduleScratch.Add(i);
+	}
+
+	// 2. The planet the player is on or landing on first, then soonest arrival (nearest on ties).
+	auto IsCommitted = [](const UPlanetSurfaceStreamer* Streamer)
+	{
+		const EPlanetStreamingState State = Streamer->GetStreamingState();
+		return State == EPlanetStreamingState::OnSurface || State == EPlanetStreamingState::Unloading || Streamer->IsHandoffInProgress();
+	};
+	ScheduleScratch.Sort([this, &IsCommitted](int32 A, int32 B)
+	{
+		const FStreamerEntry& EntryA = Streamers[A];
+		const FStreamerEntry& EntryB = Streamers[B];
+		const bool bCommittedA = IsCommitted(EntryA.Streamer.Get());
+		const bool bCommittedB = IsCommitted(EntryB.Streamer.Get());
+		if (bCommittedA != bCommittedB) return bCommittedA;
+		if (EntryA.ArrivalSeconds != EntryB.ArrivalSeconds) return EntryA.ArrivalSeconds < EntryB.ArrivalSeconds;
+		return EntryA.DistanceSq < EntryB.DistanceSq;
+	});
+
+	// 3. Hand out IO slots and memory in that order; losers wait, stream demoted, or are cancelled.
+	int32 NumInFlight = 0;
+	int32 NumDemoted = 0;
+	float ResidentMB = 0.f;
+	for (const int32 Index : ScheduleScratch)
+	{
+		UPlanetSurfaceStreamer* Streamer = Streamers[Index].Streamer.Get();
+		const float MemoryMB = FMath::Max(0.f, Streamer->EstimatedSurfaceMemoryMB);
+		const bool bCommitted = IsCommitted(Streamer);
+		const bool bFitsMemory = ResidentMB + MemoryMB <= MaxResidentSurfaceMemoryMB;
+
+		if (Streamer->GetStreamingState() == EPlanetStreamingState::Idle)
+		{
+			const bool bGranted = bFitsMemory && NumInFlight < MaxConcurrentSurfaceLoads;
+			if (!bGranted && !Streamer->IsLoadDeferred()) ++SchedulerStats.Deferrals;
+			Streamer->SetLoadDeferred(!bGranted);
+			if (bGranted)
+			{
+				ResidentMB += MemoryMB;
+				++NumInFlight;
+			}
+			continue;
+		}
+
+		Streamer->SetLoadDeferred(false);
+		if (!bCommitted && !bFitsMemory && Streamer->CancelSurfaceLoad())
+		{
+			++SchedulerStats.Cancellations;
+			UE_LOG(LogTemp, Log, TEXT("PlanetStreamingSubsystem: cancelled surface load for '%s' (resident %.0f + %.0f MB > %.0f MB)"),
+				*Streamer->GetOwner()->GetName(), ResidentMB, MemoryMB, MaxResidentSurfaceMemoryMB);
+			continue;
+		}
+		ResidentMB += MemoryMB;
+
+		if (!Streamer->IsSurfaceLoadInFlight()) continue;
+		if (bCommitted || NumInFlight < MaxConcurrentSurfaceLoads)
+		{
+			// Earlier arrivals stream ahead of later ones, and all of them ahead of ordinary levels (priority 0).
+			Streamer->SetSurfaceLoadPriority(FMath::Max(1, MaxConcurrentSurfaceLoads - NumInFlight));
+			++NumInFlight;
+		}
+		else
+		{
+			if (Streamer->GetSurfaceLoadPriority() >= 0) ++SchedulerStats.Demotions;
+			Streamer->SetSurfaceLoadPriority(-1 - NumDemoted++);
+		}
+	}
+
+	// 4. Pooled instances give way to active surfaces.
+	float PooledMB = 0.f;
+	for (const FPooledSurfaceLevel& Entry : SurfacePool)
+	{
+		PooledMB += Entry.MemoryMB;
+	}
+	while (SurfacePool.Num() > 0 && ResidentMB + PooledMB > MaxResidentSurfaceMemoryMB)
+	{
+		PooledMB -= SurfacePool[0].MemoryMB;
+		EvictPooledSurfaceLevel(0);
+	}
+}
+
+const ULevelStreamingDynamic* UPlanetStreamingSubsystem::FindPooledSurfaceLevel(const FString& LevelPath, const UPlanetSurfaceStreamer* Requester) const
+{
+	for (int32 i = SurfacePool.Num() - 1; i >= 0; --i)
+	{
+		const FPooledSurfaceLevel& Entry = SurfacePool[i];
+		if (Entry.LevelPath == LevelPath && Entry.LastOwner.Get() == Requester && Entry.Level.IsValid())
+		{
+			return Entry.Level.Get();
+		}
+	}
+	return nullptr;
+}
+
+ULevelStreamingDynamic* UPlanetStreamingSubsystem::AcquirePooledSurfaceLevel(const FString& LevelPath, const FTransform& Transform, float& OutLoadSeconds)
+{
+	OutLoadSeconds = 0.f;
+	SurfacePool.RemoveAll([](const FPooledSurfaceLevel& Entry) { return !Entry.Level.IsValid(); });
+
+	// Most recent first: an instance already in place, else one that can be moved.
+	int32 Found = INDEX_NONE;
+	for (int32 i = SurfacePool.Num() - 1; i >= 0 && Found == INDEX_NONE; --i)
+	{
+		const FPooledSurfaceLevel& Entry = SurfacePool[i];
+		if (Entry.LevelPath == LevelPath && PlanetStreamingSubsystem::IsSameLevelTransform(Entry.Level->LevelTransform, Transform))
+		{
+			Found = i;
+		}
+	}
+	for (int32 i = SurfacePool.Num() - 1; i >= 0 && Found == INDEX_NONE; --i)
+	{
+		const FPooledSurfaceLevel& Entry = SurfacePool[i];
+		if (Entry.LevelPath == LevelPath && PlanetStreamingSubsystem::TryMoveLoadedLevel(Entry.Level.Get(), Transform))
+		{
+			Found = i;
+		}
+	}
+
+	if (Found == INDEX_NONE)
+	{
+		++PoolStats.Misses;
+		return nullptr;
+	}
+
+	const FPooledSurfaceLevel Entry = SurfacePool[Found];
+	SurfacePool.RemoveAt(Found);
+	++PoolStats.Hits;
+	PoolStats.ReloadSecondsSaved += Entry.LoadSeconds;
+	OutLoadSeconds = Entry.LoadSeconds;
+	return Entry.Level.Get();
+}
+
+bool UPlanetStreamingSubsystem::ReleaseSurfaceLevelToPool(ULevelStreamingDynamic* Level, const FString& LevelPath, const UPlanetSurfaceStreamer* Owner,
+	float MemoryMB, float LoadSeconds)
+{
+	if (!Level || MaxPooledSurfaceLevels <= 0 || MemoryMB > SurfacePoolMemoryBudgetMB) return false;
+
+	Level->SetShouldBeVisible(false);
+
+	FPooledSurfaceLevel& Entry = SurfacePool.AddDefaulted_GetRef();
+	Entry.Level = Level;
+	Entry.LevelPath = LevelPath;
+	Entry.LastOwner = Owner;
+	Entry.MemoryMB = MemoryMB;
+	Entry.LoadSeconds = LoadSeconds;
+
+	TrimSurfacePool();
+	return true;
+}
+
+void UPlanetStreamingSubsystem::EvictPooledSurfaceLevel(int32 PoolIndex)
+{
+	if (ULevelStreamingDynamic* Level = SurfacePool[PoolIndex].Level.Get())
+	{
+		Level->SetShouldBeLoaded(false);
+		Level->SetShouldBeVisible(false);
+		Level->SetIsRequestingUnloadAndRemoval(true);
+	}
+	SurfacePool.RemoveAt(PoolIndex);
+	++PoolStats.Evictions;
+}
+
+void UPlanetStreamingSubsystem::FlushSurfacePool()
+{
+	while (SurfacePool.Num() > 0)
+	{
+		EvictPooledSurfaceLevel(SurfacePool.Num() - 1);
+	}
+}
+
+void UPlanetStreamingSubsystem::ApplyOriginOffset(const FVector& Offset)
+{
+	for (const FPooledSurfaceLevel& Entry : SurfacePool)
+	{
+		UFloatingOriginSubsystem::ShiftLevelInstance(Entry.Level.Get(), Offset);
+	}
+}
+
+void UPlanetStreamingSubsystem::TrimSurfacePool()
+{
+	float TotalMB = 0.f;
+	for (const FPooledSurfaceLevel& Entry : SurfacePool)
+	{
+		TotalMB += Entry.MemoryMB;
+	}
+
+	while (SurfacePool.Num() > 0 && (SurfacePool.Num() > MaxPooledSurfaceLevels || TotalMB > SurfacePoolMemoryBudgetMB))
+	{
+		TotalMB -= SurfacePool[0].MemoryMB;
+		EvictPooledSurfaceLevel(0);
+	}
+}
@@ -0,0 +1,222 @@
+// Copyright Federation Game. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Planet/PlanetTrajectoryPredictor.h"
+#include "Planet/PlanetStreamingTelemetry.h"
+#include "PlanetStreamingSubsystem.generated.h"
+
+class UPlanetSurfaceStreamer;
+class ULevelStreamingDynamic;
+
+/** Counters for the surface level pool (see UPlanetStreamingSubsystem::AcquirePooledSurfaceLevel). */
+struct FSurfaceLevelPoolStats
+{
+	int32 Hits = 0;
+	int32 Misses = 0;
+	int32 Evictions = 0;
+
+	/** Sum of the original load times of every instance reused instead of reloaded. */
+	double ReloadSecondsSaved = 0.0;
+
+	float GetHitRate() const { return Hits + Misses > 0 ? static_cast<float>(Hits) / (Hits + Misses) : 0.f; }
+};
+
+/** Counters for the surface load scheduler (see UPlanetStreamingSubsystem::MaxConcurrentSurfaceLoads). */
+struct FSurfaceLoadSchedulerStats
+{
+	/** Loads held back because the IO or memory budget was taken by planets the player reaches sooner. */
+	int32 Deferrals = 0;
+	/** In-flight loads dropped to below-default streaming priority. */
+	int32 Demotions = 0;
+	/** Loads cancelled to stay within MaxResidentSurfaceMemoryMB. */
+	int32 Cancellations = 0;
+};
+
+/**
+ * Owns every UPlanetSurfaceStreamer in the world and decides which of them tick.
+ *
+ * Streamers start with their tick disabled. Once per frame the subsystem reads the player pawn,
+ * ranks planets by distance and wakes only the nearest MaxActiveStreamers whose (upper-bound)
+ * streaming radius could contain the player. Streamers mid-transition (not Idle) always stay awake.
+ * Everything else is dormant, so per-frame cost scales with nearby planets, not planets in the level.
+ *
+ * Predictive pre-streaming: the player's path is extrapolated (velocity + gravity) and planets whose
+ * handoff radius it reaches within the horizon are queued soonest-first. Loads start from that queue
+ * while MaxPredictiveLoads and PredictiveMemoryBudgetMB allow, so fast approaches find the surface
+ * already loaded at handoff instead of waiting on it.
+ *
+ * Surface level pool: a streamer leaving range hands its loaded level back here hidden instead of
+ * unloading it. Re-approaching the same (or another planet with the same level) reuses it, so
+ * skimming a streaming boundary doesn't reload. Least recently used instances are unloaded past
+ * MaxPooledSurfaceLevels or SurfacePoolMemoryBudgetMB.
+ *
+ * Load scheduling: every surface load (normal or predictive) is ranked by when the player reaches the
+ * planet's handoff radius, on the predicted path or else at the current closing speed. Planets the
+ * player is on or landing on come first. Down that list, at most MaxConcurrentSurfaceLoads loads are in
+ * flight at full priority; later ones wait or stream at demoted priority. Surfaces that would push the
+ * resident total past MaxResidentSurfaceMemoryMB are cancelled, after pooled instances have been evicted.
+ *
+ * Telemetry: streamers record load, reveal wait, handoff frame and unload timings here (see
+ * FPlanetStreamingTelemetry). Fed.Streaming.Telemetry logs them, Fed.Streaming.TelemetryCsv exports them.
+ *
+ * The caps are config properties: set them under [/Script/federation.PlanetStreamingSubsystem] in DefaultGame.ini.
+ */
+UCLASS(Config = Game)
+class FEDERATION_API UPlanetStreamingSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+	virtual void Deinitialize() override;
+
+	void RegisterStreamer(UPlanetSurfaceStreamer* Streamer);
+	void UnregisterStreamer(UPlanetSurfaceStreamer* Streamer);
+
+	/** Number of live registered streamers. */
+	int32 GetNumStreamers() const;
+
+	/** Number of streamers awake after the last UpdateStreamers pass. */
+	int32 GetNumActiveStreamers() const { return NumActiveStreamers; }
+
+	/**
+	 * One selection pass: wakes candidates near PlayerPawn and puts the rest to sleep.
+	 * Null PlayerPawn leaves only non-Idle streamers awake. Runs from Tick in game worlds;
+	 * public so tests can drive it in editor worlds.
+	 */
+	void UpdateStreamers(const APawn* PlayerPawn);
+
+	/** Most streamers that may run their state machine at once (non-Idle streamers are never culled). */
+	UPROPERTY(Config)
+	int32 MaxActiveStreamers = 4;
+
+	/** Activation distance = streamer's maximum streaming radius * this, so a streamer is awake before it can trigger. */
+	float ActivationMargin = 1.25f;
+
+	/** Start surface loads early for planets on the player's predicted path. */
+	bool bPredictiveStreaming = true;
+
+	/** Most predictive loads held at once (IO budget). */
+	UPROPERTY(Config)
+	int32 MaxPredictiveLoads = 2;
+
+	/** Held predictive loads may not sum past this many MB of EstimatedSurfaceMemoryMB. */
+	UPROPERTY(Config)
+	float PredictiveMemoryBudgetMB = 1024.f;
+
+	/** A held load is released once its planet has been off the predicted path this long. */
+	float PredictiveHoldGraceSeconds = 1.f;
+
+	/** Horizon and step used for the player's path. */
+	FPlanetTrajectoryPredictor Predictor;
+
+	/** Streamers currently holding a predictive load. */
+	int32 GetNumPredictiveLoads() const;
+
+	/** Most surface loads in flight at full streaming priority; the rest wait (Idle) or are demoted. */
+	UPROPERTY(Config)
+	int32 MaxConcurrentSurfaceLoads = 1;
+
+	/** Active and pooled surfaces may not sum past this many MB (each charged its EstimatedSurfaceMemoryMB). */
+	UPROPERTY(Config)
+	float MaxResidentSurfaceMemoryMB = 2048.f;
+
+	const FSurfaceLoadSchedulerStats& GetLoadSchedulerStats() const { return SchedulerStats; }
+
+	/** Most hidden surface level instances kept loaded for reuse (0 disables pooling). */
+	UPROPERTY(Config)
+	int32 MaxPooledSurfaceLevels = 2;
+
+	/** Hidden pooled instances may not sum past this many MB (each charged its streamer's EstimatedSurfaceMemoryMB). */
+	UPROPERTY(Config)
+	float SurfacePoolMemoryBudgetMB = 768.f;
+
+	/** Pooled instance of LevelPath that Requester released last, if any (stays in the pool). */
+	const ULevelStreamingDynamic* FindPooledSurfaceLevel(const FString& LevelPath, const UPlanetSurfaceStreamer* Requester) const;
+
+	/**
+	 * Takes a pooled, still-loaded instance of LevelPath placed at Transform out of the pool: one already
+	 * there, else the most recent one that can be moved there (not World Partition levels). Null on a miss.
+	 * OutLoadSeconds receives the instance's original load time.
+	 */
+	ULevelStreamingDynamic* AcquirePooledSurfaceLevel(const FString& LevelPath, const FTransform& Transform, float& OutLoadSeconds);
+
+	/**
+	 * Hides Level and keeps it loaded for reuse, evicting least recently used instances past the caps.
+	 * LoadSeconds is how long it originally took to load (credited as saved on reuse).
+	 * Returns false if pooling is off or the level alone exceeds the budget; the caller then unloads it.
+	 */
+	bool ReleaseSurfaceLevelToPool(ULevelStreamingDynamic* Level, const FString& LevelPath, const UPlanetSurfaceStreamer* Owner,
+		float MemoryMB, float LoadSeconds);
+
+	/** Unloads every pooled instance (e.g. on memory pressure). */
+	void FlushSurfacePool();
+
+	/** Moves the hidden pooled instances with a world origin shift (called by UFloatingOriginSubsystem). */
+	void ApplyOriginOffset(const FVector& Offset);
+
+	int32 GetNumPooledSurfaceLevels() const { return SurfacePool.Num(); }
+	const FSurfaceLevelPoolStats& GetSurfacePoolStats() const { return PoolStats; }
+
+	/** Transition timing histograms for every streamer in this world. */
+	FPlanetStreamingTelemetry& GetTelemetry() { return Telemetry; }
+	const FPlanetStreamingTelemetry& GetTelemetry() const { return Telemetry; }
+
+private:
+	struct FStreamerEntry
+	{
+		TWeakObjectPtr<UPlanetSurfaceStreamer> Streamer;
+		/** Owner scale when ActivationRadius was measured; a change triggers a re-measure. */
+		FVector CachedScale = FVector::ZeroVector;
+		float ActivationRadius = 0.f;
+		double DistanceSq = 0.0;
+		/** World time the player's predicted path last reached this planet. */
+		double LastPredictedTime = 0.0;
+		/** Seconds until the player reaches the handoff radius (this pass); max if not approaching. */
+		double ArrivalSeconds = TNumericLimits<double>::Max();
+		bool bRadiusValid = false;
+	};
+
+	void UpdatePredictiveStreaming(const APawn* PlayerPawn);
+	void UpdateLoadScheduler(const APawn* PlayerPawn);
+
+	struct FPredictiveLoadRequest
+	{
+		int32 EntryIndex = INDEX_NONE;
+		float TimeSeconds = 0.f;
+		FVector EntryPoint = FVector::ZeroVector;
+
+		bool operator<(const FPredictiveLoadRequest& Other) const { return TimeSeconds < Other.TimeSeconds; }
+	};
+
+	struct FPooledSurfaceLevel
+	{
+		/** Kept alive by the world's streaming level list while loaded. */
+		TWeakObjectPtr<ULevelStreamingDynamic> Level;
+		FString LevelPath;
+		TWeakObjectPtr<const UPlanetSurfaceStreamer> LastOwner;
+		float MemoryMB = 0.f;
+		float LoadSeconds = 0.f;
+	};
+
+	/** Least recently used first. */
+	TArray<FPooledSurfaceLevel> SurfacePool;
+	FSurfaceLevelPoolStats PoolStats;
+	FPlanetStreamingTelemetry Telemetry;
+	FSurfaceLoadSchedulerStats SchedulerStats;
+
+	void EvictPooledSurfaceLevel(int32 PoolIndex);
+	void TrimSurfacePool();
+
+	TArray<FStreamerEntry> Streamers;
+	TArray<int32> CandidateScratch;
+	TArray<FPlanetStreamTarget> PredictTargets;
+	TArray<FPlanetArrival> PredictedArrivals;
+	TArray<FPredictiveLoadRequest> LoadQueue;
+	TArray<int32> ScheduleScratch;
+	int32 NumActiveStreamers = 0;
+};
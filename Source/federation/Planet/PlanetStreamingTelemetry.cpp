@@ -0,0 +1,152 @@
+// Copyright Federation Game. All Rights Reserved.
+
+#include "Planet/PlanetStreamingTelemetry.h"
+
+FPlanetTimingHistogram::FPlanetTimingHistogram(double InMinValue, double InMaxValue, int32 InNumBuckets)
+{
+	MinValue = FMath::Max(InMinValue, UE_DOUBLE_SMALL_NUMBER);
+	const double MaxValue = FMath::Max(InMaxValue, MinValue * 2.0);
+	const int32 NumBuckets = FMath::Max(1, InNumBuckets);
+	LogBucketWidth = FMath::Loge(MaxValue / MinValue) / NumBuckets;
+	Buckets.SetNumZeroed(NumBuckets);
+}
+
+void FPlanetTimingHistogram::Add(double Value)
+{
+	Value = FMath::Max(0.0, Value);
+	++Buckets[GetBucketIndex(Value)];
+	MinSeen = Count > 0 ? FMath::Min(MinSeen, Value) : Value;
+	MaxSeen = Count > 0 ? FMath::Max(MaxSeen, Value) : Value;
+	Sum += Value;
+	++Count;
+}
+
+void FPlanetTimingHistogram::Reset()
+{
+	FMemory::Memzero(Buckets.GetData(), Buckets.Num() * sizeof(int32));
+	Count = 0;
+	Sum = 0.0;
+	MinSeen = 0.0;
+	MaxSeen = 0.0;
+}
+
+int32 FPlanetTimingHistogram::GetBucketIndex(double Value) const
+{
+	if (Value <= MinValue) return 0;
+	return FMath::Clamp(FMath::FloorToInt32(FMath::Loge(Value / MinValue) / LogBucketWidth), 0, Buckets.Num() - 1);
+}
+
+double FPlanetTimingHistogram::GetBucketLowerBound(int32 Index) const
+{
+	return MinValue * FMath::Exp(LogBucketWidth * FMath::Clamp(Index, 0, Buckets.Num()));
+}
+
+double FPlanetTimingHistogram::GetPercentile(double Fraction) const
+{
+	if (Count == 0) return 0.0;
+
+	const double Rank = FMath::Clamp(Fraction, 0.0, 1.0) * Count;
+	int32 Below = 0;
+	for (int32 i = 0; i < Buckets.Num(); ++i)
+	{
+		if (Buckets[i] == 0 || Below + Buckets[i] < Rank)
+		{
+			Below += Buckets[i];
+			continue;
+		}
+		// Log-interpolate inside the bucket, then keep within what was actually seen.
+		const double Alpha = (Rank - Below) / Buckets[i];
+		const double Estimate = GetBucketLowerBound(i) * FMath::Exp(LogBucketWidth * Alpha);
+		return FMath::Clamp(Estimate, MinSeen, MaxSeen);
+	}
+	return MaxSeen;
+}
+
+FPlanetStreamingTelemetry::FPlanetStreamingTelemetry()
+{
+	// Loads and unloads take seconds; handoff frames take milliseconds.
+	Histograms[static_cast<int32>(EPlanetStreamingMetric::HandoffFrame)] = FPlanetTimingHistogram(0.1, 1000.0, 30);
+}
+
+void FPlanetStreamingTelemetry::Record(EPlanetStreamingMetric Metric, double Value, bool bStall)
+{
+	if (Metric >= EPlanetStreamingMetric::Count) return;
+	Histograms[static_cast<int32>(Metric)].Add(Value);
+	if (bStall)
+	{
+		++Stalls[static_cast<int32>(Metric)];
+	}
+}
+
+void FPlanetStreamingTelemetry::Reset()
+{
+	for (int32 i = 0; i < static_cast<int32>(EPlanetStreamingMetric::Count); ++i)
+	{
+		Histograms[i].Reset();
+		Stalls[i] = 0;
+	}
+}
+
+int32 FPlanetStreamingTelemetry::GetTotalStalls() const
+{
+	int32 Total = 0;
+	for (const int32 MetricStalls : Stalls)
+	{
+		Total += MetricStalls;
+	}
+	return Total;
+}
+
+bool FPlanetStreamingTelemetry::IsEmpty() const
+{
+	for (const FPlanetTimingHistogram& Histogram : Histograms)
+	{
+		if (Histogram.GetCount() > 0) return false;
+	}
+	return true;
+}
+
+const TCHAR* FPlanetStreamingTelemetry::GetMetricName(EPlanetStreamingMetric Metric)
+{
+	switch (Metric)
+	{
+	case EPlanetStreamingMetric::Load:         return TEXT("Load");
+	case EPlanetStreamingMetric::RevealWait:   return TEXT("RevealWait");
+	case EPlanetStreamingMetric::HandoffFrame: return TEXT("HandoffFrame");
+	case EPlanetStreamingMetric::Unload:       return TEXT("Unload");
+	case EPlanetStreamingMetric::WarmUp:       return TEXT("WarmUp");
+	default:                                   return TEXT("Unknown");
+	}
+}
+
+const TCHAR* FPlanetStreamingTelemetry::GetMetricUnit(EPlanetStreamingMetric Metric)
+{
+	return Metric == EPlanetStreamingMetric::HandoffFrame ? TEXT("ms") : TEXT("s");
+}
+
+FString FPlanetStreamingTelemetry::GetSummary(EPlanetStreamingMetric Metric) const
+{
+	const FPlanetTimingHistogram& Histogram = GetHistogram(Metric);
+	const TCHAR* Unit = GetMetricUnit(Metric);
+	return FString::Printf(TEXT("%s: n=%d p50 %.2f%s p95 %.2f%s max %.2f%s, %d stalls"),
+		GetMetricName(Metric), Histogram.GetCount(),
+		Histogram.GetPercentile(0.5), Unit, Histogram.GetPercentile(0.95), Unit, Histogram.GetMax(), Unit,
+		GetNumStalls(Metric));
+}
+
+FString FPlanetStreamingTelemetry::ToCsv() const
+{
+	FString Csv = TEXT("Metric,Unit,LowerBound,UpperBound,Count\n");
+	for (int32 MetricIndex = 0; MetricIndex < static_cast<int32>(EPlanetStreamingMetric::Count); ++MetricIndex)
+	{
+		const EPlanetStreamingMetric Metric = static_cast<EPlanetStreamingMetric>(MetricIndex);
+		const FPlanetTimingHistogram& Histogram = Histograms[MetricIndex];
+		for (int32 i = 0; i < Histogram.GetNumBuckets(); ++i)
+		{
+			if (Histogram.GetBucketCount(i) == 0) continue;
+			Csv += FString::Printf(TEXT("%s,%s,%.4f,%.4f,%d\n"), GetMetricName(Metric), GetMetricUnit(Metric),
+				Histogram.GetBucketLowerBound(i), Histogram.GetBucketUpperBound(i), Histogram.GetBucketCount(i));
+		}
+	}
+	return Csv;
+}
@@ -0,0 +1,96 @@
+// Copyright Federation Game. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/** What a surface transition sample measures (see FPlanetStreamingTelemetry). */
+enum class EPlanetStreamingMetric : uint8
+{
+	/** BeginStreamIn until the surface content is loaded (level or generated tile), in seconds. */
+	Load,
+	/** Player inside the handoff radius until the handoff starts (load, reveal fade, cooldown), in seconds. */
+	RevealWait,
+	/** Worst game-thread frame of one staged handoff, in ms. */
+	HandoffFrame,
+	/** Unload request until the level is gone, in seconds. Pooled releases aren't unloads. */
+	Unload,
+	/** Surface content loaded until its textures, meshes and PSOs are warm (or the deadline), in seconds. */
+	WarmUp,
+	Count
+};
+
+/**
+ * Fixed-size histogram with log-spaced buckets between MinValue and MaxValue. Values outside
+ * that range land in the end buckets; count, mean, min and max are exact. Percentiles are
+ * interpolated within a bucket, so they're good to about one bucket width.
+ */
+class FEDERATION_API FPlanetTimingHistogram
+{
+public:
+	FPlanetTimingHistogram(double InMinValue = 0.01, double InMaxValue = 100.0, int32 InNumBuckets = 30);
+
+	void Add(double Value);
+	void Reset();
+
+	int32 GetCount() const { return Count; }
+	double GetMin() const { return Count > 0 ? MinSeen : 0.0; }
+	double GetMax() const { return Count > 0 ? MaxSeen : 0.0; }
+	double GetMean() const { return Count > 0 ? Sum / Count : 0.0; }
+
+	/** Estimated value below which Fraction (0..1) of the samples fall; 0 when empty. */
+	double GetPercentile(double Fraction) const;
+
+	int32 GetNumBuckets() const { return Buckets.Num(); }
+	int32 GetBucketCount(int32 Index) const { return Buckets.IsValidIndex(Index) ? Buckets[Index] : 0; }
+	double GetBucketLowerBound(int32 Index) const;
+	double GetBucketUpperBound(int32 Index) const { return GetBucketLowerBound(Index + 1); }
+
+private:
+	int32 GetBucketIndex(double Value) const;
+
+	double MinValue = 0.01;
+	/** log(MaxValue / MinValue) / NumBuckets. */
+	double LogBucketWidth = 1.0;
+	TArray<int32> Buckets;
+
+	int32 Count = 0;
+	double Sum = 0.0;
+	double MinSeen = 0.0;
+	double MaxSeen = 0.0;
+};
+
+/**
+ * In-memory timing histograms for planet surface transitions, one per EPlanetStreamingMetric.
+ * Owned by UPlanetStreamingSubsystem and fed by every UPlanetSurfaceStreamer; read through the
+ * Fed.Streaming.Telemetry console commands and the dev diagnostics overlay. A sample over its
+ * budget (e.g. a load slower than LoadLatencyBudgetSeconds) also counts as a stall.
+ */
+class FEDERATION_API FPlanetStreamingTelemetry
+{
+public:
+	FPlanetStreamingTelemetry();
+
+	void Record(EPlanetStreamingMetric Metric, double Value, bool bStall = false);
+	void Reset();
+
+	const FPlanetTimingHistogram& GetHistogram(EPlanetStreamingMetric Metric) const { return Histograms[static_cast<int32>(Metric)]; }
+	int32 GetNumStalls(EPlanetStreamingMetric Metric) const { return Stalls[static_cast<int32>(Metric)]; }
+	int32 GetTotalStalls() const;
+
+	/** True until the first sample of any metric. */
+	bool IsEmpty() const;
+
+	static const TCHAR* GetMetricName(EPlanetStreamingMetric Metric);
+	static const TCHAR* GetMetricUnit(EPlanetStreamingMetric Metric);
+
+	/** One line per metric: count, p50/p95/max and stalls. */
+	FString GetSummary(EPlanetStreamingMetric Metric) const;
+
+	/** Every non-empty bucket as Metric,Unit,LowerBound,UpperBound,Count rows, with a header. */
+	FString ToCsv() const;
+
+private:
+	FPlanetTimingHistogram Histograms[static_cast<int32>(EPlanetStreamingMetric::Count)];
+	int32 Stalls[static_cast<int32>(EPlanetStreamingMetric::Count)] = {};
+};
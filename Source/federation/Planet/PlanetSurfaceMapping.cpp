@@ -0,0 +1,68 @@
+// Copyright Federation Game. All Rights Reserved.
+
+#include "Planet/PlanetSurfaceMapping.h"
+
+FPlanetSurfaceMapping::FPlanetSurfaceMapping(const FVector& InPlanetCenter, double InRadius, const FVector& InSurfaceOrigin,
+	const FVector& InNormal, const FVector& InAxisX, const FVector& InAxisY, double InMinSurfaceAltitude)
+	: PlanetCenter(InPlanetCenter)
+	, SurfaceOrigin(InSurfaceOrigin)
+	, Normal(InNormal)
+	, AxisX(InAxisX)
+	, AxisY(InAxisY)
+	, Radius(FMath::Max(1.0, InRadius))
+	, MinSurfaceAltitude(InMinSurfaceAltitude)
+{
+}
+
+FVector FPlanetSurfaceMapping::SpaceToSurface(const FVector& SpacePos) const
+{
+	// Atan2 only needs the ratios, so the offset is never normalized.
+	const FVector Offset = SpacePos - PlanetCenter;
+	const double DotN = FVector::DotProduct(Offset, Normal);
+	const double Azimuth = FMath::Atan2(FVector::DotProduct(Offset, AxisX), DotN);
+	const double Elevation = FMath::Atan2(FVector::DotProduct(Offset, AxisY), DotN);
+	const double Altitude = FMath::Max(MinSurfaceAltitude, Offset.Size() - Radius);
+
+	return SurfaceOrigin + AxisX * (Azimuth * Radius) + AxisY * (Elevation * Radius) + Normal * Altitude;
+}
+
+FVector FPlanetSurfaceMapping::SurfaceToSpace(const FVector& SurfacePos) const
+{
+	const FVector Offset = SurfacePos - SurfaceOrigin;
+	const FVector Dir = SurfaceOffsetToDirection(Normal, AxisX, AxisY, Radius,
+		FVector::DotProduct(Offset, AxisX), FVector::DotProduct(Offset, AxisY));
+	const double Altitude = FMath::Max(0.0, FVector::DotProduct(Offset, Normal));
+
+	return PlanetCenter + Dir * (Radius + Altitude);
+}
+
+FVector FPlanetSurfaceMapping::SurfaceOffsetToDirection(const FVector& Normal, const FVector& AxisX, const FVector& AxisY,
+	double Radius, double OffsetX, double OffsetY)
+{
+	double SinA, CosA, SinE, CosE;
+	FMath::SinCos(&SinA, &CosA, OffsetX / Radius);
+	FMath::SinCos(&SinE, &CosE, OffsetY / Radius);
+
+	// Inverse of the two Atan2s: X/N = tan(A) and Y/N = tan(E), on the far hemisphere when both angles pass 90 degrees.
+	const double Side = (CosA < 0.0 || CosE < 0.0) ? -1.0 : 1.0;
+	const FVector Dir = (Normal * (CosA * CosE) + AxisX * (SinA * CosE) + AxisY * (CosA * SinE)) * Side;
+	return Dir.GetSafeNormal();
+}
+
+void FPlanetSurfaceMapping::SpaceToSurface(TConstArrayView<FVector> SpacePositions, TArrayView<FVector> OutSurfacePositions) const
+{
+	check(OutSurfacePositions.Num() >= SpacePositions.Num());
+	for (int32 i = 0; i < SpacePositions.Num(); ++i)
+	{
+		OutSurfacePositions[i] = SpaceToSurface(SpacePositions[i]);
+	}
+}
+
+void FPlanetSurfaceMapping::SurfaceToSpace(TConstArrayView<FVector> SurfacePositions, TArrayView<FVector> OutSpacePositions) const
+{
+	check(OutSpacePositions.Num() >= SurfacePositions.Num());
+	for (int32 i = 0; i < SurfacePositions.Num(); ++i)
+	{
+		OutSpacePositions[i] = SurfaceToSpace(SurfacePositions[i]);
+	}
+}
@@ -0,0 +1,61 @@
+// Copyright Federation Game. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Maps between space positions around a planet and the flat surface frame its surface level or tile
+ * is placed in. The frame touches the sphere at SurfaceOrigin with up Normal and tangents AxisX/AxisY.
+ *
+ * Space to surface: a direction's angles from Normal in the Normal/AxisX and Normal/AxisY planes
+ * become arc lengths along AxisX and AxisY, and height above the sphere becomes height above the frame.
+ * Surface to space is the exact closed-form inverse, so round trips only lose floating-point rounding.
+ *
+ * Everything is computed in double relative to the planet center, so precision doesn't degrade with
+ * the planet's distance from the world origin. The batch overloads run the same math over many
+ * positions (e.g. every actor carried across a handoff) without per-element setup.
+ */
+class FEDERATION_API FPlanetSurfaceMapping
+{
+public:
+	FPlanetSurfaceMapping() = default;
+
+	/**
+	 * Radius is clamped to at least 1. Normal, AxisX and AxisY must be orthonormal.
+	 * MinSurfaceAltitude is the lowest height above the frame SpaceToSurface returns.
+	 */
+	FPlanetSurfaceMapping(const FVector& InPlanetCenter, double InRadius, const FVector& InSurfaceOrigin,
+		const FVector& InNormal, const FVector& InAxisX, const FVector& InAxisY, double InMinSurfaceAltitude = 0.0);
+
+	/** Surface frame position for SpacePos (any direction from the center; most accurate on the Normal side). */
+	FVector SpaceToSurface(const FVector& SpacePos) const;
+
+	/** Space position for SurfacePos; heights below the frame land on the sphere. */
+	FVector SurfaceToSpace(const FVector& SurfacePos) const;
+
+	/**
+	 * Unit direction from the planet center under the frame point OffsetX/OffsetY along AxisX/AxisY from the
+	 * tangent point. SurfaceToSpace and terrain tiles (FPlanetTerrainGenerator) share it so they sample the same spot.
+	 */
+	static FVector SurfaceOffsetToDirection(const FVector& Normal, const FVector& AxisX, const FVector& AxisY,
+		double Radius, double OffsetX, double OffsetY);
+
+	/** Per-element versions; Out must be at least as long as In (In and Out may alias). */
+	void SpaceToSurface(TConstArrayView<FVector> SpacePositions, TArrayView<FVector> OutSurfacePositions) const;
+	void SurfaceToSpace(TConstArrayView<FVector> SurfacePositions, TArrayView<FVector> OutSpacePositions) const;
+
+	const FVector& GetPlanetCenter() const { return PlanetCenter; }
+	double GetRadius() const { return Radius; }
+	const FVector& GetSurfaceOrigin() const { return SurfaceOrigin; }
+	const FVector& GetNormal() const { return Normal; }
+
+private:
+	FVector PlanetCenter = FVector::ZeroVector;
+	FVector SurfaceOrigin = FVector(0.0, 0.0, 1.0);
+	FVector Normal = FVector::UpVector;
+	FVector AxisX = FVector::ForwardVector;
+	FVector AxisY = FVector::RightVector;
+	double Radius = 1.0;
+	double MinSurfaceAltitude = 0.0;
+};
@@ -2,11 +2,18 @@
 
 #include "Planet/PlanetSurfaceStreamer.h"
 #include "Planet/PlanetGravityComponent.h"
+#include "Planet/OrbitalMechanicsSubsystem.h"
+#include "Planet/PlanetStreamingSubsystem.h"
+#include "Planet/PlanetLODMesh.h"
+#include "Planet/PlanetTerrainTile.h"
 #include "Character/FederationCharacter.h"
 #include "Core/FederationGameState.h"
+#include "Core/FloatingOriginSubsystem.h"
 #include "Movement/JetpackMovementComponent.h"
 #include "Engine/LevelStreamingDynamic.h"
+#include "Engine/Level.h"
 #include "Engine/World.h"
+#include "LevelUtils.h"
 #include "UObject/SoftObjectPath.h"
 #include "GameFramework/Character.h"
 #include "GameFramework/CharacterMovementComponent.h"
@@ -16,24 +23,94 @@
 #include "Components/StaticMeshComponent.h"
 #include "Kismet/GameplayStatics.h"
 #include "Materials/MaterialInstanceDynamic.h"
+#include "Materials/MaterialParameterCollection.h"
+#include "Materials/MaterialParameterCollectionInstance.h"
 #include "Misc/Paths.h"
+#include "HAL/PlatformTime.h"
+#include "ProfilingDebugging/MiscTrace.h"
 
 namespace
 {
 	TWeakObjectPtr<UPlanetSurfaceStreamer> GPlanetTransitionOwner;
+
+	/** Streamer whose reveal sphere is in RevealParameterCollection; one planet reveals at a time. */
+	TWeakObjectPtr<UPlanetSurfaceStreamer> GRevealCollectionOwner;
+}
+
+namespace PlanetSurfaceStreamer
+{
+	/** Tangent axes for a surface tile whose up is Normal (same convention for the primary and cell tiles). */
+	void MakeTangentAxes(const FVector& Normal, FVector& OutX, FVector& OutY)
+	{
+		const FVector UpHint = FMath::Abs(Normal.Z) < 0.99f ? FVector::UpVector : FVector::ForwardVector;
+		OutX = FVector::CrossProduct(UpHint, Normal).GetSafeNormal();
+		OutY = FVector::CrossProduct(Normal, OutX).GetSafeNormal();
+	}
+
+	/** Moves a cell level to Transform: loaded instances now, pending ones when they load (partitioned levels stay put). */
+	void PlaceSurfaceLevel(ULevelStreamingDynamic* Level, const FTransform& Transform)
+	{
+		if (!Level) return;
+		if (ULevel* Loaded = Level->GetLoadedLevel())
+		{
+			if (Loaded->IsPartitioned()) return;
+			FLevelUtils::ApplyLevelTransform(Loaded, Level->LevelTransform.Inverse() * Transform, false);
+		}
+		Level->LevelTransform = Transform;
+	}
+
+	/** Neighbour cell level requests started per tick; spreads level-instance setup over frames. */
+	constexpr int32 MaxCellRequestsPerTick = 1;
+
+	/** Reveal sphere pushed outside the reveal phase: large enough that the whole planet shows. */
+	constexpr float RestRevealRadius = 1.0e9f;
+	constexpr float RestRevealSoftness = 1.0e8f;
+
+	/** Lowest local altitude the player is placed at on arrival (above the tile plane or generated ground). */
+	constexpr float MinSurfaceAltitude = 300.f;
+
+	/** Waiting at the handoff radius longer than this counts as a stall: the player arrived before the surface was ready. */
+	constexpr float RevealWaitStallSeconds = 0.25f;
+
+	/** Warmed textures and meshes stay forced resident this long: through the handoff and the first seconds on the surface. */
+	constexpr float WarmUpResidentSeconds = 10.f;
 }
 
+DECLARE_STATS_GROUP(TEXT("PlanetHandoff"), STATGROUP_PlanetHandoff, STATCAT_Advanced);
+DECLARE_CYCLE_STAT(TEXT("Handoff Prewarm Visibility"), STAT_PlanetHandoff_PrewarmVisibility, STATGROUP_PlanetHandoff);
+DECLARE_CYCLE_STAT(TEXT("Handoff Warm Up Content"), STAT_PlanetHandoff_WarmUpContent, STATGROUP_PlanetHandoff);
+DECLARE_CYCLE_STAT(TEXT("Handoff Settle Physics"), STAT_PlanetHandoff_SettlePhysics, STATGROUP_PlanetHandoff);
+DECLARE_CYCLE_STAT(TEXT("Handoff Teleport"), STAT_PlanetHandoff_Teleport, STATGROUP_PlanetHandoff);
+DECLARE_CYCLE_STAT(TEXT("Handoff Restore Camera"), STAT_PlanetHandoff_RestoreCamera, STATGROUP_PlanetHandoff);
+DECLARE_FLOAT_COUNTER_STAT(TEXT("Handoff Worst Frame (ms)"), STAT_PlanetHandoff_WorstFrameMs, STATGROUP_PlanetHandoff);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Handoff Frames"), STAT_PlanetHandoff_Frames, STATGROUP_PlanetHandoff);
+
 UPlanetSurfaceStreamer::UPlanetSurfaceStreamer()
 {
 	PrimaryComponentTick.bCanEverTick = true;
+	// Dormant until UPlanetStreamingSubsystem wakes us (player nearby or a transition in progress).
+	PrimaryComponentTick.bStartWithTickEnabled = false;
 	// Default path matches docs: create a level at Content/Planets/PlanetSurface_Test. Override in Details if needed.
 	SurfaceLevelPath = TEXT("/Game/Planets/PlanetSurface_Test");
 }
 
 void UPlanetSurfaceStreamer::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
 {
+	QUICK_SCOPE_CYCLE_COUNTER(STAT_PlanetSurfaceStreamer_Tick);
 	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
 
+	// A handoff in progress owns the frame: no state changes or fade updates until the player has landed.
+	if (IsHandoffInProgress())
+	{
+		AdvanceSurfaceHandoff();
+		return;
+	}
+
+	if (UsesSeamlessLOD() && UpdateSeamlessLOD())
+	{
+		return;
+	}
+
 	switch (StreamingState)
 	{
 	case EPlanetStreamingState::Idle:
@@ -49,6 +126,10 @@ void UPlanetSurfaceStreamer::TickComponent(float DeltaTime, ELevelTick TickType,
 		UpdateUnloadingState();
 		break;
 	}
+	if (StreamingState != EPlanetStreamingState::Loading)
+	{
+		bPredictiveHold = false;
+	}
 
 	// Reveal/fade starts only after surface loading has begun and level is actually loaded.
 	const bool bApproachPhase = StreamingState == EPlanetStreamingState::Idle || StreamingState == EPlanetStreamingState::Loading;
@@ -56,8 +137,7 @@ void UPlanetSurfaceStreamer::TickComponent(float DeltaTime, ELevelTick TickType,
 	{
 		const bool bCanReveal = FadeStartMultiplier > 0.f
 			&& StreamingState == EPlanetStreamingState::Loading
-			&& StreamedLevel
-			&& StreamedLevel->HasLoadedLevel();
+			&& IsSurfaceContentLoaded();
 
 		if (bCanReveal)
 		{
@@ -74,6 +154,117 @@ void UPlanetSurfaceStreamer::TickComponent(float DeltaTime, ELevelTick TickType,
 	}
 }
 
+void UPlanetSurfaceStreamer::OnRegister()
+{
+	Super::OnRegister();
+
+	if (UWorld* World = GetWorld())
+	{
+		if (UPlanetStreamingSubsystem* Sub = World->GetSubsystem<UPlanetStreamingSubsystem>())
+		{
+			Sub->RegisterStreamer(this);
+		}
+	}
+}
+
+void UPlanetSurfaceStreamer::OnUnregister()
+{
+	// Generated tiles are owned by this planet; streamed levels are left to the world / pool.
+	if (GetOwner() && GetOwner()->IsActorBeingDestroyed())
+	{
+		for (const FStreamedSurfaceCell& Entry : SurfaceCells)
+		{
+			if (APlanetTerrainTile* Tile = Entry.Tile.Get())
+			{
+				Tile->Destroy();
+			}
+		}
+		if (GeneratedTile)
+		{
+			GeneratedTile->Destroy();
+			GeneratedTile = nullptr;
+		}
+		if (LODMesh)
+		{
+			LODMesh->Destroy();
+			LODMesh = nullptr;
+		}
+	}
+
+	// Don't leave our reveal sphere in the shared collection for other planets.
+	ResetPlanetRevealParams();
+
+	if (UWorld* World = GetWorld())
+	{
+		if (UPlanetStreamingSubsystem* Sub = World->GetSubsystem<UPlanetStreamingSubsystem>())
+		{
+			Sub->UnregisterStreamer(this);
+		}
+	}
+
+	Super::OnUnregister();
+}
+
+void UPlanetSurfaceStreamer::ApplyWorldOffset(const FVector& InOffset, bool bWorldShift)
+{
+	Super::ApplyWorldOffset(InOffset, bWorldShift);
+
+	// Tiles and the LOD mesh are actors and moved with their level; these are plain positions.
+	SurfaceLevelWorldOrigin += InOffset;
+	SavedSpaceLocation += InOffset;
+
+	// Level transforms too, so pooling and cell reuse keep matching them.
+	UFloatingOriginSubsystem::ShiftLevelInstance(StreamedLevel, InOffset);
+	for (const FStreamedSurfaceCell& Entry : SurfaceCells)
+	{
+		UFloatingOriginSubsystem::ShiftLevelInstance(Entry.Level.Get(), InOffset);
+	}
+}
+
+bool UPlanetSurfaceStreamer::BeginPredictiveStreamIn(const FVector& PredictedEntryPoint)
+{
+	if (StreamingState != EPlanetStreamingState::Idle || UsesSeamlessLOD() || bLoadDeferred) return false;
+
+	PredictedAnchorDirection = (PredictedEntryPoint - GetPlanetCenter()).GetSafeNormal();
+	BeginStreamIn();
+	PredictedAnchorDirection = FVector::ZeroVector;
+
+	bPredictiveHold = StreamingState == EPlanetStreamingState::Loading;
+	return bPredictiveHold;
+}
+
+void UPlanetSurfaceStreamer::SetSurfaceLoadPriority(int32 Priority)
+{
+	SurfaceLoadPriority = Priority;
+	if (StreamedLevel && StreamedLevel->GetPriority() != Priority)
+	{
+		StreamedLevel->SetPriority(Priority);
+	}
+}
+
+bool UPlanetSurfaceStreamer::CancelSurfaceLoad()
+{
+	if (StreamingState != EPlanetStreamingState::Loading || IsHandoffInProgress()) return false;
+
+	UE_LOG(LogTemp, Log, TEXT("PlanetSurfaceStreamer: Surface load of '%s' cancelled by the load scheduler."), *StreamedLevelPath);
+	DiscardSurfaceContent();
+	ReleaseTransitionLock();
+	bPredictiveHold = false;
+	bLoadTelemetryPending = false;
+	HandoffArrivalTime = -1.f;
+	bLoadDeferred = true;
+	StreamingState = EPlanetStreamingState::Idle;
+	return true;
+}
+
+void UPlanetSurfaceStreamer::SetStreamingDormant(bool bDormant)
+{
+	// Also compare the live tick state: it can be enabled before the tick function is first registered.
+	if (bStreamingDormant == bDormant && IsComponentTickEnabled() == !bDormant) return;
+	bStreamingDormant = bDormant;
+	SetComponentTickEnabled(!bDormant);
+}
+
 // ---------------------------------------------------------------------------
 // Testable pure logic
 // ---------------------------------------------------------------------------
@@ -86,7 +277,27 @@ float UPlanetSurfaceStreamer::GetDistanceToPlayerSquared() const
 	APawn* PlayerPawn = GetPlayerPawn();
 	if (!PlayerPawn) return FLT_MAX;
 
-	return FVector::DistSquared(Owner->GetActorLocation(), PlayerPawn->GetActorLocation());
+	return FVector::DistSquared(GetPlanetCenter(), PlayerPawn->GetActorLocation());
+}
+
+FVector UPlanetSurfaceStreamer::GetPlanetCenter() const
+{
+	AActor* Owner = GetOwner();
+	if (!Owner) return FVector::ZeroVector;
+
+	// Orbiting planets: the propagated state is authoritative (the actor transform is written from it).
+	if (UWorld* World = Owner->GetWorld())
+	{
+		if (const UOrbitalMechanicsSubsystem* Orbits = World->GetSubsystem<UOrbitalMechanicsSubsystem>())
+		{
+			FVector Center;
+			if (Orbits->GetBodyPosition(Owner, Center))
+			{
+				return Center;
+			}
+		}
+	}
+	return Owner->GetActorLocation();
 }
 
 float UPlanetSurfaceStreamer::GetPlanetRadiusFromOwner() const
@@ -171,9 +382,18 @@ float UPlanetSurfaceStreamer::ComputeAutoSurfaceLevelScale() const
 	if (PlanetRadius <= 0.f) return 1.f;
 
 	const float SafeExtent = FMath::Max(100.f, SurfaceLevelWorldExtent);
-	const float SafePatch = FMath::Clamp(DesiredPatchFraction, 0.01f, 1.f);
-	const float DesiredPatchRadius = PlanetRadius * SafePatch;
-	return FMath::Clamp(DesiredPatchRadius / SafeExtent, MinAutoScale, 10.f);
+	return FMath::Clamp(GetDesiredPatchRadius() / SafeExtent, MinAutoScale, 10.f);
+}
+
+float UPlanetSurfaceStreamer::GetDesiredPatchRadius() const
+{
+	const float PlanetRadius = FMath::Max(1.f, GetPlanetRadiusFromOwner());
+	// Cell grid: each tile covers half a cell's arc either side of its center.
+	if (bUseCellGrid)
+	{
+		return PlanetRadius * static_cast<float>(GetCellGrid().GetCellAngle()) * 0.5f;
+	}
+	return PlanetRadius * FMath::Clamp(DesiredPatchFraction, 0.01f, 1.f);
 }
 
 bool UPlanetSurfaceStreamer::ShouldStreamIn(float DistanceSq) const
@@ -203,6 +423,28 @@ float UPlanetSurfaceStreamer::GetEffectiveStreamingRadius() const
 	return ComputeAdaptiveStreamingRadius(PlanetRadius, GetPlayerApproachSpeedTowardPlanet());
 }
 
+float UPlanetSurfaceStreamer::GetMaxStreamingRadius() const
+{
+	if (TransitionProfile.bUseExplicitRadiiOverrides && StreamingRadius > 0.f)
+	{
+		return StreamingRadius;
+	}
+
+	const float PlanetRadius = GetPlanetRadiusFromOwner();
+	if (PlanetRadius <= 0.f)
+	{
+		return 200000.f;
+	}
+
+	if (!TransitionProfile.bUseAdaptiveRadii)
+	{
+		return FMath::Max(PlanetRadius * 2.f, 10000.f);
+	}
+
+	// Upper end of ComputeAdaptiveStreamingRadius's clamp (its min bound wins if the multipliers are inverted).
+	return FMath::Max(1.f, PlanetRadius) * FMath::Max3(1.f, TransitionProfile.MinStreamingRadiusMultiplier, TransitionProfile.MaxStreamingRadiusMultiplier);
+}
+
 bool UPlanetSurfaceStreamer::ShouldTransitionToSurface(float DistanceSq) const
 {
 	const float R = GetEffectiveHandoffRadius();
@@ -218,7 +460,7 @@ float UPlanetSurfaceStreamer::GetPlayerApproachSpeedTowardPlanet() const
 		return 0.f;
 	}
 
-	const FVector ToPlanet = (Owner->GetActorLocation() - PlayerPawn->GetActorLocation()).GetSafeNormal();
+	const FVector ToPlanet = (GetPlanetCenter() - PlayerPawn->GetActorLocation()).GetSafeNormal();
 	if (ToPlanet.IsNearlyZero())
 	{
 		return 0.f;
@@ -293,13 +535,25 @@ void UPlanetSurfaceStreamer::UpdatePlanetFade(float DistanceToPlayer)
 
 void UPlanetSurfaceStreamer::SetPlanetRevealParams(float Progress)
 {
-	if (!CachedPlanetFadeMaterial) return;
+	if (!CachedPlanetFadeMaterial && !RevealParameterCollection) return;
 	AActor* Owner = GetOwner();
 	if (!Owner) return;
 	APawn* PlayerPawn = GetPlayerPawn();
 	if (!PlayerPawn) return;
 
-	const FVector Center = Owner->GetActorLocation();
+	if (RevealParameterCollection)
+	{
+		// The first planet to start revealing keeps the shared sphere until it resets.
+		if (GRevealCollectionOwner.IsValid() && GRevealCollectionOwner.Get() != this) return;
+		if (!GRevealCollectionOwner.IsValid())
+		{
+			GRevealCollectionOwner = this;
+			// Another planet may have written the collection since we last did.
+			FadeParamCache.Invalidate();
+		}
+	}
+
+	const FVector Center = GetPlanetCenter();
 	const FVector ToPlayer = (PlayerPawn->GetActorLocation() - Center).GetSafeNormal();
 	const float PlanetRadius = FMath::Max(1.f, GetPlanetRadiusFromOwner());
 
@@ -309,18 +563,39 @@ void UPlanetSurfaceStreamer::SetPlanetRevealParams(float Progress)
 	const float RevealRadius = FMath::Lerp(MinRadius, MaxRadius, Progress);
 	const float RevealSoftness = FMath::Max(10.f, PlanetRadius * FMath::Max(0.f, RevealSoftnessMultiplier));
 
-	CachedPlanetFadeMaterial->SetVectorParameterValue(RevealCenterParameterName, FLinearColor(RevealCenter));
-	CachedPlanetFadeMaterial->SetScalarParameterValue(RevealRadiusParameterName, RevealRadius);
-	CachedPlanetFadeMaterial->SetScalarParameterValue(RevealSoftnessParameterName, RevealSoftness);
+	PushRevealParams(FLinearColor(RevealCenter), RevealRadius, RevealSoftness);
 }
 
 void UPlanetSurfaceStreamer::ResetPlanetRevealParams()
 {
-	if (!CachedPlanetFadeMaterial) return;
+	if (RevealParameterCollection)
+	{
+		// Only the planet holding the shared sphere puts it back.
+		if (GRevealCollectionOwner.Get() != this) return;
+		GRevealCollectionOwner = nullptr;
+	}
+	else if (!CachedPlanetFadeMaterial)
+	{
+		return;
+	}
 	// Keep full planet visible outside reveal phase: use a very large sphere mask by default.
-	CachedPlanetFadeMaterial->SetVectorParameterValue(RevealCenterParameterName, FLinearColor::Black);
-	CachedPlanetFadeMaterial->SetScalarParameterValue(RevealRadiusParameterName, 1.0e9f);
-	CachedPlanetFadeMaterial->SetScalarParameterValue(RevealSoftnessParameterName, 1.0e8f);
+	PushRevealParams(FLinearColor::Black, PlanetSurfaceStreamer::RestRevealRadius, PlanetSurfaceStreamer::RestRevealSoftness);
+}
+
+void UPlanetSurfaceStreamer::PushRevealParams(const FLinearColor& Center, float Radius, float Softness)
+{
+	if (RevealParameterCollection)
+	{
+		UWorld* World = GetWorld();
+		UMaterialParameterCollectionInstance* Collection = World ? World->GetParameterCollectionInstance(RevealParameterCollection) : nullptr;
+		FadeParamCache.SetVector(Collection, RevealCenterParameterName, Center);
+		FadeParamCache.SetScalar(Collection, RevealRadiusParameterName, Radius);
+		FadeParamCache.SetScalar(Collection, RevealSoftnessParameterName, Softness);
+		return;
+	}
+	FadeParamCache.SetVector(CachedPlanetFadeMaterial, RevealCenterParameterName, Center);
+	FadeParamCache.SetScalar(CachedPlanetFadeMaterial, RevealRadiusParameterName, Radius);
+	FadeParamCache.SetScalar(CachedPlanetFadeMaterial, RevealSoftnessParameterName, Softness);
 }
 
 void UPlanetSurfaceStreamer::SetPlanetFadeAlpha(float Alpha)
@@ -328,7 +603,12 @@ void UPlanetSurfaceStreamer::SetPlanetFadeAlpha(float Alpha)
 	AActor* Owner = GetOwner();
 	if (!Owner) return;
 
-	UStaticMeshComponent* Mesh = Owner->FindComponentByClass<UStaticMeshComponent>();
+	UStaticMeshComponent* Mesh = CachedPlanetMesh.Get();
+	if (!Mesh)
+	{
+		Mesh = Owner->FindComponentByClass<UStaticMeshComponent>();
+		CachedPlanetMesh = Mesh;
+	}
 	if (!Mesh || Mesh->GetNumMaterials() == 0) return;
 
 	UMaterialInterface* CurrentMat = Mesh->GetMaterial(0);
@@ -337,7 +617,7 @@ void UPlanetSurfaceStreamer::SetPlanetFadeAlpha(float Alpha)
 	// Reuse our MID if the mesh is already using it; otherwise we'd create MID(MID(...)) every tick and blow FName length
 	if (CachedPlanetFadeMaterial && CurrentMat == CachedPlanetFadeMaterial)
 	{
-		CachedPlanetFadeMaterial->SetScalarParameterValue(FadeParameterName, Alpha);
+		FadeParamCache.SetScalar(CachedPlanetFadeMaterial, FadeParameterName, Alpha);
 		return;
 	}
 
@@ -352,7 +632,8 @@ void UPlanetSurfaceStreamer::SetPlanetFadeAlpha(float Alpha)
 	CachedPlanetFadeMaterial = UMaterialInstanceDynamic::Create(BaseMat, this);
 	if (!CachedPlanetFadeMaterial) return;
 	Mesh->SetMaterial(0, CachedPlanetFadeMaterial);
-	CachedPlanetFadeMaterial->SetScalarParameterValue(FadeParameterName, Alpha);
+	FadeParamCache.Invalidate();
+	FadeParamCache.SetScalar(CachedPlanetFadeMaterial, FadeParameterName, Alpha);
 }
 
 bool UPlanetSurfaceStreamer::ShouldStreamOut(const FVector& PlayerLocation, const FVector& SurfaceOrigin) const
@@ -378,6 +659,47 @@ void UPlanetSurfaceStreamer::GetSavedSpacePosition(FVector& OutLocation, FRotato
 // State machine updates
 // ---------------------------------------------------------------------------
 
+bool UPlanetSurfaceStreamer::UpdateSeamlessLOD()
+{
+	UWorld* World = GetWorld();
+	AActor* Owner = GetOwner();
+	if (!World || !Owner) return true;
+
+	if (!LODMesh)
+	{
+		FActorSpawnParameters Params;
+		Params.Owner = Owner;
+		Params.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+		LODMesh = World->SpawnActor<APlanetLODMesh>(APlanetLODMesh::StaticClass(), FTransform(GetPlanetCenter()), Params);
+		if (!LODMesh)
+		{
+			bSeamlessFallback = TransitionProfile.bAllowLegacyFallback;
+			UE_LOG(LogTemp, Error, TEXT("PlanetSurfaceStreamer: Failed to spawn LOD mesh%s."), bSeamlessFallback ? TEXT(", falling back to streamed surface") : TEXT(""));
+			return !bSeamlessFallback;
+		}
+		// Follows the planet (orbits), but its geometry is in world-aligned UU, not the shell's scale.
+		LODMesh->GetRootComponent()->SetUsingAbsoluteRotation(true);
+		LODMesh->GetRootComponent()->SetUsingAbsoluteScale(true);
+		LODMesh->AttachToActor(Owner, FAttachmentTransformRules::KeepWorldTransform);
+		LODMesh->Initialize(LODSettings, TerrainSettings, FMath::Max(1.f, GetPlanetRadiusFromOwner()), TerrainMaterial);
+		UE_LOG(LogTemp, Log, TEXT("PlanetSurfaceStreamer: LOD mesh spawned (max depth %d, seed %d)."), LODSettings.MaxDepth, TerrainSettings.Seed);
+	}
+
+	// Swap the shell for the LOD mesh once it covers the planet. The shell keeps its (ignored) collision
+	// so bounds-based radius lookups are unchanged.
+	if (!bShellHiddenForLOD && LODMesh->IsBaseReady())
+	{
+		if (UStaticMeshComponent* Shell = Owner->FindComponentByClass<UStaticMeshComponent>())
+		{
+			Shell->SetVisibility(false);
+			Shell->SetCollisionResponseToAllChannels(ECR_Ignore);
+		}
+		bShellHiddenForLOD = true;
+		UE_LOG(LogTemp, Log, TEXT("PlanetSurfaceStreamer: LOD mesh covers the planet, shell hidden."));
+	}
+	return true;
+}
+
 void UPlanetSurfaceStreamer::UpdateIdleState()
 {
 	APawn* PlayerPawn = GetPlayerPawn();
@@ -389,13 +711,9 @@ void UPlanetSurfaceStreamer::UpdateIdleState()
 		}
 	}
 
-	if (AFederationGameState* GS = GetWorld() ? GetWorld()->GetGameState<AFederationGameState>() : nullptr)
-	{
-		GS->DebugStreamingState = TEXT("Idle");
-		GS->DebugStreamingLevelName = FString();
-	}
+	// HUD "Idle" is written once per frame by UPlanetStreamingSubsystem, not by every idle planet.
 	const float DistSq = GetDistanceToPlayerSquared();
-	if (ShouldStreamIn(DistSq))
+	if (!bLoadDeferred && ShouldStreamIn(DistSq))
 	{
 		BeginStreamIn();
 	}
@@ -403,7 +721,7 @@ void UPlanetSurfaceStreamer::UpdateIdleState()
 
 void UPlanetSurfaceStreamer::UpdateLoadingState()
 {
-	if (!StreamedLevel) return;
+	if (!HasSurfaceContent()) return;
 
 	TimeSinceStreamOut += GetWorld() ? GetWorld()->GetDeltaSeconds() : 0.f;
 
@@ -412,8 +730,16 @@ void UPlanetSurfaceStreamer::UpdateLoadingState()
 	const float HandoffR = GetEffectiveHandoffRadius();
 	const float StreamR = GetEffectiveStreamingRadius();
 
+	// A predictive load hands over to the normal range logic once the player is in streaming range.
+	// Until then it only waits: keep the level, leave gravity blend and HUD alone.
+	if (bPredictiveHold && Dist <= StreamR)
+	{
+		bPredictiveHold = false;
+	}
+	const bool bWaitingForPlayer = bPredictiveHold;
+
 	APawn* PlayerPawn = GetPlayerPawn();
-	if (PlayerPawn)
+	if (PlayerPawn && !bWaitingForPlayer)
 	{
 		if (UPlanetGravityComponent* GravComp = PlayerPawn->FindComponentByClass<UPlanetGravityComponent>())
 		{
@@ -429,7 +755,8 @@ void UPlanetSurfaceStreamer::UpdateLoadingState()
 	}
 
 	// Only show "Loading/Approaching" in dev HUD when we're close; from far away show Deep Space (Idle)
-	if (AFederationGameState* GS = GetWorld() ? GetWorld()->GetGameState<AFederationGameState>() : nullptr)
+	AFederationGameState* GS = GetWorld() ? GetWorld()->GetGameState<AFederationGameState>() : nullptr;
+	if (GS && !bWaitingForPlayer)
 	{
 		if (Dist <= HandoffR * 2.f)
 		{
@@ -443,23 +770,62 @@ void UPlanetSurfaceStreamer::UpdateLoadingState()
 		}
 	}
 
+	// Telemetry: load latency once content is in, and how long the player has been waiting at the handoff radius.
+	const float Now = GetWorld() ? GetWorld()->GetTimeSeconds() : 0.f;
+	if (bLoadTelemetryPending && IsSurfaceContentLoaded())
+	{
+		bLoadTelemetryPending = false;
+		const float LoadSeconds = Now - LoadingStartTime;
+		RecordTransitionTelemetry(EPlanetStreamingMetric::Load, LoadSeconds, LoadSeconds > TransitionProfile.LoadLatencyBudgetSeconds);
+	}
+	if (bWaitingForPlayer || !ShouldTransitionToSurface(DistSq))
+	{
+		HandoffArrivalTime = -1.f;
+	}
+	else if (HandoffArrivalTime < 0.f)
+	{
+		HandoffArrivalTime = Now;
+	}
+
 	// If player has moved beyond streaming radius, unload only once the level has finished loading.
 	// Do not cancel an in-progress load: let it complete so we can transition if they re-enter range,
 	// and avoid the "flash then level never appears" when the player is near the boundary.
-	if (!ShouldStreamIn(DistSq))
+	if (!ShouldStreamIn(DistSq) && !bPredictiveHold)
 	{
+		if (GeneratedTile)
+		{
+			// Regenerating is cheap next to a level load; tiles aren't pooled.
+			UE_LOG(LogTemp, Log, TEXT("PlanetSurfaceStreamer: Player left streaming range, generated tile dropped."));
+			CompleteSurfaceUnload();
+			return;
+		}
 		if (StreamedLevel->HasLoadedLevel())
 		{
+			// Hide and pool it for a quick re-approach; unload only if the pool won't take it.
+			UPlanetStreamingSubsystem* StreamingManager = GetWorld() ? GetWorld()->GetSubsystem<UPlanetStreamingSubsystem>() : nullptr;
+			if (StreamingManager && StreamingManager->ReleaseSurfaceLevelToPool(StreamedLevel, StreamedLevelPath, this,
+				EstimatedSurfaceMemoryMB, FMath::Max(0.f, SurfaceLoadSeconds)))
+			{
+				UE_LOG(LogTemp, Log, TEXT("PlanetSurfaceStreamer: Player left streaming range, level hidden and pooled."));
+				CompleteSurfaceUnload();
+				return;
+			}
 			StreamedLevel->SetShouldBeLoaded(false);
 			StreamedLevel->SetShouldBeVisible(false);
 			StreamedLevel->SetIsRequestingUnloadAndRemoval(true);
 			StreamingState = EPlanetStreamingState::Unloading;
+			UnloadStartTime = Now;
 			UE_LOG(LogTemp, Log, TEXT("PlanetSurfaceStreamer: Player left streaming range, unloading level."));
 		}
 		return;
 	}
 
-	if (!StreamedLevel->HasLoadedLevel())
+	if (IsSurfaceContentLoaded() && SurfaceLoadSeconds < 0.f && GetWorld())
+	{
+		SurfaceLoadSeconds = GetWorld()->GetTimeSeconds() - LoadingStartTime;
+	}
+
+	if (!IsSurfaceContentLoaded())
 	{
 		// After hot reload, LoadingStartTime can be 0 on existing instances; avoid immediate false timeout.
 		if (GetWorld() && LoadingStartTime <= 0.f)
@@ -471,15 +837,15 @@ void UPlanetSurfaceStreamer::UpdateLoadingState()
 		if (GetWorld() && (GetWorld()->GetTimeSeconds() - LoadingStartTime > LoadTimeout))
 		{
 			UE_LOG(LogTemp, Warning, TEXT("PlanetSurfaceStreamer: Level load timeout after %.0fs, unloading. Check SurfaceLevelPath='%s'."), LoadTimeout, *SurfaceLevelPath);
-			StreamedLevel->SetShouldBeLoaded(false);
-			StreamedLevel->SetShouldBeVisible(false);
-			StreamedLevel->SetIsRequestingUnloadAndRemoval(true);
-			StreamedLevel = nullptr;
+			DiscardSurfaceContent();
 			StreamingState = EPlanetStreamingState::Idle;
 		}
 		return;
 	}
 
+	// Warm while the player is still approaching, so the handoff rarely has to wait for it.
+	UpdateContentWarmUp();
+
 	// Avoid flip-flop: require cooldown after stream-out before allowing transition back to surface.
 	if (TimeSinceStreamOut < StreamOutReentryCooldownSeconds) return;
 
@@ -488,16 +854,15 @@ void UPlanetSurfaceStreamer::UpdateLoadingState()
 	if (bFadeActive && CurrentRevealProgress < HandoffMinRevealProgress) return;
 	if (!TryAcquireTransitionLock()) return;
 
-	TransitionPlayerToSurface();
-	StreamingState = EPlanetStreamingState::OnSurface;
-	if (AFederationGameState* GS = GetWorld() ? GetWorld()->GetGameState<AFederationGameState>() : nullptr)
+	UE_LOG(LogTemp, Warning, TEXT("PlanetSurfaceStreamer: === HANDOVER === dist=%.0f, handoff=%.0f, streaming=%.0f, reveal=%.2f"), Dist, HandoffR, StreamR, CurrentRevealProgress);
+	if (HandoffArrivalTime >= 0.f)
 	{
-		GS->DebugStreamingState = TEXT("OnSurface");
-		GS->DebugStreamingLevelName = FPaths::GetBaseFilename(SurfaceLevelPath);
+		const float WaitSeconds = Now - HandoffArrivalTime;
+		RecordTransitionTelemetry(EPlanetStreamingMetric::RevealWait, WaitSeconds, WaitSeconds > PlanetSurfaceStreamer::RevealWaitStallSeconds);
+		HandoffArrivalTime = -1.f;
 	}
-	OnSurfaceLoaded.Broadcast();
-
-	UE_LOG(LogTemp, Warning, TEXT("PlanetSurfaceStreamer: === HANDOVER === dist=%.0f, handoff=%.0f, streaming=%.0f, reveal=%.2f"), Dist, HandoffR, StreamR, CurrentRevealProgress);
+	BeginSurfaceHandoff(PlayerPawn);
+	AdvanceSurfaceHandoff();
 }
 
 void UPlanetSurfaceStreamer::UpdateOnSurfaceState()
@@ -513,6 +878,12 @@ void UPlanetSurfaceStreamer::UpdateOnSurfaceState()
 	if (ShouldStreamOut(PlayerPawn->GetActorLocation(), SurfaceLevelWorldOrigin))
 	{
 		BeginStreamOut();
+		return;
+	}
+
+	if (bUseCellGrid)
+	{
+		UpdateSurfaceCells(PlayerPawn);
 	}
 }
 
@@ -526,19 +897,32 @@ void UPlanetSurfaceStreamer::UpdateUnloadingState()
 
 	if (!StreamedLevel->HasLoadedLevel())
 	{
-		ReleaseTransitionLock();
-		StreamedLevel = nullptr;
-		StreamingState = EPlanetStreamingState::Idle;
-		if (AFederationGameState* GS = GetWorld() ? GetWorld()->GetGameState<AFederationGameState>() : nullptr)
-		{
-			GS->DebugStreamingState = TEXT("Idle");
-			GS->DebugStreamingLevelName = FString();
-		}
-		OnSurfaceUnloaded.Broadcast();
+		RecordTransitionTelemetry(EPlanetStreamingMetric::Unload, (GetWorld() ? GetWorld()->GetTimeSeconds() : 0.f) - UnloadStartTime, false);
+		CompleteSurfaceUnload();
 		UE_LOG(LogTemp, Log, TEXT("PlanetSurfaceStreamer: Surface level unloaded, player returned to space."));
 	}
 }
 
+void UPlanetSurfaceStreamer::CompleteSurfaceUnload()
+{
+	ReleaseSurfaceCells();
+	ReleaseTransitionLock();
+	ContentWarmUp.Reset();
+	if (GeneratedTile)
+	{
+		GeneratedTile->Destroy();
+		GeneratedTile = nullptr;
+	}
+	StreamedLevel = nullptr;
+	StreamingState = EPlanetStreamingState::Idle;
+	if (AFederationGameState* GS = GetWorld() ? GetWorld()->GetGameState<AFederationGameState>() : nullptr)
+	{
+		GS->DebugStreamingState = TEXT("Idle");
+		GS->DebugStreamingLevelName = FString();
+	}
+	OnSurfaceUnloaded.Broadcast();
+}
+
 // ---------------------------------------------------------------------------
 // Streaming operations
 // ---------------------------------------------------------------------------
@@ -560,12 +944,27 @@ void UPlanetSurfaceStreamer::BeginStreamIn()
 		SaveSpacePosition(PlayerPawn->GetActorLocation(), PlayerPawn->GetActorRotation());
 	}
 
-	const AActor* Owner = GetOwner();
-	const FVector PlanetCenter = Owner ? Owner->GetActorLocation() : FVector::ZeroVector;
+	const FVector PlanetCenter = GetPlanetCenter();
 	const float PlanetRadius = GetPlanetRadiusFromOwner();
+	SurfaceLoadPriority = 0;
+	ContentWarmUp.Reset();
 
-	// Determine anchor direction: explicit override or player approach direction.
+	// Determine anchor direction: explicit override, our own pooled instance's anchor (the coordinate
+	// mapping handles any approach angle, and keeping it avoids moving the level), predicted entry
+	// point, or player approach direction.
+	UPlanetStreamingSubsystem* StreamingManager = World->GetSubsystem<UPlanetStreamingSubsystem>();
 	FVector AnchorDir = SurfaceAnchorDirection.GetSafeNormal();
+	if (AnchorDir.IsNearlyZero() && StreamingManager && !bUseCellGrid)
+	{
+		if (const ULevelStreamingDynamic* OwnPooled = StreamingManager->FindPooledSurfaceLevel(SurfaceLevelPath, this))
+		{
+			AnchorDir = (OwnPooled->LevelTransform.GetLocation() - PlanetCenter).GetSafeNormal();
+		}
+	}
+	if (AnchorDir.IsNearlyZero())
+	{
+		AnchorDir = PredictedAnchorDirection;
+	}
 	if (AnchorDir.IsNearlyZero() && PlayerPawn)
 	{
 		AnchorDir = (PlayerPawn->GetActorLocation() - PlanetCenter).GetSafeNormal();
@@ -574,17 +973,63 @@ void UPlanetSurfaceStreamer::BeginStreamIn()
 	{
 		AnchorDir = FVector::UpVector;
 	}
-	const FVector LevelLoadLocation = (PlanetRadius > 0.f)
-		? PlanetCenter + AnchorDir * PlanetRadius
-		: PlanetCenter;
+
+	// Cell grid: land on the cell under the anchor, with the tile centered on that cell.
+	StreamedLevelPath = SurfaceLevelPath;
+	if (bUseCellGrid)
+	{
+		const FPlanetCellGrid Grid = GetCellGrid();
+		ActiveSurfaceCell = Grid.CellFromDirection(AnchorDir);
+		AnchorDir = Grid.GetCellCenterDirection(ActiveSurfaceCell);
+		StreamedLevelPath = GetCellLevelPath(ActiveSurfaceCell);
+	}
+
+	FVector LevelLoadLocation;
+	const FTransform LevelTransform = MakeSurfaceLevelTransform(PlanetCenter, AnchorDir, LevelLoadLocation);
 	SurfaceLevelWorldOrigin = LevelLoadLocation;
 	ComputeTangentFrame(PlanetCenter);
-	const FRotator LevelRotation = FRotationMatrix::MakeFromXY(TangentX, TangentY).Rotator();
-	const float EffectiveScale = (SurfaceLevelScaleMultiplier > 0.f) ? SurfaceLevelScaleMultiplier : ComputeAutoSurfaceLevelScale();
-	const FVector Scale3D(EffectiveScale);
-	const FTransform LevelTransform(FQuat(LevelRotation), LevelLoadLocation, Scale3D);
+	const float EffectiveScale = LevelTransform.GetScale3D().X;
+
+	if (bUseProceduralTerrain)
+	{
+		GeneratedTile = SpawnTerrainTile(AnchorDir);
+		if (GeneratedTile)
+		{
+			StreamingState = EPlanetStreamingState::Loading;
+			TimeSinceStreamOut = StreamOutReentryCooldownSeconds;
+			LoadingStartTime = World->GetTimeSeconds();
+			SurfaceLoadSeconds = -1.f;
+			bLoadTelemetryPending = true;
+			HandoffArrivalTime = -1.f;
+			UE_LOG(LogTemp, Log, TEXT("PlanetSurfaceStreamer: === GENERATE START === %d chunks, seed %d, half extent %.0f"),
+				GeneratedTile->GetNumChunks(), TerrainSettings.Seed, GetDesiredPatchRadius());
+		}
+		else
+		{
+			UE_LOG(LogTemp, Error, TEXT("PlanetSurfaceStreamer: Failed to spawn generated terrain tile."));
+		}
+		return;
+	}
 
-	const FSoftObjectPath LevelPath(SurfaceLevelPath);
+	// Reuse a hidden, still-loaded instance when one is pooled.
+	float PooledLoadSeconds = 0.f;
+	StreamedLevel = StreamingManager ? StreamingManager->AcquirePooledSurfaceLevel(StreamedLevelPath, LevelTransform, PooledLoadSeconds) : nullptr;
+	if (StreamedLevel)
+	{
+		StreamedLevel->SetShouldBeLoaded(true);
+		StreamedLevel->SetShouldBeVisible(true);
+		StreamingState = EPlanetStreamingState::Loading;
+		TimeSinceStreamOut = StreamOutReentryCooldownSeconds;
+		LoadingStartTime = World->GetTimeSeconds();
+		SurfaceLoadSeconds = PooledLoadSeconds;
+		bLoadTelemetryPending = true;
+		HandoffArrivalTime = -1.f;
+		UE_LOG(LogTemp, Log, TEXT("PlanetSurfaceStreamer: === STREAM REUSE === level='%s' from pool (saved ~%.2fs load)"), *StreamedLevelPath, PooledLoadSeconds);
+		return;
+	}
+	SurfaceLoadSeconds = -1.f;
+
+	const FSoftObjectPath LevelPath(StreamedLevelPath);
 	TSoftObjectPtr<UWorld> LevelPtr{ LevelPath };
 	bool bSuccess = false;
 	StreamedLevel = ULevelStreamingDynamic::LoadLevelInstanceBySoftObjectPtr(
@@ -601,104 +1046,282 @@ void UPlanetSurfaceStreamer::BeginStreamIn()
 		StreamingState = EPlanetStreamingState::Loading;
 		TimeSinceStreamOut = StreamOutReentryCooldownSeconds; // Allow immediate transition on first approach.
 		LoadingStartTime = World ? World->GetTimeSeconds() : 0.f;
+		bLoadTelemetryPending = true;
+		HandoffArrivalTime = -1.f;
 		// Game state (Loading/level name) is set in UpdateLoadingState only when close, so HUD shows "Deep Space" when far
-		UE_LOG(LogTemp, Warning, TEXT("PlanetSurfaceStreamer: === STREAM START === level='%s' at surface pos (%.0f, %.0f, %.0f), planet radius=%.0f, scale=%.3f (auto=%s), exitAlt=%.0f"), *SurfaceLevelPath, LevelLoadLocation.X, LevelLoadLocation.Y, LevelLoadLocation.Z, PlanetRadius, EffectiveScale, SurfaceLevelScaleMultiplier <= 0.f ? TEXT("yes") : TEXT("no"), GetEffectiveExitAltitude());
+		UE_LOG(LogTemp, Warning, TEXT("PlanetSurfaceStreamer: === STREAM START === level='%s' at surface pos (%.0f, %.0f, %.0f), planet radius=%.0f, scale=%.3f (auto=%s), exitAlt=%.0f"), *StreamedLevelPath, LevelLoadLocation.X, LevelLoadLocation.Y, LevelLoadLocation.Z, PlanetRadius, EffectiveScale, SurfaceLevelScaleMultiplier <= 0.f ? TEXT("yes") : TEXT("no"), GetEffectiveExitAltitude());
 	}
 	else
 	{
-		UE_LOG(LogTemp, Error, TEXT("PlanetSurfaceStreamer: Failed to begin streaming '%s'. Create a level at Content/Planets/PlanetSurface_Test (save as PlanetSurface_Test) or set SurfaceLevelPath to your level's package name."), *SurfaceLevelPath);
+		UE_LOG(LogTemp, Error, TEXT("PlanetSurfaceStreamer: Failed to begin streaming '%s'. Create a level at Content/Planets/PlanetSurface_Test (save as PlanetSurface_Test) or set SurfaceLevelPath to your level's package name."), *StreamedLevelPath);
 		StreamedLevel = nullptr;
 	}
 }
 
-void UPlanetSurfaceStreamer::TransitionPlayerToSurface()
+void UPlanetSurfaceStreamer::BeginSurfaceHandoff(APawn* Pawn)
 {
-	APawn* PlayerPawn = GetPlayerPawn();
-	if (!PlayerPawn) return;
-
-	AActor* Owner = GetOwner();
-	AFederationCharacter* FedChar = Cast<AFederationCharacter>(PlayerPawn);
-	ACharacter* Char = Cast<ACharacter>(PlayerPawn);
-	UPlanetGravityComponent* GravComp = PlayerPawn->FindComponentByClass<UPlanetGravityComponent>();
-	APlayerController* PC = Char ? Cast<APlayerController>(Char->GetController()) : nullptr;
-
-	// --- 1. Capture full world-space view orientation before any state changes ---
-	LastTransitionOrientation = CaptureCurrentViewOrientation();
+	if (!Pawn) return;
 
-	// --- 2. Surface origin and tangent frame are fixed at the geographic anchor
-	// set during BeginStreamIn. The coordinate mapping handles placing the player
-	// at the correct surface position regardless of approach angle.
+	HandoffPawn = Pawn;
+	HandoffStage = EPlanetHandoffStage::PrewarmVisibility;
+	HandoffPrewarmFrames = 0;
+	HandoffTimings = FPlanetHandoffTimings();
+	HandoffStageStartSeconds = -1.0;
+}
 
-	// --- 3. Capture incoming velocity ---
-	const FVector IncomingVelocity = PlayerPawn->GetVelocity();
+bool UPlanetSurfaceStreamer::AdvanceSurfaceHandoff()
+{
+	if (!IsHandoffInProgress()) return false;
 
-	// --- 4. Position player on surface level (altitude mirrors space distance) ---
-	PlayerPawn->SetActorLocation(SpaceToSurfacePosition(PlayerPawn->GetActorLocation()));
+	APawn* Pawn = HandoffPawn.Get();
+	if (!Pawn)
+	{
+		AbortSurfaceHandoff();
+		return false;
+	}
 
-	// --- 5. Hide planet shell (should already be nearly invisible from fade) ---
-	if (Owner)
+	++HandoffTimings.Frames;
+	const double FrameStart = FPlatformTime::Seconds();
+	double FrameMs = 0.0;
+	do
 	{
-		Owner->SetActorHiddenInGame(true);
-		Owner->SetActorEnableCollision(false);
+		const EPlanetHandoffStage Stage = HandoffStage;
+		const int32 StageIndex = static_cast<int32>(Stage);
+		const double StageStart = FPlatformTime::Seconds();
+		if (HandoffStageStartSeconds < 0.0)
+		{
+			HandoffStageStartSeconds = StageStart;
+		}
+		const bool bStageDone = RunHandoffStage(Stage, Pawn);
+		const double StageEnd = FPlatformTime::Seconds();
+		const float StageMs = static_cast<float>((StageEnd - StageStart) * 1000.0);
+
+		HandoffTimings.StageMs[StageIndex] = FMath::Max(HandoffTimings.StageMs[StageIndex], StageMs);
+		HandoffTimings.StageTotalMs[StageIndex] += StageMs;
+		++HandoffTimings.StageFrames[StageIndex];
+		FrameMs = (StageEnd - FrameStart) * 1000.0;
+		if (!bStageDone) break;
+
+		HandoffTimings.StageSeconds[StageIndex] = static_cast<float>(StageEnd - HandoffStageStartSeconds);
+		HandoffStageStartSeconds = -1.0;
+		HandoffStage = static_cast<EPlanetHandoffStage>(static_cast<uint8>(Stage) + 1);
 	}
+	while (HandoffStage != EPlanetHandoffStage::Count && FrameMs < HandoffFrameBudgetMs);
+
+	HandoffTimings.WorstFrameMs = FMath::Max(HandoffTimings.WorstFrameMs, static_cast<float>(FrameMs));
 
-	// --- 6. Switch to surface gravity + preserve velocity ---
+	if (HandoffStage != EPlanetHandoffStage::Count) return false;
+	FinishSurfaceHandoff();
+	return true;
+}
+
+bool UPlanetSurfaceStreamer::RunHandoffStage(EPlanetHandoffStage Stage, APawn* Pawn)
+{
+	AActor* Owner = GetOwner();
+	ACharacter* Char = Cast<ACharacter>(Pawn);
+	UPlanetGravityComponent* GravComp = Pawn->FindComponentByClass<UPlanetGravityComponent>();
 	const FVector SurfaceUp = TangentNormal;
 	const FVector SurfaceDown = -TangentNormal;
 
-	if (Char && Char->GetCharacterMovement())
+	switch (Stage)
 	{
-		Char->GetCharacterMovement()->SetGravityDirection(SurfaceDown);
-		Char->GetCharacterMovement()->GravityScale = 1.f;
-		const float DownSpeed = FMath::Max(0.f, -FVector::DotProduct(IncomingVelocity, SurfaceUp));
-		const FVector TangentVelocity = IncomingVelocity - FVector::DotProduct(IncomingVelocity, SurfaceUp) * SurfaceUp;
-		Char->GetCharacterMovement()->Velocity = TangentVelocity + SurfaceDown * DownSpeed;
+	case EPlanetHandoffStage::PrewarmVisibility:
+	{
+		SCOPE_CYCLE_COUNTER(STAT_PlanetHandoff_PrewarmVisibility);
+		if (GeneratedTile)
+		{
+			return GeneratedTile->IsGenerationComplete() || ++HandoffPrewarmFrames > HandoffMaxPrewarmFrames;
+		}
+		if (!StreamedLevel || StreamedLevel->IsLevelVisible()) return true;
+
+		// Level streaming makes the level visible incrementally; wait for it instead of flushing.
+		StreamedLevel->SetShouldBeVisible(true);
+		return ++HandoffPrewarmFrames > HandoffMaxPrewarmFrames;
 	}
 
-	// --- 7. Preserve forward exactly, blend roll to local horizon at handoff ---
-	FQuat SurfaceViewQuat = LastTransitionOrientation.bIsValid
-		? ComputeForwardPriorityBlendedViewQuat(LastTransitionOrientation.ViewQuat, SurfaceUp, 1.f)
-		: FQuat::Identity;
+	case EPlanetHandoffStage::WarmUpContent:
+	{
+		SCOPE_CYCLE_COUNTER(STAT_PlanetHandoff_WarmUpContent);
+		// Forced residency from a warm-up long ago has lapsed; ask again (already resident content is done at once).
+		if (ContentWarmUp.IsActive() && FPlatformTime::Seconds() - ContentWarmUpStartSeconds > PlanetSurfaceStreamer::WarmUpResidentSeconds)
+		{
+			BeginContentWarmUp();
+		}
+		UpdateContentWarmUp();
+		if (!IsSurfaceContentWarm()) return false;
+
+		HandoffTimings.WarmUpRequests = ContentWarmUp.GetNumRequests();
+		HandoffTimings.WarmUpOutstanding = ContentWarmUp.GetNumOutstanding();
+		HandoffTimings.WarmUpSeconds = ContentWarmUpSeconds >= 0.f
+			? ContentWarmUpSeconds : static_cast<float>(FPlatformTime::Seconds() - ContentWarmUpStartSeconds);
+		if (HandoffTimings.WarmUpRequests > 0)
+		{
+			RecordTransitionTelemetry(EPlanetStreamingMetric::WarmUp, HandoffTimings.WarmUpSeconds, HandoffTimings.WarmUpOutstanding > 0);
+		}
+		return true;
+	}
 
-	if (!LastTransitionOrientation.bIsValid && PC)
+	case EPlanetHandoffStage::SettlePhysics:
 	{
-		SurfaceViewQuat = PC->GetControlRotation().Quaternion();
+		SCOPE_CYCLE_COUNTER(STAT_PlanetHandoff_SettlePhysics);
+		if (Owner)
+		{
+			Owner->SetActorEnableCollision(false);
+		}
+		// Radial gravity off; the CMC keeps its last direction until the teleport stage sets surface gravity.
+		if (GravComp)
+		{
+			GravComp->SetComponentTickEnabled(false);
+		}
+		// Pick who comes along now; they're read and moved together with the player in the teleport stage.
+		CarriedActors.Gather(GetWorld(), Pawn->GetActorLocation(), CarryActorsRadius, Owner, Pawn);
+		return true;
 	}
 
-	const FRotator SurfaceControlRotation = SurfaceViewQuat.Rotator();
-	if (FedChar && FedChar->FirstPersonCameraRoot)
+	case EPlanetHandoffStage::Teleport:
 	{
-		FedChar->FirstPersonCameraRoot->SetWorldRotation(SurfaceViewQuat);
-		FedChar->FirstPersonCameraRoot->SetRelativeRotation(FRotator::ZeroRotator);
+		SCOPE_CYCLE_COUNTER(STAT_PlanetHandoff_Teleport);
+
+		// Capture the view before the move; the surface origin and tangent frame were fixed in BeginStreamIn.
+		LastTransitionOrientation = CaptureViewOrientation(Pawn);
+		const FVector IncomingVelocity = Pawn->GetVelocity();
+
+		// Altitude mirrors space distance; over generated terrain, never below the ground.
+		FVector SurfacePos = SpaceToSurfacePosition(Pawn->GetActorLocation());
+		if (GeneratedTile)
+		{
+			const FVector Dir = (Pawn->GetActorLocation() - GetPlanetCenter()).GetSafeNormal();
+			const float Ground = FPlanetTerrainGenerator(TerrainSettings, GetPlanetRadiusFromOwner()).SampleHeight(Dir);
+			const float TileAltitude = FVector::DotProduct(SurfacePos - SurfaceLevelWorldOrigin, TangentNormal);
+			SurfacePos += TangentNormal * FMath::Max(0.f, Ground + PlanetSurfaceStreamer::MinSurfaceAltitude - TileAltitude);
+		}
+		CarriedActors.MoveToSurface(GetSurfaceMapping());
+		Pawn->SetActorLocation(SurfacePos);
+
+		// Planet shell should already be nearly invisible from the fade.
+		if (Owner)
+		{
+			Owner->SetActorHiddenInGame(true);
+		}
+
+		// Surface gravity, keeping tangential speed and any downward speed.
+		if (Char && Char->GetCharacterMovement())
+		{
+			Char->GetCharacterMovement()->SetGravityDirection(SurfaceDown);
+			Char->GetCharacterMovement()->GravityScale = 1.f;
+			const float DownSpeed = FMath::Max(0.f, -FVector::DotProduct(IncomingVelocity, SurfaceUp));
+			const FVector TangentVelocity = IncomingVelocity - FVector::DotProduct(IncomingVelocity, SurfaceUp) * SurfaceUp;
+			Char->GetCharacterMovement()->Velocity = TangentVelocity + SurfaceDown * DownSpeed;
+		}
+		if (GravComp)
+		{
+			GravComp->GravityDir = SurfaceDown;
+			GravComp->SetSurfaceBlendAlpha(1.f);
+		}
+		return true;
 	}
 
-	if (Char)
+	case EPlanetHandoffStage::RestoreCamera:
 	{
-		Char->bUseControllerRotationYaw = true;
-		Char->bUseControllerRotationPitch = true;
-		Char->bUseControllerRotationRoll = true;
-		Char->SetActorRotation(SurfaceViewQuat);
+		SCOPE_CYCLE_COUNTER(STAT_PlanetHandoff_RestoreCamera);
+		AFederationCharacter* FedChar = Cast<AFederationCharacter>(Pawn);
+		APlayerController* PC = Char ? Cast<APlayerController>(Char->GetController()) : nullptr;
+
+		// Preserve forward exactly, blend roll to local horizon.
+		FQuat SurfaceViewQuat = LastTransitionOrientation.bIsValid
+			? ComputeForwardPriorityBlendedViewQuat(LastTransitionOrientation.ViewQuat, SurfaceUp, 1.f)
+			: FQuat::Identity;
+
+		if (!LastTransitionOrientation.bIsValid && PC)
+		{
+			SurfaceViewQuat = PC->GetControlRotation().Quaternion();
+		}
+
+		const FRotator SurfaceControlRotation = SurfaceViewQuat.Rotator();
+		if (FedChar && FedChar->FirstPersonCameraRoot)
+		{
+			FedChar->FirstPersonCameraRoot->SetWorldRotation(SurfaceViewQuat);
+			FedChar->FirstPersonCameraRoot->SetRelativeRotation(FRotator::ZeroRotator);
+		}
+
+		if (Char)
+		{
+			Char->bUseControllerRotationYaw = true;
+			Char->bUseControllerRotationPitch = true;
+			Char->bUseControllerRotationRoll = true;
+			Char->SetActorRotation(SurfaceViewQuat);
+		}
+		if (PC)
+		{
+			PC->SetControlRotation(SurfaceControlRotation);
+		}
+		if (GravComp)
+		{
+			GravComp->bViewInitialized = false;
+		}
+		return true;
+	}
+
+	default:
+		return true;
 	}
-	if (PC)
+}
+
+void UPlanetSurfaceStreamer::FinishSurfaceHandoff()
+{
+	HandoffStage = EPlanetHandoffStage::None;
+	HandoffPawn = nullptr;
+
+	SET_FLOAT_STAT(STAT_PlanetHandoff_WorstFrameMs, HandoffTimings.WorstFrameMs);
+	SET_DWORD_STAT(STAT_PlanetHandoff_Frames, HandoffTimings.Frames);
+	RecordTransitionTelemetry(EPlanetStreamingMetric::HandoffFrame, HandoffTimings.WorstFrameMs, HandoffTimings.WorstFrameMs > HandoffFrameBudgetMs);
+
+	StreamingState = EPlanetStreamingState::OnSurface;
+	if (AFederationGameState* GS = GetWorld() ? GetWorld()->GetGameState<AFederationGameState>() : nullptr)
 	{
-		PC->SetControlRotation(SurfaceControlRotation);
+		GS->DebugStreamingState = TEXT("OnSurface");
+		GS->DebugStreamingLevelName = FPaths::GetBaseFilename(SurfaceLevelPath);
 	}
+	OnSurfaceLoaded.Broadcast();
 
-	// --- 8. Reset gravity component to surface-aligned state ---
-	if (GravComp)
+	UE_LOG(LogTemp, Log, TEXT("PlanetSurfaceStreamer: handoff done in %d frames, worst frame %.2f ms (budget %.2f ms)"),
+		HandoffTimings.Frames, HandoffTimings.WorstFrameMs, HandoffFrameBudgetMs);
+	const UEnum* StageEnum = StaticEnum<EPlanetHandoffStage>();
+	for (int32 Stage = 1; Stage < static_cast<int32>(EPlanetHandoffStage::Count); ++Stage)
 	{
-		GravComp->GravityDir = SurfaceDown;
-		GravComp->bViewInitialized = false;
-		GravComp->SetSurfaceBlendAlpha(1.f);
+		UE_LOG(LogTemp, Log, TEXT("PlanetSurfaceStreamer:   %s: %.3f s over %d frames, %.2f ms game thread (worst %.2f ms)"),
+			*StageEnum->GetNameStringByValue(Stage), HandoffTimings.StageSeconds[Stage], HandoffTimings.StageFrames[Stage],
+			HandoffTimings.StageTotalMs[Stage], HandoffTimings.StageMs[Stage]);
+	}
+	if (HandoffTimings.WarmUpOutstanding > 0)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("PlanetSurfaceStreamer: warm-up deadline hit with %d of %d requests outstanding (%.2f s)"),
+			HandoffTimings.WarmUpOutstanding, HandoffTimings.WarmUpRequests, HandoffTimings.WarmUpSeconds);
 	}
-	SetPlayerGravityComponentActive(false);
+}
+
+void UPlanetSurfaceStreamer::AbortSurfaceHandoff()
+{
+	// Player went away mid-handoff (possession change, pawn destroyed): stay in Loading and retry later.
+	HandoffStage = EPlanetHandoffStage::None;
+	HandoffPawn = nullptr;
+	if (AActor* Owner = GetOwner())
+	{
+		Owner->SetActorHiddenInGame(false);
+		Owner->SetActorEnableCollision(true);
+	}
+	ReleaseTransitionLock();
+	UE_LOG(LogTemp, Warning, TEXT("PlanetSurfaceStreamer: handoff aborted, player pawn lost."));
 }
 
 void UPlanetSurfaceStreamer::BeginStreamOut()
 {
 	TransitionPlayerToSpace();
+	// Only the active cell stays up for the view from orbit.
+	ReleaseSurfaceCells();
 
 	TimeSinceStreamOut = 0.f;
+	HandoffArrivalTime = -1.f;
 
 	// Keep the level loaded and visible so the player can see it in deep space
 	// as they fly away. It will be unloaded when they leave streaming range.
@@ -728,7 +1351,9 @@ void UPlanetSurfaceStreamer::TransitionPlayerToSpace()
 	ResetPlanetRevealParams();
 	CurrentRevealProgress = 0.f;
 
-	// --- 3. Place player at matching distance from planet surface ---
+	// --- 3. Place player (and whoever is with them) at matching distance from planet surface ---
+	CarriedActors.Gather(GetWorld(), PlayerPawn->GetActorLocation(), CarryActorsRadius, Owner, PlayerPawn);
+	CarriedActors.MoveToSpace(GetSurfaceMapping());
 	PlayerPawn->SetActorLocation(SurfaceToSpacePosition(PlayerPawn->GetActorLocation()));
 
 	// --- 4. Restore gravity-relative look with preserved forward direction ---
@@ -769,75 +1394,409 @@ void UPlanetSurfaceStreamer::TransitionPlayerToSpace()
 	ReleaseTransitionLock();
 }
 
+// ---------------------------------------------------------------------------
+// Surface cells (cell grid mode)
+// ---------------------------------------------------------------------------
+
+FString UPlanetSurfaceStreamer::GetCellLevelPath(const FPlanetCellId& Cell) const
+{
+	if (CellLevelPaths.Num() == 0)
+	{
+		return SurfaceLevelPath;
+	}
+	const FString& Variant = CellLevelPaths[GetTypeHash(Cell) % static_cast<uint32>(CellLevelPaths.Num())];
+	return Variant.IsEmpty() ? SurfaceLevelPath : Variant;
+}
+
+void UPlanetSurfaceStreamer::UpdateSurfaceCells(APawn* PlayerPawn)
+{
+	QUICK_SCOPE_CYCLE_COUNTER(STAT_PlanetSurfaceStreamer_UpdateSurfaceCells);
+
+	UWorld* World = GetWorld();
+	const FPlanetCellGrid Grid = GetCellGrid();
+	if (!World || !PlayerPawn || !Grid.IsValidCell(ActiveSurfaceCell)) return;
+
+	const FVector PlanetCenter = GetPlanetCenter();
+
+	// Re-base once the player is clearly inside another cell whose tile is already visible.
+	// Walking back and forth along a border never flips the frame: the margin has to be crossed first.
+	const FVector PlayerDir = (SurfaceToSpacePosition(PlayerPawn->GetActorLocation()) - PlanetCenter).GetSafeNormal();
+	const FPlanetCellId UnderPlayer = Grid.CellFromDirection(PlayerDir);
+	if (UnderPlayer != ActiveSurfaceCell)
+	{
+		const double ActiveAngle = FMath::Acos(FMath::Clamp(FVector::DotProduct(PlayerDir, Grid.GetCellCenterDirection(ActiveSurfaceCell)), -1.0, 1.0));
+		const double UnderAngle = FMath::Acos(FMath::Clamp(FVector::DotProduct(PlayerDir, Grid.GetCellCenterDirection(UnderPlayer)), -1.0, 1.0));
+		const FStreamedSurfaceCell* Target = SurfaceCells.FindByPredicate([&UnderPlayer](const FStreamedSurfaceCell& Entry) { return Entry.Cell == UnderPlayer; });
+		const bool bTargetVisible = Target
+			&& ((Target->Level.IsValid() && Target->Level->IsLevelVisible())
+				|| (Target->Tile.IsValid() && Target->Tile->IsGenerationComplete()));
+		// Angle difference grows twice as fast as the distance past the border.
+		if (bTargetVisible && ActiveAngle - UnderAngle > 2.0 * CellRebaseHysteresis * Grid.GetCellAngle())
+		{
+			RebaseToSurfaceCell(UnderPlayer, PlayerPawn);
+		}
+	}
+
+	// Cells between the in and out rings are kept but not requested, so a player pacing near a ring
+	// boundary doesn't load and drop the same tiles.
+	const int32 InRing = FMath::Max(0, CellStreamInRing);
+	const int32 OutRing = FMath::Max(InRing, CellStreamOutRing);
+	TMap<FPlanetCellId, int32> Rings;
+	Grid.GatherCellsInRings(ActiveSurfaceCell, OutRing, Rings);
+
+	for (int32 i = SurfaceCells.Num() - 1; i >= 0; --i)
+	{
+		FStreamedSurfaceCell& Entry = SurfaceCells[i];
+		const bool bLoaded = (Entry.Level.IsValid() && Entry.Level->HasLoadedLevel())
+			|| (Entry.Tile.IsValid() && Entry.Tile->IsGenerationComplete());
+		if (bLoaded && Entry.LoadSeconds < 0.f)
+		{
+			Entry.LoadSeconds = static_cast<float>(World->GetTimeSeconds() - Entry.RequestTime);
+		}
+		// A failed request (no level) stays listed so it isn't retried every frame while in range.
+		if (Rings.Contains(Entry.Cell) && Entry.Cell != ActiveSurfaceCell) continue;
+
+		ReleaseSurfaceCell(Entry);
+		SurfaceCells.RemoveAtSwap(i);
+	}
+
+	UPlanetStreamingSubsystem* StreamingManager = World->GetSubsystem<UPlanetStreamingSubsystem>();
+	for (int32 Request = 0; Request < PlanetSurfaceStreamer::MaxCellRequestsPerTick; ++Request)
+	{
+		// Nearest missing cell first.
+		const FPlanetCellId* Next = nullptr;
+		int32 NextRing = InRing + 1;
+		for (const TPair<FPlanetCellId, int32>& Pair : Rings)
+		{
+			if (Pair.Value == 0 || Pair.Value >= NextRing) continue;
+			if (SurfaceCells.ContainsByPredicate([&Pair](const FStreamedSurfaceCell& Entry) { return Entry.Cell == Pair.Key; })) continue;
+			Next = &Pair.Key;
+			NextRing = Pair.Value;
+		}
+		if (!Next) return;
+
+		FStreamedSurfaceCell& Entry = SurfaceCells.AddDefaulted_GetRef();
+		Entry.Cell = *Next;
+		Entry.LevelPath = GetCellLevelPath(*Next);
+		Entry.RequestTime = World->GetTimeSeconds();
+
+		if (bUseProceduralTerrain)
+		{
+			Entry.Tile = SpawnTerrainTile(Grid.GetCellCenterDirection(*Next));
+			continue;
+		}
+
+		// Laid out in the active cell's frame rather than on the sphere, so the ground runs on flat across the border.
+		FPlanetTerrainTileFrame CellFrame;
+		const FTransform CellTransform = MakeSurfaceCellTransform(Grid.GetCellCenterDirection(*Next), CellFrame);
+		float PooledLoadSeconds = 0.f;
+		ULevelStreamingDynamic* Level = StreamingManager ? StreamingManager->AcquirePooledSurfaceLevel(Entry.LevelPath, CellTransform, PooledLoadSeconds) : nullptr;
+		if (Level)
+		{
+			Entry.LoadSeconds = PooledLoadSeconds;
+		}
+		else
+		{
+			bool bSuccess = false;
+			Level = ULevelStreamingDynamic::LoadLevelInstanceBySoftObjectPtr(this, TSoftObjectPtr<UWorld>(FSoftObjectPath(Entry.LevelPath)), CellTransform, bSuccess);
+			if (!bSuccess)
+			{
+				UE_LOG(LogTemp, Error, TEXT("PlanetSurfaceStreamer: Failed to stream cell %d/%d/%d level '%s'."), Next->Face, Next->X, Next->Y, *Entry.LevelPath);
+				Level = nullptr;
+			}
+		}
+		if (Level)
+		{
+			Level->SetShouldBeLoaded(true);
+			Level->SetShouldBeVisible(true);
+		}
+		Entry.Level = Level;
+	}
+}
+
+void UPlanetSurfaceStreamer::RebaseToSurfaceCell(const FPlanetCellId& Cell, APawn* Pawn)
+{
+	const FPlanetCellGrid Grid = GetCellGrid();
+	if (!Grid.IsValidCell(Cell) || Cell == ActiveSurfaceCell) return;
+
+	const FVector OldOrigin = SurfaceLevelWorldOrigin;
+	const FVector OldNormal = TangentNormal;
+	const FVector SpacePos = Pawn ? SurfaceToSpacePosition(Pawn->GetActorLocation()) : FVector::ZeroVector;
+	const float TileAltitude = Pawn ? FVector::DotProduct(Pawn->GetActorLocation() - OldOrigin, OldNormal) : 0.f;
+
+	// The new cell's level (or tile) becomes the one the player stands on; the old one joins the neighbours.
+	const int32 Index = SurfaceCells.IndexOfByPredicate([&Cell](const FStreamedSurfaceCell& Entry) { return Entry.Cell == Cell; });
+	if (Index != INDEX_NONE && (SurfaceCells[Index].Level.IsValid() || SurfaceCells[Index].Tile.IsValid()))
+	{
+		FStreamedSurfaceCell& Entry = SurfaceCells[Index];
+		ULevelStreamingDynamic* NewLevel = Entry.Level.Get();
+		APlanetTerrainTile* NewTile = Entry.Tile.Get();
+		const FString NewLevelPath = Entry.LevelPath;
+		const float NewLoadSeconds = Entry.LoadSeconds;
+		if (HasSurfaceContent())
+		{
+			Entry.Cell = ActiveSurfaceCell;
+			Entry.Level = StreamedLevel;
+			Entry.Tile = GeneratedTile;
+			Entry.LevelPath = StreamedLevelPath;
+			Entry.LoadSeconds = SurfaceLoadSeconds;
+		}
+		else
+		{
+			SurfaceCells.RemoveAtSwap(Index);
+		}
+		StreamedLevel = NewLevel;
+		GeneratedTile = NewTile;
+		StreamedLevelPath = NewLevelPath;
+		SurfaceLoadSeconds = NewLoadSeconds;
+	}
+
+	const FVector PlanetCenter = GetPlanetCenter();
+	ActiveSurfaceCell = Cell;
+	MakeSurfaceLevelTransform(PlanetCenter, Grid.GetCellCenterDirection(Cell), SurfaceLevelWorldOrigin);
+	ComputeTangentFrame(PlanetCenter);
+
+	// Every cell was laid out in the old frame; move them all into the new one.
+	PlaceSurfaceCellContent(Cell, StreamedLevel, GeneratedTile);
+	for (const FStreamedSurfaceCell& Entry : SurfaceCells)
+	{
+		PlaceSurfaceCellContent(Entry.Cell, Entry.Level.Get(), Entry.Tile.Get());
+	}
+
+	if (!Pawn) return;
+
+	// Same spot on the sphere, same height above the tile; everything else turns with the surface.
+	FVector NewLocation = SpaceToSurfacePosition(SpacePos);
+	NewLocation += TangentNormal * (TileAltitude - FVector::DotProduct(NewLocation - SurfaceLevelWorldOrigin, TangentNormal));
+	const FQuat Turn = FQuat::FindBetweenNormals(OldNormal, TangentNormal);
+	Pawn->SetActorLocationAndRotation(NewLocation, Turn * Pawn->GetActorQuat(), false, nullptr, ETeleportType::TeleportPhysics);
+
+	const FVector SurfaceDown = -TangentNormal;
+	ACharacter* Char = Cast<ACharacter>(Pawn);
+	if (Char && Char->GetCharacterMovement())
+	{
+		Char->GetCharacterMovement()->SetGravityDirection(SurfaceDown);
+		Char->GetCharacterMovement()->Velocity = Turn.RotateVector(Char->GetCharacterMovement()->Velocity);
+	}
+	if (UPlanetGravityComponent* GravComp = Pawn->FindComponentByClass<UPlanetGravityComponent>())
+	{
+		GravComp->GravityDir = SurfaceDown;
+	}
+	if (APlayerController* PC = Cast<APlayerController>(Pawn->GetController()))
+	{
+		PC->SetControlRotation((Turn * PC->GetControlRotation().Quaternion()).Rotator());
+	}
+
+	UE_LOG(LogTemp, Log, TEXT("PlanetSurfaceStreamer: surface frame re-based to cell %d/%d/%d"), Cell.Face, Cell.X, Cell.Y);
+}
+
+void UPlanetSurfaceStreamer::ReleaseSurfaceCells()
+{
+	for (const FStreamedSurfaceCell& Entry : SurfaceCells)
+	{
+		ReleaseSurfaceCell(Entry);
+	}
+	SurfaceCells.Reset();
+}
+
+void UPlanetSurfaceStreamer::ReleaseSurfaceCell(const FStreamedSurfaceCell& Entry)
+{
+	// Generated tiles are rebuilt on demand rather than pooled.
+	if (APlanetTerrainTile* Tile = Entry.Tile.Get())
+	{
+		Tile->Destroy();
+	}
+	ULevelStreamingDynamic* Level = Entry.Level.Get();
+	if (!Level) return;
+
+	// Loaded tiles go to the pool like the primary level (a step back across a ring reuses them).
+	UPlanetStreamingSubsystem* StreamingManager = GetWorld() ? GetWorld()->GetSubsystem<UPlanetStreamingSubsystem>() : nullptr;
+	if (Level->HasLoadedLevel() && StreamingManager
+		&& StreamingManager->ReleaseSurfaceLevelToPool(Level, Entry.LevelPath, this, EstimatedSurfaceMemoryMB, FMath::Max(0.f, Entry.LoadSeconds)))
+	{
+		return;
+	}
+	Level->SetShouldBeLoaded(false);
+	Level->SetShouldBeVisible(false);
+	Level->SetIsRequestingUnloadAndRemoval(true);
+}
+
 // ---------------------------------------------------------------------------
 // Helpers
 // ---------------------------------------------------------------------------
 
-void UPlanetSurfaceStreamer::ComputeTangentFrame(const FVector& PlanetCenter)
+void UPlanetSurfaceStreamer::RecordTransitionTelemetry(EPlanetStreamingMetric Metric, float Value, bool bStall) const
 {
-	TangentNormal = (SurfaceLevelWorldOrigin - PlanetCenter).GetSafeNormal();
-	if (TangentNormal.IsNearlyZero())
+	UWorld* World = GetWorld();
+	if (UPlanetStreamingSubsystem* StreamingManager = World ? World->GetSubsystem<UPlanetStreamingSubsystem>() : nullptr)
 	{
-		TangentNormal = FVector::UpVector;
+		StreamingManager->GetTelemetry().Record(Metric, Value, bStall);
 	}
+	if (!bStall) return;
 
-	const FVector UpHint = FMath::Abs(TangentNormal.Z) < 0.99f ? FVector::UpVector : FVector::ForwardVector;
-	TangentX = FVector::CrossProduct(UpHint, TangentNormal).GetSafeNormal();
-	TangentY = FVector::CrossProduct(TangentNormal, TangentX).GetSafeNormal();
+	const TCHAR* MetricName = FPlanetStreamingTelemetry::GetMetricName(Metric);
+	const TCHAR* Unit = FPlanetStreamingTelemetry::GetMetricUnit(Metric);
+	UE_LOG(LogTemp, Warning, TEXT("PlanetSurfaceStreamer: === STALL === %s took %.2f%s on '%s' (level '%s')"),
+		MetricName, Value, Unit, GetOwner() ? *GetOwner()->GetName() : TEXT("?"), *StreamedLevelPath);
+	TRACE_BOOKMARK(TEXT("Planet streaming stall: %s %.2f%s"), MetricName, Value, Unit);
 }
 
-FVector UPlanetSurfaceStreamer::SpaceToSurfacePosition(const FVector& SpacePos) const
+bool UPlanetSurfaceStreamer::IsSurfaceContentLoaded() const
 {
-	const AActor* Owner = GetOwner();
-	const FVector PlanetCenter = Owner ? Owner->GetActorLocation() : FVector::ZeroVector;
-	const float R = FMath::Max(1.f, GetPlanetRadiusFromOwner());
+	if (GeneratedTile)
+	{
+		return GeneratedTile->IsGenerationComplete();
+	}
+	return StreamedLevel && StreamedLevel->HasLoadedLevel();
+}
 
-	const FVector DirToPlayer = (SpacePos - PlanetCenter).GetSafeNormal();
-	const float Altitude = FVector::Dist(SpacePos, PlanetCenter) - R;
+void UPlanetSurfaceStreamer::BeginContentWarmUp()
+{
+	ContentWarmUpStartSeconds = FPlatformTime::Seconds();
+	ContentWarmUpSeconds = -1.f;
+	if (GeneratedTile)
+	{
+		ContentWarmUp.Begin(GeneratedTile.Get(), PlanetSurfaceStreamer::WarmUpResidentSeconds);
+	}
+	else
+	{
+		ContentWarmUp.Begin(StreamedLevel ? StreamedLevel->GetLoadedLevel() : nullptr, PlanetSurfaceStreamer::WarmUpResidentSeconds);
+	}
+}
 
-	const float DotN = FVector::DotProduct(DirToPlayer, TangentNormal);
-	const float DotX = FVector::DotProduct(DirToPlayer, TangentX);
-	const float DotY = FVector::DotProduct(DirToPlayer, TangentY);
+void UPlanetSurfaceStreamer::UpdateContentWarmUp()
+{
+	if (!ContentWarmUp.IsActive())
+	{
+		BeginContentWarmUp();
+	}
+	if (ContentWarmUpSeconds < 0.f && ContentWarmUp.Update() == 0)
+	{
+		ContentWarmUpSeconds = static_cast<float>(FPlatformTime::Seconds() - ContentWarmUpStartSeconds);
+	}
+}
 
-	const float Azimuth = FMath::Atan2(DotX, DotN);
-	const float Elevation = FMath::Atan2(DotY, DotN);
+bool UPlanetSurfaceStreamer::IsSurfaceContentWarm() const
+{
+	if (!ContentWarmUp.IsActive() || ContentWarmUpSeconds >= 0.f) return true;
+	return FPlatformTime::Seconds() - ContentWarmUpStartSeconds >= HandoffWarmUpTimeoutSeconds;
+}
 
-	const float LocalX = Azimuth * R;
-	const float LocalY = Elevation * R;
-	const float LocalZ = FMath::Max(300.f, Altitude);
+void UPlanetSurfaceStreamer::DiscardSurfaceContent()
+{
+	ContentWarmUp.Reset();
+	if (StreamedLevel)
+	{
+		StreamedLevel->SetShouldBeLoaded(false);
+		StreamedLevel->SetShouldBeVisible(false);
+		StreamedLevel->SetIsRequestingUnloadAndRemoval(true);
+		StreamedLevel = nullptr;
+	}
+	if (GeneratedTile)
+	{
+		GeneratedTile->Destroy();
+		GeneratedTile = nullptr;
+	}
+}
 
-	return SurfaceLevelWorldOrigin + TangentX * LocalX + TangentY * LocalY + TangentNormal * LocalZ;
+APlanetTerrainTile* UPlanetSurfaceStreamer::SpawnTerrainTile(const FVector& AnchorDir)
+{
+	UWorld* World = GetWorld();
+	if (!World) return nullptr;
+
+	FPlanetTerrainTileFrame Frame;
+	const FTransform TileTransform = MakeSurfaceCellTransform(AnchorDir, Frame);
+	FActorSpawnParameters Params;
+	Params.Owner = GetOwner();
+	Params.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+	// Chunks are generated in UU, so the tile itself is never scaled.
+	APlanetTerrainTile* Tile = World->SpawnActor<APlanetTerrainTile>(APlanetTerrainTile::StaticClass(),
+		FTransform(TileTransform.GetRotation(), TileTransform.GetLocation()), Params);
+	if (!Tile) return nullptr;
+
+	Tile->BeginGenerate(TerrainSettings, Frame, TerrainChunksPerTileEdge, TerrainMaterial);
+	return Tile;
 }
 
-FVector UPlanetSurfaceStreamer::SurfaceToSpacePosition(const FVector& SurfacePos) const
+void UPlanetSurfaceStreamer::PlaceSurfaceCellContent(const FPlanetCellId& Cell, ULevelStreamingDynamic* Level, APlanetTerrainTile* Tile)
 {
-	const AActor* Owner = GetOwner();
-	const FVector PlanetCenter = Owner ? Owner->GetActorLocation() : FVector::ZeroVector;
-	const float R = FMath::Max(1.f, GetPlanetRadiusFromOwner());
-	const FVector Offset = SurfacePos - SurfaceLevelWorldOrigin;
+	FPlanetTerrainTileFrame Frame;
+	const FTransform CellTransform = MakeSurfaceCellTransform(GetCellGrid().GetCellCenterDirection(Cell), Frame);
+	PlanetSurfaceStreamer::PlaceSurfaceLevel(Level, CellTransform);
+	if (Tile)
+	{
+		// Heights depend on the frame, not just the placement, so the tile is rebuilt (old chunks show meanwhile).
+		Tile->SetActorTransform(FTransform(CellTransform.GetRotation(), CellTransform.GetLocation()), false, nullptr, ETeleportType::TeleportPhysics);
+		Tile->BeginGenerate(TerrainSettings, Frame, TerrainChunksPerTileEdge, TerrainMaterial);
+	}
+}
+
+void UPlanetSurfaceStreamer::ComputeTangentFrame(const FVector& PlanetCenter)
+{
+	TangentNormal = (SurfaceLevelWorldOrigin - PlanetCenter).GetSafeNormal();
+	if (TangentNormal.IsNearlyZero())
+	{
+		TangentNormal = FVector::UpVector;
+	}
+	PlanetSurfaceStreamer::MakeTangentAxes(TangentNormal, TangentX, TangentY);
+}
+
+FTransform UPlanetSurfaceStreamer::MakeSurfaceLevelTransform(const FVector& PlanetCenter, const FVector& AnchorDir, FVector& OutOrigin) const
+{
+	const float PlanetRadius = GetPlanetRadiusFromOwner();
+	OutOrigin = (PlanetRadius > 0.f) ? PlanetCenter + AnchorDir * PlanetRadius : PlanetCenter;
+
+	FVector AxisX, AxisY;
+	PlanetSurfaceStreamer::MakeTangentAxes(AnchorDir, AxisX, AxisY);
+	const float EffectiveScale = (SurfaceLevelScaleMultiplier > 0.f) ? SurfaceLevelScaleMultiplier : ComputeAutoSurfaceLevelScale();
+	return FTransform(FRotationMatrix::MakeFromXY(AxisX, AxisY).ToQuat(), OutOrigin, FVector(EffectiveScale));
+}
 
-	const float LocalX = FVector::DotProduct(Offset, TangentX);
-	const float LocalY = FVector::DotProduct(Offset, TangentY);
-	const float Altitude = FVector::DotProduct(Offset, TangentNormal);
+FTransform UPlanetSurfaceStreamer::MakeSurfaceCellTransform(const FVector& CellDir, FPlanetTerrainTileFrame& OutFrame) const
+{
+	const FPlanetSurfaceMapping Mapping = GetSurfaceMapping();
+	const FVector Offset = Mapping.SpaceToSurface(Mapping.GetPlanetCenter() + CellDir * Mapping.GetRadius()) - SurfaceLevelWorldOrigin;
+
+	OutFrame.Normal = TangentNormal;
+	OutFrame.AxisX = TangentX;
+	OutFrame.AxisY = TangentY;
+	OutFrame.PlanetRadius = Mapping.GetRadius();
+	OutFrame.HalfExtent = GetDesiredPatchRadius();
+	OutFrame.CenterX = FVector::DotProduct(Offset, TangentX);
+	OutFrame.CenterY = FVector::DotProduct(Offset, TangentY);
+
+	// Same rotation and scale as the active tile; only the in-plane offset differs.
+	FVector TangentOrigin;
+	FTransform Transform = MakeSurfaceLevelTransform(Mapping.GetPlanetCenter(), TangentNormal, TangentOrigin);
+	Transform.SetLocation(SurfaceLevelWorldOrigin + TangentX * OutFrame.CenterX + TangentY * OutFrame.CenterY);
+	return Transform;
+}
 
-	const float AngleX = LocalX / R;
-	const float AngleY = LocalY / R;
+FPlanetSurfaceMapping UPlanetSurfaceStreamer::GetSurfaceMapping() const
+{
+	return FPlanetSurfaceMapping(GetPlanetCenter(), GetPlanetRadiusFromOwner(), SurfaceLevelWorldOrigin,
+		TangentNormal, TangentX, TangentY, PlanetSurfaceStreamer::MinSurfaceAltitude);
+}
 
-	// Rodrigues rotation: rotate TangentNormal around TangentY by AngleX,
-	// then around TangentX by -AngleY to get the sphere direction.
-	FVector Dir = TangentNormal;
-	Dir = Dir.RotateAngleAxis(FMath::RadiansToDegrees(AngleX), TangentY);
-	Dir = Dir.RotateAngleAxis(-FMath::RadiansToDegrees(AngleY), TangentX);
-	Dir = Dir.GetSafeNormal();
+FVector UPlanetSurfaceStreamer::SpaceToSurfacePosition(const FVector& SpacePos) const
+{
+	return GetSurfaceMapping().SpaceToSurface(SpacePos);
+}
 
-	return PlanetCenter + Dir * (R + FMath::Max(0.f, Altitude));
+FVector UPlanetSurfaceStreamer::SurfaceToSpacePosition(const FVector& SurfacePos) const
+{
+	return GetSurfaceMapping().SurfaceToSpace(SurfacePos);
 }
 
 FPlanetTransitionOrientation UPlanetSurfaceStreamer::CaptureCurrentViewOrientation() const
+{
+	return CaptureViewOrientation(GetPlayerPawn());
+}
+
+FPlanetTransitionOrientation UPlanetSurfaceStreamer::CaptureViewOrientation(const APawn* PlayerPawn) const
 {
 	FPlanetTransitionOrientation Orientation;
 
-	APawn* PlayerPawn = GetPlayerPawn();
 	if (!PlayerPawn)
 	{
 		return Orientation;
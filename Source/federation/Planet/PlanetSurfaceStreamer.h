@@ -4,12 +4,24 @@
 
 #include "CoreMinimal.h"
 #include "Components/ActorComponent.h"
+#include "Planet/PlanetActorCarrier.h"
+#include "Planet/PlanetCellGrid.h"
+#include "Planet/PlanetContentWarmUp.h"
+#include "Planet/PlanetLODMesh.h"
+#include "Planet/PlanetStreamingTelemetry.h"
+#include "Planet/PlanetMaterialParameterCache.h"
+#include "Planet/PlanetSurfaceMapping.h"
+#include "Planet/PlanetTerrainGenerator.h"
 #include "PlanetSurfaceStreamer.generated.h"
 
 class ULevelStreamingDynamic;
+class APlanetTerrainTile;
+class APlanetLODMesh;
+class UMaterialInterface;
 class UPlanetGravityComponent;
 class UStaticMeshComponent;
 class UMaterialInstanceDynamic;
+class UMaterialParameterCollection;
 class USceneComponent;
 
 USTRUCT(BlueprintType)
@@ -39,6 +51,53 @@ enum class EPlanetStreamingState : uint8
 	Unloading
 };
 
+/** Stages of the space-to-surface handoff, run in order across frames under HandoffFrameBudgetMs. */
+UENUM(BlueprintType)
+enum class EPlanetHandoffStage : uint8
+{
+	None,
+	/** Wait for the streamed surface level to become visible (no blocking flush). */
+	PrewarmVisibility,
+	/** Wait for the surface's textures, meshes and PSOs (warming since load), up to HandoffWarmUpTimeoutSeconds. */
+	WarmUpContent,
+	/** Drop planet collision and stop radial gravity on the player. */
+	SettlePhysics,
+	/** Move the player onto the surface level, hide the planet shell, switch to surface gravity. */
+	Teleport,
+	/** Align camera, actor and controller rotation to the surface. */
+	RestoreCamera,
+	Count UMETA(Hidden)
+};
+
+/** Game-thread cost of the last surface handoff (exposed for tests and profiling). */
+struct FPlanetHandoffTimings
+{
+	/** Longest single run of each stage in ms, indexed by EPlanetHandoffStage. */
+	float StageMs[static_cast<int32>(EPlanetHandoffStage::Count)] = {};
+
+	/** Game-thread ms spent in each stage over all its frames. */
+	float StageTotalMs[static_cast<int32>(EPlanetHandoffStage::Count)] = {};
+
+	/** Frames each stage ran on. */
+	int32 StageFrames[static_cast<int32>(EPlanetHandoffStage::Count)] = {};
+
+	/** Seconds from a stage's first run to its completion, waiting included (where the handoff time goes). */
+	float StageSeconds[static_cast<int32>(EPlanetHandoffStage::Count)] = {};
+
+	/** Content warm-up: requests made at load, and those still outstanding when the handoff went ahead (deadline hit if > 0). */
+	int32 WarmUpRequests = 0;
+	int32 WarmUpOutstanding = 0;
+
+	/** Seconds from the start of the warm-up to warm (or the deadline). */
+	float WarmUpSeconds = 0.f;
+
+	/** Most handoff time spent in one frame (the hitch the player sees). */
+	float WorstFrameMs = 0.f;
+
+	/** Frames from BeginSurfaceHandoff to arrival on the surface. */
+	int32 Frames = 0;
+};
+
 UENUM(BlueprintType)
 enum class EPlanetTransitionMode : uint8
 {
@@ -123,6 +182,10 @@ public:
 	UPlanetSurfaceStreamer();
 
 	virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
+	virtual void OnRegister() override;
+	virtual void OnUnregister() override;
+	/** World origin shift: moves the surface frame, saved space position and surface level placements with it. */
+	virtual void ApplyWorldOffset(const FVector& InOffset, bool bWorldShift) override;
 
 	// --- Configuration ---
 
@@ -168,10 +231,88 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Streaming")
 	float ExitAltitude = 50000.f;
 
+	/** Rough resident size of the surface level, charged against UPlanetStreamingSubsystem's predictive load budget. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Streaming|Prediction", meta = (ClampMin = "0.0"))
+	float EstimatedSurfaceMemoryMB = 256.f;
+
+	/** Game-thread budget per frame for the staged surface handoff. A frame always runs at least one stage; later stages wait once the budget is spent. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Streaming|Transition", meta = (ClampMin = "0.1"))
+	float HandoffFrameBudgetMs = 2.f;
+
+	/** Frames to wait for the surface level to become visible before the handoff proceeds anyway. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Streaming|Transition", meta = (ClampMin = "0"))
+	int32 HandoffMaxPrewarmFrames = 30;
+
+	/**
+	 * Surface content starts warming (textures and meshes streamed to full resolution, PSOs precached) as soon
+	 * as it loads. The handoff waits for it, but no longer than this many seconds after the warm-up started.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Streaming|Transition", meta = (ClampMin = "0.0"))
+	float HandoffWarmUpTimeoutSeconds = 2.f;
+
+	/**
+	 * Movable actors within this distance of the player (ships, companions, projectiles) are carried with
+	 * them onto the surface and back to space. Tag an actor NoPlanetCarry to leave it behind. 0 disables.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Streaming|Transition", meta = (ClampMin = "0.0"))
+	float CarryActorsRadius = 5000.f;
+
+	/**
+	 * Tile the planet into a cube-sphere grid of surface cells instead of one patch. The player lands on
+	 * the cell under the approach point; neighbouring cells stream in around them and the surface frame
+	 * re-bases onto whichever cell they walk into, so the whole planet can be traversed.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Streaming|Cells")
+	bool bUseCellGrid = false;
+
+	/** Cells along each cube face edge (6 * N * N cells in total). Auto-scale sizes each level to one cell. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Streaming|Cells", meta = (ClampMin = "1", ClampMax = "256", EditCondition = "bUseCellGrid"))
+	int32 CellsPerFaceEdge = 8;
+
+	/** Cells within this many rings of the player's cell are streamed in. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Streaming|Cells", meta = (ClampMin = "0", EditCondition = "bUseCellGrid"))
+	int32 CellStreamInRing = 1;
+
+	/** Loaded cells are released once they are further than this many rings away (>= CellStreamInRing). */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Streaming|Cells", meta = (ClampMin = "0", EditCondition = "bUseCellGrid"))
+	int32 CellStreamOutRing = 2;
+
+	/** How far past a cell border (fraction of a cell) the player must walk before that cell becomes the active one. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Streaming|Cells", meta = (ClampMin = "0.0", ClampMax = "0.4", EditCondition = "bUseCellGrid"))
+	float CellRebaseHysteresis = 0.1f;
+
+	/** Optional per-cell level variants, picked by cell hash. Empty = every cell streams SurfaceLevelPath. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Streaming|Cells", meta = (EditCondition = "bUseCellGrid"))
+	TArray<FString> CellLevelPaths;
+
+	/**
+	 * Generate the surface (FPlanetTerrainGenerator on worker tasks) instead of streaming SurfaceLevelPath.
+	 * Works with the cell grid: every cell gets its own generated tile.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Streaming|Terrain")
+	bool bUseProceduralTerrain = false;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Streaming|Terrain", meta = (EditCondition = "bUseProceduralTerrain"))
+	FPlanetTerrainSettings TerrainSettings;
+
+	/** Each generated tile is split into N x N mesh chunks, one worker task each. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Streaming|Terrain", meta = (ClampMin = "1", ClampMax = "32", EditCondition = "bUseProceduralTerrain"))
+	int32 TerrainChunksPerTileEdge = 4;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Streaming|Terrain", meta = (EditCondition = "bUseProceduralTerrain"))
+	TObjectPtr<UMaterialInterface> TerrainMaterial;
+
 	/** Per-planet transition profile. Each planet can opt into legacy or blended/unified behavior independently. */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Streaming|Transition")
 	FPlanetTransitionProfile TransitionProfile;
 
+	/**
+	 * Continuous-LOD planet mesh used by EPlanetTransitionMode::UnifiedSeamless. Terrain comes from
+	 * TerrainSettings and TerrainMaterial, so it matches generated surface tiles.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Streaming|Transition")
+	FPlanetLODSettings LODSettings;
+
 	/** Planet sphere fade: multiplier of planet radius at which fade starts (e.g. 1.2 = start fading when within 1.2x radius). Fade reaches 0 at handoff. Set to 0 to disable. */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Streaming|Fade")
 	float FadeStartMultiplier = 0.f;
@@ -217,6 +358,15 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Streaming|Fade")
 	FName RevealSoftnessParameterName = TEXT("RevealSoftness");
 
+	/**
+	 * Optional: write the reveal sphere (the three Reveal* parameters above) to this collection instead
+	 * of each planet's MID. The sphere is in world space, so one collection serves every planet and costs
+	 * one upload per frame however many planets read it; only the planet currently revealing writes it.
+	 * Planet materials should apply the sphere only while their own FadeAlpha is below 1.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Streaming|Fade")
+	TObjectPtr<UMaterialParameterCollection> RevealParameterCollection;
+
 	// --- Events ---
 
 	UPROPERTY(BlueprintAssignable, Category = "Streaming")
@@ -235,6 +385,9 @@ public:
 
 	// --- Testable logic (public so tests can call directly) ---
 
+	/** Planet center: propagated orbital position if the owner is an orbital body, else the owner's location. */
+	FVector GetPlanetCenter() const;
+
 	/** Squared distance from the owning actor to the first player pawn. Returns FLT_MAX if unavailable. */
 	float GetDistanceToPlayerSquared() const;
 
@@ -244,6 +397,48 @@ public:
 	/** Streaming radius currently in effect (manual override or adaptive). */
 	float GetEffectiveStreamingRadius() const;
 
+	/** Largest value GetEffectiveStreamingRadius can return at any approach speed (used for activation). */
+	float GetMaxStreamingRadius() const;
+
+	/**
+	 * Dormant streamers don't tick. Driven by UPlanetStreamingSubsystem; a streamer starts dormant
+	 * and is woken when the player comes near enough for it to matter.
+	 */
+	void SetStreamingDormant(bool bDormant);
+	bool IsStreamingDormant() const { return bStreamingDormant; }
+
+	/**
+	 * Starts loading the surface early because the player's predicted path reaches this planet.
+	 * The level is anchored at PredictedEntryPoint's direction (unless SurfaceAnchorDirection is set)
+	 * and held in Loading even outside StreamingRadius until ReleasePredictiveHold.
+	 * Only valid from Idle; returns true if the load was started.
+	 */
+	bool BeginPredictiveStreamIn(const FVector& PredictedEntryPoint);
+
+	/** Drops the predictive hold; the normal range check then decides whether to keep the level. */
+	void ReleasePredictiveHold() { bPredictiveHold = false; }
+	bool HasPredictiveHold() const { return bPredictiveHold; }
+
+	/**
+	 * Set by UPlanetStreamingSubsystem's load scheduler while other planets hold the IO or memory budget.
+	 * A deferred streamer stays Idle in streaming range (normal and predictive loads alike).
+	 */
+	void SetLoadDeferred(bool bDeferred) { bLoadDeferred = bDeferred; }
+	bool IsLoadDeferred() const { return bLoadDeferred; }
+
+	/** Streaming priority of the surface level (higher loads first; negative streams behind other levels). */
+	void SetSurfaceLoadPriority(int32 Priority);
+	int32 GetSurfaceLoadPriority() const { return SurfaceLoadPriority; }
+
+	/** True while Loading and the surface content isn't in yet. */
+	bool IsSurfaceLoadInFlight() const { return StreamingState == EPlanetStreamingState::Loading && !IsSurfaceContentLoaded(); }
+
+	/**
+	 * Drops an in-flight or loaded surface that hasn't been handed off yet and goes back to Idle,
+	 * deferred until the scheduler allows it again. Returns false outside Loading or mid-handoff.
+	 */
+	bool CancelSurfaceLoad();
+
 	/** True if the given squared distance is within HandoffRadius (player at surface; safe to teleport). */
 	bool ShouldTransitionToSurface(float DistanceSq) const;
 
@@ -262,6 +457,67 @@ public:
 	void SaveSpacePosition(const FVector& Location, const FRotator& Rotation);
 	void GetSavedSpacePosition(FVector& OutLocation, FRotator& OutRotation) const;
 
+	/**
+	 * Starts the staged handoff of Pawn onto the surface (called from Loading once in handoff range).
+	 * The state becomes OnSurface when the last stage completes.
+	 */
+	void BeginSurfaceHandoff(APawn* Pawn);
+
+	/** Runs handoff stages until they finish or the frame budget is spent. Returns true once on the surface. */
+	bool AdvanceSurfaceHandoff();
+
+	bool IsHandoffInProgress() const { return HandoffStage != EPlanetHandoffStage::None; }
+	EPlanetHandoffStage GetHandoffStage() const { return HandoffStage; }
+	const FPlanetHandoffTimings& GetLastHandoffTimings() const { return HandoffTimings; }
+
+	/**
+	 * Loaded surface content has finished warming (no outstanding texture, mesh or PSO requests) or
+	 * HandoffWarmUpTimeoutSeconds has passed since the warm-up began. True when no warm-up is running.
+	 */
+	bool IsSurfaceContentWarm() const;
+
+	/** Warm-up requests for the current surface content (tests and profiling). */
+	const FPlanetContentWarmUp& GetContentWarmUp() const { return ContentWarmUp; }
+
+	/** Push/skip counts for the planet fade and reveal parameters (tests and profiling). */
+	const FPlanetMaterialParameterCache& GetFadeParameterCache() const { return FadeParamCache; }
+
+	/** Actors carried across the last handoff (gathered again on every transition). */
+	const FPlanetActorCarrier& GetCarriedActors() const { return CarriedActors; }
+
+	/** Grid for the current CellsPerFaceEdge. */
+	FPlanetCellGrid GetCellGrid() const { return FPlanetCellGrid(CellsPerFaceEdge); }
+
+	/** Level package streamed for Cell (a CellLevelPaths variant, else SurfaceLevelPath). */
+	FString GetCellLevelPath(const FPlanetCellId& Cell) const;
+
+	/** Cell the surface frame is anchored to (cell grid mode). */
+	const FPlanetCellId& GetActiveSurfaceCell() const { return ActiveSurfaceCell; }
+
+	/**
+	 * UnifiedSeamless: no surface level, fade or teleport. A quadtree LOD mesh replaces the sphere shell
+	 * once it covers the planet and refines all the way down; the player stays under planet gravity.
+	 * False if the mode isn't selected, or the LOD mesh failed and bAllowLegacyFallback took over.
+	 */
+	bool UsesSeamlessLOD() const { return TransitionProfile.TransitionMode == EPlanetTransitionMode::UnifiedSeamless && !bSeamlessFallback; }
+
+	/** LOD mesh drawn in UnifiedSeamless mode, or nullptr. */
+	APlanetLODMesh* GetLODMesh() const { return LODMesh; }
+
+	/** Generated tile the player lands on (bUseProceduralTerrain), or nullptr. */
+	APlanetTerrainTile* GetGeneratedTile() const { return GeneratedTile; }
+
+	/** Neighbour cell levels or tiles currently requested (excludes the active cell's). */
+	int32 GetNumStreamedSurfaceCells() const { return SurfaceCells.Num(); }
+
+	/**
+	 * Moves the surface frame onto Cell: Pawn keeps its place on the sphere (SurfaceToSpacePosition with
+	 * the old frame, SpaceToSurfacePosition with the new one) and its altitude above the tile, and its
+	 * rotation, velocity and gravity turn with the new surface normal. Cell's loaded level, if any,
+	 * becomes StreamedLevel and the old one joins the neighbour set; every cell is re-placed in the new frame.
+	 */
+	void RebaseToSurfaceCell(const FPlanetCellId& Cell, APawn* Pawn);
+
 	/** Transition state (exposed for testing; normal flow drives this via Tick). */
 	void SetStreamingState(EPlanetStreamingState NewState) { StreamingState = NewState; }
 
@@ -277,6 +533,8 @@ public:
 	float GetEffectiveHandoffRadius() const;
 	float GetEffectiveExitAltitude() const;
 	float ComputeAutoSurfaceLevelScale() const;
+	/** Half-size of the surface patch in UU: half a cell in cell grid mode, else PlanetRadius * DesiredPatchFraction. */
+	float GetDesiredPatchRadius() const;
 	float GetEffectiveFadeStartRadius() const;
 	float GetEffectiveFullFadeRadius() const;
 	float ComputeRevealProgress(float DistanceToPlayer) const;
@@ -293,6 +551,14 @@ public:
 	FVector TangentY = FVector::RightVector;
 
 	void ComputeTangentFrame(const FVector& PlanetCenter);
+	/** Space/surface mapping for the current frame; use its batch overloads to carry many positions at once. */
+	FPlanetSurfaceMapping GetSurfaceMapping() const;
+	/**
+	 * Placement of the level or tile centered on CellDir within the current surface frame: at the frame point
+	 * the mapping gives CellDir, turned and scaled like the active tile, so neighbouring ground meets it without
+	 * a step. OutFrame is the matching tile frame (the active frame, offset to the cell's center).
+	 */
+	FTransform MakeSurfaceCellTransform(const FVector& CellDir, FPlanetTerrainTileFrame& OutFrame) const;
 	FVector SpaceToSurfacePosition(const FVector& SpacePos) const;
 	FVector SurfaceToSpacePosition(const FVector& SurfacePos) const;
 	FPlanetTransitionOrientation CaptureCurrentViewOrientation() const;
@@ -300,38 +566,148 @@ public:
 	void ApplyAtmosphereRollBlend(float BlendAlpha);
 
 private:
+	/** Neighbour cell level or tile around the active cell (cell grid mode). */
+	struct FStreamedSurfaceCell
+	{
+		FPlanetCellId Cell;
+		/** Also referenced by the world's streaming levels while requested. */
+		TWeakObjectPtr<ULevelStreamingDynamic> Level;
+		/** Set instead of Level when bUseProceduralTerrain is set. */
+		TWeakObjectPtr<APlanetTerrainTile> Tile;
+		FString LevelPath;
+		double RequestTime = 0.0;
+		/** Seconds it took to load; < 0 until known. */
+		float LoadSeconds = -1.f;
+	};
+
 	UPROPERTY()
 	TObjectPtr<ULevelStreamingDynamic> StreamedLevel;
 
+	/** Used instead of StreamedLevel when bUseProceduralTerrain is set. */
+	UPROPERTY()
+	TObjectPtr<APlanetTerrainTile> GeneratedTile;
+
+	UPROPERTY()
+	TObjectPtr<APlanetLODMesh> LODMesh;
+	/** Set when the LOD mesh couldn't be created and TransitionProfile.bAllowLegacyFallback is on. */
+	bool bSeamlessFallback = false;
+	bool bShellHiddenForLOD = false;
+
+	/** UnifiedSeamless tick. Returns false to fall back to the streamed-surface state machine. */
+	bool UpdateSeamlessLOD();
+
+	bool HasSurfaceContent() const { return StreamedLevel || GeneratedTile; }
+	/** Level loaded, or every chunk of the generated tile uploaded. */
+	bool IsSurfaceContentLoaded() const;
+	/** Drops the primary level or tile outright (no pooling). */
+	void DiscardSurfaceContent();
+	/** Starts warming the loaded level or generated tile (see FPlanetContentWarmUp). */
+	void BeginContentWarmUp();
+	/** Begins the warm-up if needed, else re-checks what is outstanding until it is warm. */
+	void UpdateContentWarmUp();
+	/** Spawns a tile centered on AnchorDir (placed by MakeSurfaceCellTransform) and starts generating it. */
+	APlanetTerrainTile* SpawnTerrainTile(const FVector& AnchorDir);
+	/** Re-places Cell's level or tile in the current surface frame; tiles are regenerated for it. */
+	void PlaceSurfaceCellContent(const FPlanetCellId& Cell, ULevelStreamingDynamic* Level, APlanetTerrainTile* Tile);
+
 	void UpdateIdleState();
 	void UpdateLoadingState();
 	void UpdateOnSurfaceState();
 	void UpdateUnloadingState();
 
+	/** Cell grid mode, on the surface: re-base onto the player's cell and stream cells by ring. */
+	void UpdateSurfaceCells(APawn* PlayerPawn);
+	/** Hides (pools) or unloads every neighbour cell level and destroys neighbour tiles. */
+	void ReleaseSurfaceCells();
+	void ReleaseSurfaceCell(const FStreamedSurfaceCell& Entry);
+	/** Level placement for the tile whose tangent frame is centered on AnchorDir. */
+	FTransform MakeSurfaceLevelTransform(const FVector& PlanetCenter, const FVector& AnchorDir, FVector& OutOrigin) const;
+
 	void BeginStreamIn();
-	void TransitionPlayerToSurface();
+	/** Runs one handoff stage for HandoffPawn; false means it is waiting and the rest of the frame is skipped. */
+	bool RunHandoffStage(EPlanetHandoffStage Stage, APawn* Pawn);
+	void FinishSurfaceHandoff();
+	void AbortSurfaceHandoff();
 	void BeginStreamOut();
+	/** Level gone (unloaded or handed to the pool): back to Idle and notify. */
+	void CompleteSurfaceUnload();
 	void TransitionPlayerToSpace();
 
 	APawn* GetPlayerPawn() const;
+	FPlanetTransitionOrientation CaptureViewOrientation(const APawn* Pawn) const;
 	void SetPlayerGravityComponentActive(bool bActive);
 
 	void UpdatePlanetFade(float DistanceToPlayer);
 	void SetPlanetFadeAlpha(float Alpha);
 	void SetPlanetRevealParams(float Progress);
 	void ResetPlanetRevealParams();
+	void PushRevealParams(const FLinearColor& Center, float Radius, float Softness);
 
 	UPROPERTY()
 	TObjectPtr<UMaterialInstanceDynamic> CachedPlanetFadeMaterial;
 
+	/** Planet mesh the fade MID is applied to (found once, not every tick). */
+	TWeakObjectPtr<UStaticMeshComponent> CachedPlanetMesh;
+
+	/** Fade and reveal values last pushed; unchanged values aren't pushed again. */
+	FPlanetMaterialParameterCache FadeParamCache;
+
 	float CurrentRevealProgress = 0.f;
 
+	bool bStreamingDormant = true;
+
+	TWeakObjectPtr<APawn> HandoffPawn;
+	EPlanetHandoffStage HandoffStage = EPlanetHandoffStage::None;
+	int32 HandoffPrewarmFrames = 0;
+	FPlanetHandoffTimings HandoffTimings;
+	/** Wall clock when the current handoff stage first ran; < 0 before that. */
+	double HandoffStageStartSeconds = -1.0;
+	FPlanetActorCarrier CarriedActors;
+
+	FPlanetContentWarmUp ContentWarmUp;
+	/** Wall clock when ContentWarmUp began, and seconds it took to warm (< 0 while outstanding). */
+	double ContentWarmUpStartSeconds = 0.0;
+	float ContentWarmUpSeconds = -1.f;
+
+	/** Set while a predictive load is in flight or waiting for the player (Loading state only). */
+	bool bPredictiveHold = false;
+
+	/** Held back by the load scheduler (see SetLoadDeferred). */
+	bool bLoadDeferred = false;
+
+	/** Last priority given to StreamedLevel; reset to 0 by BeginStreamIn. */
+	int32 SurfaceLoadPriority = 0;
+
+	/** Anchor direction for the next BeginStreamIn, from the predicted entry point (zero = use player direction). */
+	FVector PredictedAnchorDirection = FVector::ZeroVector;
+
+	TArray<FStreamedSurfaceCell> SurfaceCells;
+
+	/** Cell StreamedLevel belongs to, and the package it was loaded from. */
+	FPlanetCellId ActiveSurfaceCell;
+	FString StreamedLevelPath;
+
 	/** Seconds since we streamed out (player left surface). Used to avoid immediate re-entry flip-flop. */
 	float TimeSinceStreamOut = 0.f;
 
+	/** Seconds the current level instance took to load (carried over from the pool on reuse); < 0 until known. */
+	float SurfaceLoadSeconds = -1.f;
+
 	/** World time when we entered Loading state; used for load timeout. */
 	float LoadingStartTime = 0.f;
 
+	/** Set by BeginStreamIn until the Load sample for this request has been recorded. */
+	bool bLoadTelemetryPending = false;
+
+	/** World time the player entered the handoff radius in this Loading episode; < 0 while outside. */
+	float HandoffArrivalTime = -1.f;
+
+	/** World time the level was asked to unload (Unloading state). */
+	float UnloadStartTime = 0.f;
+
+	/** Adds a sample to UPlanetStreamingSubsystem's telemetry; stalls are also logged and bookmarked for Insights. */
+	void RecordTransitionTelemetry(EPlanetStreamingMetric Metric, float Value, bool bStall) const;
+
 	/** Minimum seconds after stream-out before we allow transition back to surface. */
 	static constexpr float StreamOutReentryCooldownSeconds = 1.0f;
 };
@@ -0,0 +1,213 @@
+// Copyright Federation Game. All Rights Reserved.
+
+#include "Planet/PlanetTerrainGenerator.h"
+#include "Planet/PlanetSurfaceMapping.h"
+
+namespace PlanetTerrainGenerator
+{
+	/** Improved-Perlin gradient set (12 cube edges, 4 repeated), indexed by the low hash bits. */
+	const float GradX[16] = { 1, -1, 1, -1, 1, -1, 1, -1, 0, 0, 0, 0, 1, 0, -1, 0 };
+	const float GradY[16] = { 1, 1, -1, -1, 0, 0, 0, 0, 1, -1, 1, -1, 1, -1, 1, -1 };
+	const float GradZ[16] = { 0, 0, 0, 0, 1, 1, -1, -1, 1, 1, -1, -1, 0, 1, 0, -1 };
+
+	/** Decorrelates octaves that would otherwise share lattice hashes. */
+	constexpr uint32 OctaveSeedStep = 0x9E3779B9u;
+
+	FORCEINLINE uint32 HashLattice(int32 X, int32 Y, int32 Z, uint32 Seed)
+	{
+		uint32 H = Seed;
+		H ^= static_cast<uint32>(X) * 0x8DA6B343u;
+		H ^= static_cast<uint32>(Y) * 0xD8163841u;
+		H ^= static_cast<uint32>(Z) * 0xCB1AB31Fu;
+		H ^= H >> 15;
+		H *= 0x2C1B3C6Du;
+		H ^= H >> 12;
+		H *= 0x297A2D39u;
+		H ^= H >> 15;
+		return H;
+	}
+
+	FORCEINLINE float GradDot(uint32 Hash, float X, float Y, float Z)
+	{
+		const uint32 I = Hash & 15u;
+		return GradX[I] * X + GradY[I] * Y + GradZ[I] * Z;
+	}
+
+	FORCEINLINE float Fade(float T)
+	{
+		return T * T * T * (T * (T * 6.f - 15.f) + 10.f);
+	}
+
+	/** Seeded 3D gradient noise, roughly in [-1, 1]. */
+	FORCEINLINE float GradientNoise(float X, float Y, float Z, uint32 Seed)
+	{
+		const float FX = FMath::FloorToFloat(X);
+		const float FY = FMath::FloorToFloat(Y);
+		const float FZ = FMath::FloorToFloat(Z);
+		const int32 IX = static_cast<int32>(FX);
+		const int32 IY = static_cast<int32>(FY);
+		const int32 IZ = static_cast<int32>(FZ);
+		const float DX = X - FX;
+		const float DY = Y - FY;
+		const float DZ = Z - FZ;
+
+		const float N000 = GradDot(HashLattice(IX, IY, IZ, Seed), DX, DY, DZ);
+		const float N100 = GradDot(HashLattice(IX + 1, IY, IZ, Seed), DX - 1.f, DY, DZ);
+		const float N010 = GradDot(HashLattice(IX, IY + 1, IZ, Seed), DX, DY - 1.f, DZ);
+		const float N110 = GradDot(HashLattice(IX + 1, IY + 1, IZ, Seed), DX - 1.f, DY - 1.f, DZ);
+		const float N001 = GradDot(HashLattice(IX, IY, IZ + 1, Seed), DX, DY, DZ - 1.f);
+		const float N101 = GradDot(HashLattice(IX + 1, IY, IZ + 1, Seed), DX - 1.f, DY, DZ - 1.f);
+		const float N011 = GradDot(HashLattice(IX, IY + 1, IZ + 1, Seed), DX, DY - 1.f, DZ - 1.f);
+		const float N111 = GradDot(HashLattice(IX + 1, IY + 1, IZ + 1, Seed), DX - 1.f, DY - 1.f, DZ - 1.f);
+
+		const float U = Fade(DX);
+		const float V = Fade(DY);
+		const float W = Fade(DZ);
+		const float X00 = FMath::Lerp(N000, N100, U);
+		const float X10 = FMath::Lerp(N010, N110, U);
+		const float X01 = FMath::Lerp(N001, N101, U);
+		const float X11 = FMath::Lerp(N011, N111, U);
+		return FMath::Lerp(FMath::Lerp(X00, X10, V), FMath::Lerp(X01, X11, V), W);
+	}
+}
+
+FPlanetTerrainGenerator::FPlanetTerrainGenerator(const FPlanetTerrainSettings& InSettings, double InPlanetRadius)
+	: Settings(InSettings)
+{
+	Settings.Octaves = FMath::Clamp(Settings.Octaves, 1, 12);
+	Settings.ChunkResolution = FMath::Clamp(Settings.ChunkResolution, 2, 257);
+	NoiseScale = static_cast<float>(FMath::Max(1.0, InPlanetRadius) / FMath::Max(100.f, Settings.FeatureSizeUU));
+}
+
+float FPlanetTerrainGenerator::SampleHeight(const FVector& UnitDirection) const
+{
+	const float X = static_cast<float>(UnitDirection.X);
+	const float Y = static_cast<float>(UnitDirection.Y);
+	const float Z = static_cast<float>(UnitDirection.Z);
+	float Height = 0.f;
+	SampleHeights(MakeArrayView(&X, 1), MakeArrayView(&Y, 1), MakeArrayView(&Z, 1), MakeArrayView(&Height, 1));
+	return Height;
+}
+
+void FPlanetTerrainGenerator::SampleHeights(TConstArrayView<float> DirX, TConstArrayView<float> DirY, TConstArrayView<float> DirZ, TArrayView<float> OutHeights) const
+{
+	using namespace PlanetTerrainGenerator;
+
+	const int32 Count = OutHeights.Num();
+	check(DirX.Num() == Count && DirY.Num() == Count && DirZ.Num() == Count);
+
+	// Per-sample accumulators; each octave below is one straight pass over them.
+	TArray<float, TInlineAllocator<1024>> Fbm;
+	TArray<float, TInlineAllocator<1024>> Ridged;
+	TArray<float, TInlineAllocator<1024>> RidgeWeight;
+	Fbm.SetNumZeroed(Count);
+	Ridged.SetNumZeroed(Count);
+	RidgeWeight.Init(1.f, Count);
+
+	float Frequency = NoiseScale;
+	float Amplitude = 1.f;
+	float AmplitudeSum = 0.f;
+	uint32 Seed = static_cast<uint32>(Settings.Seed);
+	for (int32 Octave = 0; Octave < Settings.Octaves; ++Octave)
+	{
+		for (int32 i = 0; i < Count; ++i)
+		{
+			const float N = GradientNoise(DirX[i] * Frequency, DirY[i] * Frequency, DirZ[i] * Frequency, Seed);
+			Fbm[i] += N * Amplitude;
+
+			// Ridged multifractal: sharp creases where the noise crosses zero, detail follows the ridges.
+			float Ridge = 1.f - FMath::Abs(N);
+			Ridge *= Ridge;
+			Ridged[i] += Ridge * Amplitude * RidgeWeight[i];
+			RidgeWeight[i] = FMath::Clamp(Ridge * 2.f, 0.f, 1.f);
+		}
+		AmplitudeSum += Amplitude;
+		Frequency *= Settings.Lacunarity;
+		Amplitude *= Settings.Gain;
+		Seed += OctaveSeedStep;
+	}
+
+	const float InvAmplitudeSum = AmplitudeSum > 0.f ? 1.f / AmplitudeSum : 0.f;
+	const float RidgedBlend = FMath::Clamp(Settings.RidgedWeight, 0.f, 1.f);
+	for (int32 i = 0; i < Count; ++i)
+	{
+		const float Hills = Fbm[i] * InvAmplitudeSum;
+		const float Mountains = Ridged[i] * InvAmplitudeSum * 2.f - 1.f;
+		OutHeights[i] = FMath::Lerp(Hills, Mountains, RidgedBlend) * Settings.HeightScale;
+	}
+}
+
+void FPlanetTerrainGenerator::BuildChunk(const FPlanetTerrainTileFrame& Frame, int32 ChunkX, int32 ChunkY, int32 ChunksPerEdge, FPlanetTerrainChunkData& OutChunk) const
+{
+	const int32 Res = Settings.ChunkResolution;
+	const int32 SafeChunks = FMath::Max(1, ChunksPerEdge);
+	const double ChunkSize = 2.0 * Frame.HalfExtent / SafeChunks;
+	const double Step = ChunkSize / (Res - 1);
+	const double OriginX = -Frame.HalfExtent + ChunkX * ChunkSize;
+	const double OriginY = -Frame.HalfExtent + ChunkY * ChunkSize;
+
+	// Heights on the chunk grid plus a one-sample apron, so border normals match the neighbour chunk's.
+	const int32 Apron = Res + 2;
+	TArray<float> DirX, DirY, DirZ, Heights;
+	DirX.SetNumUninitialized(Apron * Apron);
+	DirY.SetNumUninitialized(Apron * Apron);
+	DirZ.SetNumUninitialized(Apron * Apron);
+	Heights.SetNumUninitialized(Apron * Apron);
+	for (int32 j = 0; j < Apron; ++j)
+	{
+		for (int32 i = 0; i < Apron; ++i)
+		{
+			const FVector Dir = TileLocalToDirection(Frame, OriginX + (i - 1) * Step, OriginY + (j - 1) * Step);
+			const int32 Index = j * Apron + i;
+			DirX[Index] = static_cast<float>(Dir.X);
+			DirY[Index] = static_cast<float>(Dir.Y);
+			DirZ[Index] = static_cast<float>(Dir.Z);
+		}
+	}
+	SampleHeights(DirX, DirY, DirZ, Heights);
+
+	OutChunk.ChunkX = ChunkX;
+	OutChunk.ChunkY = ChunkY;
+	OutChunk.Resolution = Res;
+	OutChunk.Positions.SetNumUninitialized(Res * Res);
+	OutChunk.Normals.SetNumUninitialized(Res * Res);
+	OutChunk.MinHeight = FLT_MAX;
+	OutChunk.MaxHeight = -FLT_MAX;
+
+	const float InvTwoStep = static_cast<float>(0.5 / Step);
+	for (int32 j = 0; j < Res; ++j)
+	{
+		for (int32 i = 0; i < Res; ++i)
+		{
+			const int32 A = (j + 1) * Apron + (i + 1);
+			const float H = Heights[A];
+			const float DHDX = (Heights[A + 1] - Heights[A - 1]) * InvTwoStep;
+			const float DHDY = (Heights[A + Apron] - Heights[A - Apron]) * InvTwoStep;
+
+			const int32 V = j * Res + i;
+			OutChunk.Positions[V] = FVector3f(static_cast<float>(OriginX + i * Step), static_cast<float>(OriginY + j * Step), H);
+			OutChunk.Normals[V] = FVector3f(-DHDX, -DHDY, 1.f).GetSafeNormal();
+			OutChunk.MinHeight = FMath::Min(OutChunk.MinHeight, H);
+			OutChunk.MaxHeight = FMath::Max(OutChunk.MaxHeight, H);
+		}
+	}
+
+	OutChunk.Indices.Reset((Res - 1) * (Res - 1) * 6);
+	for (int32 j = 0; j < Res - 1; ++j)
+	{
+		for (int32 i = 0; i < Res - 1; ++i)
+		{
+			const int32 V00 = j * Res + i;
+			const int32 V10 = V00 + 1;
+			const int32 V01 = V00 + Res;
+			const int32 V11 = V01 + 1;
+			OutChunk.Indices.Append({ V00, V11, V10, V00, V01, V11 });
+		}
+	}
+}
+
+FVector FPlanetTerrainGenerator::TileLocalToDirection(const FPlanetTerrainTileFrame& Frame, double LocalX, double LocalY)
+{
+	return FPlanetSurfaceMapping::SurfaceOffsetToDirection(Frame.Normal, Frame.AxisX, Frame.AxisY,
+		FMath::Max(1.0, Frame.PlanetRadius), Frame.CenterX + LocalX, Frame.CenterY + LocalY);
+}
@@ -0,0 +1,107 @@
+// Copyright Federation Game. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "PlanetTerrainGenerator.generated.h"
+
+/** Noise parameters for a generated planet surface. The same settings and seed always give the same terrain. */
+USTRUCT(BlueprintType)
+struct FPlanetTerrainSettings
+{
+	GENERATED_BODY()
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Terrain")
+	int32 Seed = 1337;
+
+	/** Peak-to-trough scale of the terrain in UU (heights span roughly +-HeightScale). */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Terrain", meta = (ClampMin = "0.0"))
+	float HeightScale = 5000.f;
+
+	/** Wavelength of the lowest octave in UU along the surface. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Terrain", meta = (ClampMin = "100.0"))
+	float FeatureSizeUU = 100000.f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Terrain", meta = (ClampMin = "1", ClampMax = "12"))
+	int32 Octaves = 6;
+
+	/** Frequency multiplier per octave. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Terrain", meta = (ClampMin = "1.0"))
+	float Lacunarity = 2.f;
+
+	/** Amplitude multiplier per octave. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Terrain", meta = (ClampMin = "0.0", ClampMax = "1.0"))
+	float Gain = 0.5f;
+
+	/** 0 = rolling fBm hills, 1 = sharp ridged mountains. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Terrain", meta = (ClampMin = "0.0", ClampMax = "1.0"))
+	float RidgedWeight = 0.35f;
+
+	/** Vertices along each chunk edge (chunks share their border vertices). */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Terrain", meta = (ClampMin = "2", ClampMax = "257"))
+	int32 ChunkResolution = 33;
+};
+
+/**
+ * Flat surface tile in the streamer's tangent frame: local (X, Y) are arc lengths along AxisX/AxisY
+ * (the SpaceToSurfacePosition mapping), Z is height along Normal. The tile spans +-HalfExtent around
+ * (CenterX, CenterY), which is non-zero for neighbour tiles laid out in the active tile's frame.
+ */
+struct FPlanetTerrainTileFrame
+{
+	FVector Normal = FVector::UpVector;
+	FVector AxisX = FVector::ForwardVector;
+	FVector AxisY = FVector::RightVector;
+	double PlanetRadius = 1.0;
+	double HalfExtent = 1.0;
+	double CenterX = 0.0;
+	double CenterY = 0.0;
+};
+
+/** One generated chunk, in tile-local space (origin at the tile center, Z up). */
+struct FPlanetTerrainChunkData
+{
+	int32 ChunkX = 0;
+	int32 ChunkY = 0;
+	int32 Resolution = 0;
+	TArray<FVector3f> Positions;
+	TArray<FVector3f> Normals;
+	/** Triangle list, front faces up: (C - A) x (B - A) points along +Z (UE winding). */
+	TArray<int32> Indices;
+	float MinHeight = 0.f;
+	float MaxHeight = 0.f;
+};
+
+/**
+ * Deterministic fBm/ridged heightfield sampled on the unit sphere, so neighbouring chunks, tiles
+ * and cells agree at shared edges no matter which frame built them.
+ *
+ * Evaluation is batched in structure-of-arrays form: each octave is one branch-free loop over a
+ * contiguous run of samples (hashed lattice gradients, no permutation table), so it stays in
+ * cache and leaves the compiler free to vectorize. The generator holds no mutable state, so
+ * BuildChunk is safe to call from any number of worker tasks at once.
+ */
+class FEDERATION_API FPlanetTerrainGenerator
+{
+public:
+	FPlanetTerrainGenerator(const FPlanetTerrainSettings& InSettings, double InPlanetRadius);
+
+	const FPlanetTerrainSettings& GetSettings() const { return Settings; }
+
+	/** Height in UU above the reference sphere at a unit direction. */
+	float SampleHeight(const FVector& UnitDirection) const;
+
+	/** Batched SampleHeight over SoA unit directions; every view must have the same length. */
+	void SampleHeights(TConstArrayView<float> DirX, TConstArrayView<float> DirY, TConstArrayView<float> DirZ, TArrayView<float> OutHeights) const;
+
+	/** Builds chunk (ChunkX, ChunkY) of a tile split into ChunksPerEdge x ChunksPerEdge chunks. */
+	void BuildChunk(const FPlanetTerrainTileFrame& Frame, int32 ChunkX, int32 ChunkY, int32 ChunksPerEdge, FPlanetTerrainChunkData& OutChunk) const;
+
+	/** Same direction SurfaceToSpacePosition gives for a tile-local point (before scaling by the radius). */
+	static FVector TileLocalToDirection(const FPlanetTerrainTileFrame& Frame, double LocalX, double LocalY);
+
+private:
+	FPlanetTerrainSettings Settings;
+	/** Noise-space units per unit of sphere direction: PlanetRadius / FeatureSizeUU. */
+	float NoiseScale = 1.f;
+};
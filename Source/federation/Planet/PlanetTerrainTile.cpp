@@ -0,0 +1,139 @@
+// Copyright Federation Game. All Rights Reserved.
+
+#include "Planet/PlanetTerrainTile.h"
+#include "Components/DynamicMeshComponent.h"
+#include "Components/SceneComponent.h"
+#include "DynamicMesh/DynamicMesh3.h"
+#include "Engine/CollisionProfile.h"
+#include "Materials/MaterialInterface.h"
+
+using UE::Geometry::FDynamicMesh3;
+
+namespace PlanetTerrainTile
+{
+	/** Heightfield chunk to a render/collision mesh (worker thread). */
+	TSharedPtr<FDynamicMesh3> BuildChunkMesh(const FPlanetTerrainChunkData& Chunk)
+	{
+		TSharedPtr<FDynamicMesh3> Mesh = MakeShared<FDynamicMesh3>();
+		Mesh->EnableVertexNormals(FVector3f::UnitZ());
+		for (int32 i = 0; i < Chunk.Positions.Num(); ++i)
+		{
+			const int32 Vertex = Mesh->AppendVertex(FVector3d(Chunk.Positions[i]));
+			Mesh->SetVertexNormal(Vertex, Chunk.Normals[i]);
+		}
+		for (int32 i = 0; i + 2 < Chunk.Indices.Num(); i += 3)
+		{
+			Mesh->AppendTriangle(Chunk.Indices[i], Chunk.Indices[i + 1], Chunk.Indices[i + 2]);
+		}
+		return Mesh;
+	}
+}
+
+APlanetTerrainTile::APlanetTerrainTile()
+{
+	PrimaryActorTick.bCanEverTick = true;
+	RootComponent = CreateDefaultSubobject<USceneComponent>(TEXT("Root"));
+}
+
+void APlanetTerrainTile::Tick(float DeltaSeconds)
+{
+	QUICK_SCOPE_CYCLE_COUNTER(STAT_PlanetTerrainTile_Tick);
+	Super::Tick(DeltaSeconds);
+
+	UploadCompletedChunks(MaxChunkUploadsPerTick);
+	if (PendingChunks.Num() == 0)
+	{
+		SetActorTickEnabled(false);
+	}
+}
+
+void APlanetTerrainTile::BeginGenerate(const FPlanetTerrainSettings& Settings, const FPlanetTerrainTileFrame& Frame, int32 ChunksPerEdge, UMaterialInterface* Material)
+{
+	// Tasks already in flight finish on their own; their results are simply never collected.
+	PendingChunks.Reset();
+
+	// Chunks already shown stay until their replacement uploads, so regenerating a visible tile
+	// (e.g. after a cell re-base) never opens holes in the ground.
+	const int32 SafeChunks = FMath::Max(1, ChunksPerEdge);
+	NumChunks = SafeChunks * SafeChunks;
+	NumUploadedChunks = 0;
+	ChunkMaterial = Material;
+	for (int32 i = NumChunks; i < ChunkComponents.Num(); ++i)
+	{
+		if (ChunkComponents[i])
+		{
+			ChunkComponents[i]->DestroyComponent();
+		}
+	}
+	ChunkComponents.SetNum(NumChunks);
+
+	for (int32 ChunkY = 0; ChunkY < SafeChunks; ++ChunkY)
+	{
+		for (int32 ChunkX = 0; ChunkX < SafeChunks; ++ChunkX)
+		{
+			FPendingChunk& Pending = PendingChunks.AddDefaulted_GetRef();
+			Pending.ChunkIndex = ChunkY * SafeChunks + ChunkX;
+			// Captures copies only: the task never touches this actor.
+			Pending.Task = UE::Tasks::Launch(UE_SOURCE_LOCATION, [Settings, Frame, ChunkX, ChunkY, SafeChunks]()
+			{
+				FPlanetTerrainChunkData Chunk;
+				FPlanetTerrainGenerator(Settings, Frame.PlanetRadius).BuildChunk(Frame, ChunkX, ChunkY, SafeChunks, Chunk);
+				return PlanetTerrainTile::BuildChunkMesh(Chunk);
+			});
+		}
+	}
+	SetActorTickEnabled(true);
+}
+
+int32 APlanetTerrainTile::UploadCompletedChunks(int32 MaxUploads)
+{
+	int32 Uploaded = 0;
+	for (int32 i = 0; i < PendingChunks.Num() && Uploaded < MaxUploads; )
+	{
+		FPendingChunk& Pending = PendingChunks[i];
+		if (!Pending.Task.IsCompleted())
+		{
+			++i;
+			continue;
+		}
+
+		TSharedPtr<FDynamicMesh3> Mesh = Pending.Task.GetResult();
+		UDynamicMeshComponent* Chunk = NewObject<UDynamicMeshComponent>(this);
+		Chunk->SetupAttachment(RootComponent);
+		Chunk->SetCollisionProfileName(UCollisionProfile::BlockAll_ProfileName);
+		Chunk->bUseAsyncCooking = true;
+		Chunk->SetComplexAsSimpleCollisionEnabled(true, false);
+		if (Mesh)
+		{
+			Chunk->SetMesh(MoveTemp(*Mesh));
+		}
+		if (ChunkMaterial)
+		{
+			Chunk->SetMaterial(0, ChunkMaterial);
+		}
+		Chunk->RegisterComponent();
+		if (UDynamicMeshComponent* Previous = ChunkComponents[Pending.ChunkIndex])
+		{
+			Previous->DestroyComponent();
+		}
+		ChunkComponents[Pending.ChunkIndex] = Chunk;
+
+		PendingChunks.RemoveAtSwap(i);
+		++NumUploadedChunks;
+		++Uploaded;
+	}
+	return Uploaded;
+}
+
+void APlanetTerrainTile::WaitForChunkTasks()
+{
+	for (FPendingChunk& Pending : PendingChunks)
+	{
+		Pending.Task.Wait();
+	}
+}
+
+UDynamicMeshComponent* APlanetTerrainTile::GetChunkComponent(int32 ChunkIndex) const
+{
+	return ChunkComponents.IsValidIndex(ChunkIndex) ? ChunkComponents[ChunkIndex].Get() : nullptr;
+}
@@ -0,0 +1,70 @@
+// Copyright Federation Game. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameFramework/Actor.h"
+#include "Planet/PlanetTerrainGenerator.h"
+#include "Tasks/Task.h"
+#include "PlanetTerrainTile.generated.h"
+
+class UDynamicMeshComponent;
+class UMaterialInterface;
+
+namespace UE::Geometry { class FDynamicMesh3; }
+
+/**
+ * One generated surface tile: a grid of UDynamicMeshComponent chunks whose meshes are built on
+ * UE::Tasks workers (heightfield + FDynamicMesh3) and handed to the components on the game thread,
+ * at most MaxChunkUploadsPerTick per frame.
+ *
+ * Spawned by UPlanetSurfaceStreamer in place of a streamed level when bUseProceduralTerrain is set.
+ * The actor transform is the tile's tangent frame; chunk geometry is in tile-local UU.
+ */
+UCLASS(NotPlaceable)
+class FEDERATION_API APlanetTerrainTile : public AActor
+{
+	GENERATED_BODY()
+
+public:
+	APlanetTerrainTile();
+
+	virtual void Tick(float DeltaSeconds) override;
+
+	/** Launches one worker task per chunk. Unfinished earlier work is dropped; uploaded chunks show until replaced. */
+	void BeginGenerate(const FPlanetTerrainSettings& Settings, const FPlanetTerrainTileFrame& Frame, int32 ChunksPerEdge, UMaterialInterface* Material);
+
+	/** Hands up to MaxUploads finished chunks to their components. Returns how many were uploaded. */
+	int32 UploadCompletedChunks(int32 MaxUploads);
+
+	/** Blocks until every launched chunk task has finished (tests and benchmarks only). */
+	void WaitForChunkTasks();
+
+	bool IsGenerationComplete() const { return NumChunks > 0 && NumUploadedChunks == NumChunks; }
+	int32 GetNumChunks() const { return NumChunks; }
+	int32 GetNumUploadedChunks() const { return NumUploadedChunks; }
+
+	/** Chunk mesh component, once uploaded (nullptr before; the previous one while a regeneration is pending). */
+	UDynamicMeshComponent* GetChunkComponent(int32 ChunkIndex) const;
+
+	/** Chunk meshes given to components per frame; mesh and collision setup is the game-thread cost. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Terrain", meta = (ClampMin = "1"))
+	int32 MaxChunkUploadsPerTick = 2;
+
+private:
+	struct FPendingChunk
+	{
+		int32 ChunkIndex = INDEX_NONE;
+		UE::Tasks::TTask<TSharedPtr<UE::Geometry::FDynamicMesh3>> Task;
+	};
+	TArray<FPendingChunk> PendingChunks;
+
+	UPROPERTY()
+	TArray<TObjectPtr<UDynamicMeshComponent>> ChunkComponents;
+
+	UPROPERTY()
+	TObjectPtr<UMaterialInterface> ChunkMaterial;
+
+	int32 NumChunks = 0;
+	int32 NumUploadedChunks = 0;
+};
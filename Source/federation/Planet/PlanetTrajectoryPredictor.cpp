@@ -0,0 +1,72 @@
+// Copyright Federation Game. All Rights Reserved.
+
+#include "Planet/PlanetTrajectoryPredictor.h"
+
+void FPlanetTrajectoryPredictor::PredictArrivals(const FVector& Start, const FVector& Velocity, TConstArrayView<FPlanetStreamTarget> Targets,
+	TFunctionRef<FVector(const FVector&)> Acceleration, TArray<FPlanetArrival>& OutArrivals) const
+{
+	OutArrivals.Reset();
+	if (Targets.Num() == 0) return;
+
+	TBitArray<> Reached(false, Targets.Num());
+	int32 NumReached = 0;
+
+	for (int32 t = 0; t < Targets.Num(); ++t)
+	{
+		const FPlanetStreamTarget& Target = Targets[t];
+		if (FVector::DistSquared(Start, Target.Center) <= FMath::Square(Target.Radius))
+		{
+			OutArrivals.Add({ Target.Id, 0.f, Start });
+			Reached[t] = true;
+			++NumReached;
+		}
+	}
+
+	const float Dt = FMath::Max(0.001f, StepSeconds);
+	const int32 NumSteps = FMath::CeilToInt32(FMath::Max(0.f, HorizonSeconds) / Dt);
+
+	FVector Position = Start;
+	FVector Vel = Velocity;
+	for (int32 Step = 0; Step < NumSteps && NumReached < Targets.Num(); ++Step)
+	{
+		Vel += Acceleration(Position) * Dt;
+		const FVector Next = Position + Vel * Dt;
+
+		for (int32 t = 0; t < Targets.Num(); ++t)
+		{
+			if (Reached[t]) continue;
+
+			const FPlanetStreamTarget& Target = Targets[t];
+			const double Entry = SegmentSphereEntry(Position, Next, Target.Center, Target.Radius);
+			if (Entry < 0.0) continue;
+
+			OutArrivals.Add({ Target.Id, static_cast<float>((Step + Entry) * Dt), FMath::Lerp(Position, Next, Entry) });
+			Reached[t] = true;
+			++NumReached;
+		}
+		Position = Next;
+	}
+
+	OutArrivals.StableSort([](const FPlanetArrival& A, const FPlanetArrival& B)
+	{
+		return A.TimeSeconds < B.TimeSeconds;
+	});
+}
+
+double FPlanetTrajectoryPredictor::SegmentSphereEntry(const FVector& A, const FVector& B, const FVector& Center, double Radius)
+{
+	const FVector D = B - A;
+	const FVector F = A - Center;
+	const double C = F.SizeSquared() - Radius * Radius;
+	if (C <= 0.0) return 0.0;
+
+	const double DD = D.SizeSquared();
+	if (DD <= UE_DOUBLE_SMALL_NUMBER) return -1.0;
+
+	const double HalfB = F | D;
+	const double Disc = HalfB * HalfB - DD * C;
+	if (HalfB >= 0.0 || Disc < 0.0) return -1.0;
+
+	const double S = (-HalfB - FMath::Sqrt(Disc)) / DD;
+	return S <= 1.0 ? S : -1.0;
+}
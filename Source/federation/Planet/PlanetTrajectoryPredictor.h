@@ -0,0 +1,47 @@
+// Copyright Federation Game. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Templates/Function.h"
+
+/** A sphere the predicted path may enter (planet center + the radius where its surface must be ready). */
+struct FPlanetStreamTarget
+{
+	/** Caller-defined identifier, e.g. a registry slot. */
+	int32 Id = INDEX_NONE;
+	FVector Center = FVector::ZeroVector;
+	double Radius = 0.0;
+};
+
+/** First time the predicted path enters a target's sphere. */
+struct FPlanetArrival
+{
+	int32 Id = INDEX_NONE;
+	float TimeSeconds = 0.f;
+	FVector EntryPoint = FVector::ZeroVector;
+};
+
+/**
+ * Extrapolates a body's path a few seconds ahead (semi-implicit Euler under a caller-supplied
+ * acceleration field) and reports which targets it enters, soonest first.
+ *
+ * Each step's segment is tested against every sphere, so fast movers can't tunnel through
+ * a target between samples. A start point already inside a sphere arrives at t = 0.
+ */
+class FEDERATION_API FPlanetTrajectoryPredictor
+{
+public:
+	/** How far ahead to extrapolate. */
+	float HorizonSeconds = 10.f;
+
+	/** Integration step; smaller follows curved (gravity-bent) paths more closely. */
+	float StepSeconds = 0.1f;
+
+	/** Fills OutArrivals (sorted by TimeSeconds) with every target reached within the horizon. */
+	void PredictArrivals(const FVector& Start, const FVector& Velocity, TConstArrayView<FPlanetStreamTarget> Targets,
+		TFunctionRef<FVector(const FVector&)> Acceleration, TArray<FPlanetArrival>& OutArrivals) const;
+
+	/** Parameter in [0, 1] where segment A->B first enters the sphere, or < 0 if it doesn't. */
+	static double SegmentSphereEntry(const FVector& A, const FVector& B, const FVector& Center, double Radius);
+};
@@ -0,0 +1,136 @@
+// Copyright Federation Game. All Rights Reserved.
+
+#include "Misc/AutomationTest.h"
+#include "Core/FloatingOriginSubsystem.h"
+#include "Planet/PlanetStreamingSubsystem.h"
+#include "Planet/PlanetSurfaceStreamer.h"
+#include "Components/SceneComponent.h"
+#include "Engine/LevelStreamingDynamic.h"
+#include "Engine/World.h"
+#include "Tests/AutomationCommon.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+// ---------------------------------------------------------------------------
+// 1. Level instances: placement follows the shift, pooled instances are found at the new place
+// ---------------------------------------------------------------------------
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FFloatingOriginShiftLevelInstance,
+	"FederationGame.Core.FloatingOrigin.ShiftLevelInstance",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter
+)
+
+bool FFloatingOriginShiftLevelInstance::RunTest(const FString& Parameters)
+{
+	UWorld* World = GEngine->GetWorldContexts()[0].World();
+	if (!World) { AddError(TEXT("No world context")); return false; }
+	UPlanetStreamingSubsystem* Streaming = World->GetSubsystem<UPlanetStreamingSubsystem>();
+	if (!Streaming) { AddError(TEXT("No planet streaming subsystem")); return false; }
+
+	const FVector Offset(-2.0e6, 5.0e5, -3.0e5);
+	const FQuat Rotation(FVector::UpVector, 0.7);
+
+	// Never added to the world: only the placement moves (the level would be placed from it when shown).
+	ULevelStreamingDynamic* Level = NewObject<ULevelStreamingDynamic>(World);
+	Level->LevelTransform = FTransform(Rotation, FVector(1.0e6, 0.0, 0.0), FVector(2.0));
+	UFloatingOriginSubsystem::ShiftLevelInstance(Level, Offset);
+	TestTrue(TEXT("Translation shifted"), Level->LevelTransform.GetLocation().Equals(FVector(1.0e6, 0.0, 0.0) + Offset, 1e-6));
+	TestTrue(TEXT("Rotation kept"), Level->LevelTransform.GetRotation().Equals(Rotation, 1e-9));
+	TestTrue(TEXT("Scale kept"), Level->LevelTransform.GetScale3D().Equals(FVector(2.0), 1e-9));
+	UFloatingOriginSubsystem::ShiftLevelInstance(nullptr, Offset);
+
+	// A pooled instance is matched by placement, so the pool must follow the shift or every reuse misses.
+	const int32 SavedMax = Streaming->MaxPooledSurfaceLevels;
+	const float SavedBudget = Streaming->SurfacePoolMemoryBudgetMB;
+	Streaming->FlushSurfacePool();
+	Streaming->MaxPooledSurfaceLevels = 2;
+	Streaming->SurfacePoolMemoryBudgetMB = 1000.f;
+
+	const FString Path = TEXT("/Game/Planets/PlanetSurface_A");
+	ULevelStreamingDynamic* Pooled = NewObject<ULevelStreamingDynamic>(World);
+	const FTransform Placement(FVector(3.0e6, 0.0, 0.0));
+	Pooled->LevelTransform = Placement;
+	TestTrue(TEXT("Instance pooled"), Streaming->ReleaseSurfaceLevelToPool(Pooled, Path, nullptr, 100.f, 2.f));
+
+	Streaming->ApplyOriginOffset(Offset);
+	float LoadSeconds = 0.f;
+	TestNull(TEXT("Old placement no longer matches"), Streaming->AcquirePooledSurfaceLevel(Path, Placement, LoadSeconds));
+	FTransform Shifted = Placement;
+	Shifted.AddToTranslation(Offset);
+	TestTrue(TEXT("Shifted placement reuses the instance"), Streaming->AcquirePooledSurfaceLevel(Path, Shifted, LoadSeconds) == Pooled);
+
+	Streaming->FlushSurfacePool();
+	Streaming->MaxPooledSurfaceLevels = SavedMax;
+	Streaming->SurfacePoolMemoryBudgetMB = SavedBudget;
+	return true;
+}
+
+// ---------------------------------------------------------------------------
+// 2. Rebase and back: actors and streamer state move together, cost per actor is recorded
+// ---------------------------------------------------------------------------
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FFloatingOriginRebaseRoundTrip,
+	"FederationGame.Core.FloatingOrigin.RebaseRoundTrip",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter
+)
+
+bool FFloatingOriginRebaseRoundTrip::RunTest(const FString& Parameters)
+{
+	UWorld* World = GEngine->GetWorldContexts()[0].World();
+	if (!World) { AddError(TEXT("No world context")); return false; }
+	UFloatingOriginSubsystem* Sub = World->GetSubsystem<UFloatingOriginSubsystem>();
+	if (!Sub) { AddError(TEXT("No floating origin subsystem")); return false; }
+
+	const FVector PlanetLocation(4.0e6, -1.0e6, 2.0e5);
+	AActor* Planet = World->SpawnActor<AActor>(AActor::StaticClass(), FTransform(PlanetLocation));
+	if (!Planet) { AddError(TEXT("Failed to spawn")); return false; }
+	USceneComponent* Root = NewObject<USceneComponent>(Planet, TEXT("Root"));
+	Root->RegisterComponent();
+	Planet->SetRootComponent(Root);
+	Planet->SetActorLocation(PlanetLocation);
+
+	UPlanetSurfaceStreamer* Streamer = NewObject<UPlanetSurfaceStreamer>(Planet, TEXT("TestStreamer"));
+	Streamer->RegisterComponent();
+	const FVector SurfaceOrigin = PlanetLocation + FVector(0.0, 0.0, 100000.0);
+	const FVector SavedSpace = PlanetLocation + FVector(0.0, 0.0, 150000.0);
+	Streamer->SurfaceLevelWorldOrigin = SurfaceOrigin;
+	Streamer->SavedSpaceLocation = SavedSpace;
+
+	const FIntVector OriginBefore = Sub->GetOriginLocation();
+	const FVector AbsolutePlanet = Sub->LocalToAbsolute(PlanetLocation);
+	const FFloatingOriginStats StatsBefore = Sub->GetStats();
+
+	// Rebase onto the planet: it ends up at the engine origin.
+	if (!Sub->RebaseOrigin(PlanetLocation))
+	{
+		AddWarning(TEXT("World refused the rebase (level becoming visible); skipped"));
+		Planet->Destroy();
+		return true;
+	}
+	TestTrue(TEXT("Origin moved by the shift"), Sub->GetOriginLocation() == OriginBefore + FIntVector(4000000, -1000000, 200000));
+	TestTrue(TEXT("Planet now at the engine origin"), Planet->GetActorLocation().Equals(FVector::ZeroVector, 1e-3));
+	TestTrue(TEXT("Absolute position unchanged"), Sub->LocalToAbsolute(Planet->GetActorLocation()).Equals(AbsolutePlanet, 1e-3));
+	TestTrue(TEXT("Surface frame moved with it"), Streamer->SurfaceLevelWorldOrigin.Equals(SurfaceOrigin - PlanetLocation, 1e-3));
+	TestTrue(TEXT("Saved space position moved with it"), Streamer->SavedSpaceLocation.Equals(SavedSpace - PlanetLocation, 1e-3));
+
+	const FFloatingOriginStats& Stats = Sub->GetStats();
+	TestEqual(TEXT("One rebase recorded"), Stats.NumRebases - StatsBefore.NumRebases, 1);
+	TestTrue(TEXT("Shifted actors counted"), Stats.LastNumActors > 0);
+	TestTrue(TEXT("Cache pass is part of the rebase"), Stats.LastCachePassMs <= Stats.LastRebaseMs);
+	AddInfo(FString::Printf(TEXT("Rebase %.3f ms over %d actors (%.3f us/actor)"), Stats.LastRebaseMs, Stats.LastNumActors, Stats.GetLastMicrosPerActor()));
+
+	// And back, so the editor world is left as it was.
+	TestTrue(TEXT("Rebase back"), Sub->RebaseOrigin(Sub->AbsoluteToLocal(FVector(OriginBefore))));
+	TestTrue(TEXT("Origin restored"), Sub->GetOriginLocation() == OriginBefore);
+	TestTrue(TEXT("Planet restored"), Planet->GetActorLocation().Equals(PlanetLocation, 1e-3));
+	TestTrue(TEXT("Surface frame restored"), Streamer->SurfaceLevelWorldOrigin.Equals(SurfaceOrigin, 1e-3));
+	TestTrue(TEXT("Zero shift is a no-op"), Sub->RebaseOrigin(FVector(0.2, -0.3, 0.1)));
+	TestEqual(TEXT("No-op not counted"), Sub->GetStats().NumRebases - StatsBefore.NumRebases, 2);
+
+	Planet->Destroy();
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,280 @@
+// Copyright Federation Game. All Rights Reserved.
+
+#include "Misc/AutomationTest.h"
+#include "Character/FederationCharacter.h"
+#include "Planet/Planet.h"
+#include "Planet/PlanetGravityComponent.h"
+#include "Planet/PlanetGravitySourceComponent.h"
+#include "Planet/PlanetSurfaceStreamer.h"
+#include "Planet/GravitySourceSubsystem.h"
+#include "Planet/PlanetStreamingSubsystem.h"
+#include "Engine/World.h"
+#include "Tests/AutomationCommon.h"
+#include "ProfilingDebugging/ScopedTimers.h"
+#include "Math/RandomStream.h"
+#include "Misc/CommandLine.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+/**
+ * Headless per-frame cost of the gravity/streaming/character tick path under load.
+ *
+ * Run on Linux (or anywhere) with:
+ *   UnrealEditor-Cmd federation.uproject -ExecCmds="Automation RunTests FederationGame.Core.TickBenchmark;Quit"
+ *     -NullRHI -Unattended -NoSound [-FedBenchmarkDir=<dir>]
+ *
+ * Each scenario writes TickBenchmark_C<N>_P<M>.csv and .json to -FedBenchmarkDir
+ * (default Saved/Automation/Benchmarks) so runs can be diffed for regressions.
+ */
+namespace TickBenchmark
+{
+	constexpr int32 WarmupFrames = 10;
+	constexpr int32 MeasuredFrames = 120;
+	constexpr float DeltaTime = 1.f / 60.f;
+
+	const int32 CharacterCounts[] = { 1, 10, 100, 1000 };
+	const int32 PlanetCounts[] = { 1, 10, 100 };
+
+	/** Per-frame totals (ms) for one tick category. */
+	struct FSeries
+	{
+		FString Name;
+		int32 Instances = 0;
+		TArray<double> FrameMs;
+
+		double Mean() const
+		{
+			double Sum = 0.0;
+			for (const double Ms : FrameMs) Sum += Ms;
+			return FrameMs.Num() > 0 ? Sum / FrameMs.Num() : 0.0;
+		}
+
+		double Percentile(double P) const
+		{
+			if (FrameMs.Num() == 0) return 0.0;
+			TArray<double> Sorted = FrameMs;
+			Sorted.Sort();
+			const int32 Index = FMath::Clamp(FMath::CeilToInt32(P * Sorted.Num()) - 1, 0, Sorted.Num() - 1);
+			return Sorted[Index];
+		}
+	};
+
+	FString GetReportDir()
+	{
+		FString Dir;
+		if (!FParse::Value(FCommandLine::Get(), TEXT("FedBenchmarkDir="), Dir))
+		{
+			Dir = FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("Automation"), TEXT("Benchmarks"));
+		}
+		return Dir;
+	}
+
+	bool WriteReport(const FString& BaseName, int32 NumCharacters, int32 NumPlanets, const TArray<FSeries>& Series, FString& OutCsvPath)
+	{
+		FString Csv = TEXT("Characters,Planets,Frames,Category,Instances,MeanFrameMs,P99FrameMs,MaxFrameMs,MeanPerInstanceUs\n");
+		FString Json = FString::Printf(TEXT("{\n  \"characters\": %d,\n  \"planets\": %d,\n  \"frames\": %d,\n  \"categories\": ["),
+			NumCharacters, NumPlanets, MeasuredFrames);
+
+		for (int32 i = 0; i < Series.Num(); ++i)
+		{
+			const FSeries& S = Series[i];
+			const double Mean = S.Mean();
+			const double P99 = S.Percentile(0.99);
+			const double Max = S.Percentile(1.0);
+			const double PerInstanceUs = S.Instances > 0 ? Mean * 1000.0 / S.Instances : 0.0;
+
+			Csv += FString::Printf(TEXT("%d,%d,%d,%s,%d,%.4f,%.4f,%.4f,%.3f\n"),
+				NumCharacters, NumPlanets, MeasuredFrames, *S.Name, S.Instances, Mean, P99, Max, PerInstanceUs);
+			Json += FString::Printf(TEXT("%s\n    { \"name\": \"%s\", \"instances\": %d, \"mean_ms\": %.4f, \"p99_ms\": %.4f, \"max_ms\": %.4f, \"mean_per_instance_us\": %.3f }"),
+				i > 0 ? TEXT(",") : TEXT(""), *S.Name, S.Instances, Mean, P99, Max, PerInstanceUs);
+		}
+		Json += TEXT("\n  ]\n}\n");
+
+		const FString Dir = GetReportDir();
+		OutCsvPath = FPaths::Combine(Dir, BaseName + TEXT(".csv"));
+		return FFileHelper::SaveStringToFile(Csv, *OutCsvPath)
+			&& FFileHelper::SaveStringToFile(Json, *FPaths::Combine(Dir, BaseName + TEXT(".json")));
+	}
+}
+
+IMPLEMENT_COMPLEX_AUTOMATION_TEST(
+	FTickBenchmark,
+	"FederationGame.Core.TickBenchmark",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::PerfFilter
+)
+
+void FTickBenchmark::GetTests(TArray<FString>& OutBeautifiedNames, TArray<FString>& OutTestCommands) const
+{
+	for (const int32 Characters : TickBenchmark::CharacterCounts)
+	{
+		for (const int32 Planets : TickBenchmark::PlanetCounts)
+		{
+			OutBeautifiedNames.Add(FString::Printf(TEXT("C%d_P%d"), Characters, Planets));
+			OutTestCommands.Add(FString::Printf(TEXT("%d %d"), Characters, Planets));
+		}
+	}
+}
+
+bool FTickBenchmark::RunTest(const FString& Parameters)
+{
+	using namespace TickBenchmark;
+
+	TArray<FString> Args;
+	Parameters.ParseIntoArrayWS(Args);
+	if (Args.Num() != 2) { AddError(FString::Printf(TEXT("Bad parameters '%s'"), *Parameters)); return false; }
+	const int32 NumCharacters = FCString::Atoi(*Args[0]);
+	const int32 NumPlanets = FCString::Atoi(*Args[1]);
+
+	UWorld* World = GEngine->GetWorldContexts()[0].World();
+	if (!World) { AddError(TEXT("No world context")); return false; }
+	UGravitySourceSubsystem* GravitySources = World->GetSubsystem<UGravitySourceSubsystem>();
+	if (!GravitySources) { AddError(TEXT("No gravity source subsystem")); return false; }
+	UPlanetStreamingSubsystem* StreamingManager = World->GetSubsystem<UPlanetStreamingSubsystem>();
+	if (!StreamingManager) { AddError(TEXT("No planet streaming subsystem")); return false; }
+
+	// Planets on a loose grid; characters scattered around them at 1-3 radii.
+	FRandomStream Rng(NumCharacters * 7919 + NumPlanets);
+	constexpr float PlanetRadius = 50000.f;
+	TArray<APlanet*> Planets;
+	for (int32 i = 0; i < NumPlanets; ++i)
+	{
+		const FVector Location(
+			(i % 10) * PlanetRadius * 8.f,
+			((i / 10) % 10) * PlanetRadius * 8.f,
+			(i / 100) * PlanetRadius * 8.f);
+		APlanet* Planet = World->SpawnActor<APlanet>(Location, FRotator::ZeroRotator);
+		if (!Planet) { AddError(TEXT("Failed to spawn planet")); return false; }
+		Planet->PlanetGravitySource->ManualRadius = PlanetRadius;
+		Planets.Add(Planet);
+	}
+
+	TArray<AFederationCharacter*> Characters;
+	for (int32 i = 0; i < NumCharacters; ++i)
+	{
+		const FVector Anchor = Planets[Rng.RandRange(0, Planets.Num() - 1)]->GetActorLocation();
+		const FVector Location = Anchor + Rng.GetUnitVector() * Rng.FRandRange(PlanetRadius, PlanetRadius * 3.f);
+		AFederationCharacter* Character = World->SpawnActor<AFederationCharacter>(Location, FRotator::ZeroRotator);
+		if (!Character) { AddError(TEXT("Failed to spawn character")); return false; }
+		Characters.Add(Character);
+	}
+
+	// Sized up front: the references below must stay valid.
+	TArray<FSeries> Series;
+	Series.SetNum(7);
+	FSeries& CacheSeries = Series[0];
+	CacheSeries.Name = TEXT("GravitySourceSubsystem.RefreshSourceCache");
+	CacheSeries.Instances = NumPlanets;
+	FSeries& BatchSeries = Series[1];
+	BatchSeries.Name = TEXT("GravitySourceSubsystem.RunGravityBatch");
+	BatchSeries.Instances = 1;
+	FSeries& GravitySeries = Series[2];
+	GravitySeries.Name = TEXT("UPlanetGravityComponent.TickComponent");
+	GravitySeries.Instances = NumCharacters;
+	FSeries& SerialGravitySeries = Series[3];
+	SerialGravitySeries.Name = TEXT("UPlanetGravityComponent.TickComponent(Serial)");
+	SerialGravitySeries.Instances = NumCharacters;
+	FSeries& StreamerSeries = Series[4];
+	StreamerSeries.Name = TEXT("PlanetStreamingSubsystem+UPlanetSurfaceStreamer");
+	StreamerSeries.Instances = NumPlanets;
+	FSeries& CharacterSeries = Series[5];
+	CharacterSeries.Name = TEXT("AFederationCharacter.Tick");
+	CharacterSeries.Instances = NumCharacters;
+	FSeries& TotalSeries = Series[6];
+	TotalSeries.Name = TEXT("Total");
+	TotalSeries.Instances = 1;
+
+	// One full rebuild for reference: what every frame used to pay before the cache was dirty-tracked.
+	double RebuildSec = 0.0;
+	{
+		FScopedDurationTimer Timer(RebuildSec);
+		GravitySources->RefreshSourceCache(true);
+	}
+	AddInfo(FString::Printf(TEXT("C=%d P=%d full source cache rebuild: %.4f ms"), NumCharacters, NumPlanets, RebuildSec * 1000.0));
+	const int32 RebuildsBefore = GravitySources->GetNumCacheRebuilds();
+
+	// Same order as a game frame: pre-physics batch, then component and actor ticks. The serial gravity
+	// series is an alternative to the batch plus batched ticks, so it stays out of the total.
+	for (int32 Frame = 0; Frame < WarmupFrames + MeasuredFrames; ++Frame)
+	{
+		double CacheSec = 0.0, BatchSec = 0.0, GravitySec = 0.0, SerialGravitySec = 0.0, StreamerSec = 0.0, CharacterSec = 0.0;
+		{
+			// The refresh a real frame does first; it only rebuilds when a source registered, unregistered or moved.
+			FScopedDurationTimer Timer(CacheSec);
+			GravitySources->RefreshSourceCache();
+		}
+		{
+			FScopedDurationTimer Timer(BatchSec);
+			GravitySources->RunGravityBatch();
+		}
+		for (AFederationCharacter* Character : Characters)
+		{
+			FScopedDurationTimer Timer(GravitySec);
+			Character->GravityComp->TickComponent(DeltaTime, LEVELTICK_All, nullptr);
+		}
+		// The same ticks without the batch, for comparison. GFrameCounter doesn't advance inside one test, so
+		// clear the batched-frame marker or every tick after the first batch would still skip its own solve.
+		for (AFederationCharacter* Character : Characters)
+		{
+			Character->GravityComp->MarkGravityBatched(MAX_uint64);
+			FScopedDurationTimer Timer(SerialGravitySec);
+			Character->GravityComp->TickComponent(DeltaTime, LEVELTICK_All, nullptr);
+		}
+		{
+			// The first character stands in for the player; dormant streamers skip their tick as in a game frame.
+			FScopedDurationTimer Timer(StreamerSec);
+			StreamingManager->UpdateStreamers(Characters[0]);
+			for (APlanet* Planet : Planets)
+			{
+				if (Planet->PlanetSurfaceStreamer->IsStreamingDormant()) continue;
+				Planet->PlanetSurfaceStreamer->TickComponent(DeltaTime, LEVELTICK_All, nullptr);
+			}
+		}
+		for (AFederationCharacter* Character : Characters)
+		{
+			FScopedDurationTimer Timer(CharacterSec);
+			// AFederationCharacter::Tick is protected; dispatch through the public AActor interface.
+			static_cast<AActor*>(Character)->Tick(DeltaTime);
+		}
+
+		if (Frame < WarmupFrames) continue;
+		CacheSeries.FrameMs.Add(CacheSec * 1000.0);
+		BatchSeries.FrameMs.Add(BatchSec * 1000.0);
+		GravitySeries.FrameMs.Add(GravitySec * 1000.0);
+		SerialGravitySeries.FrameMs.Add(SerialGravitySec * 1000.0);
+		StreamerSeries.FrameMs.Add(StreamerSec * 1000.0);
+		CharacterSeries.FrameMs.Add(CharacterSec * 1000.0);
+		TotalSeries.FrameMs.Add((CacheSec + BatchSec + GravitySec + StreamerSec + CharacterSec) * 1000.0);
+	}
+	AddInfo(FString::Printf(TEXT("C=%d P=%d source cache rebuilds during the run: %d"),
+		NumCharacters, NumPlanets, GravitySources->GetNumCacheRebuilds() - RebuildsBefore));
+
+	for (const FSeries& S : Series)
+	{
+		AddInfo(FString::Printf(TEXT("C=%d P=%d %s: mean %.4f ms, p99 %.4f ms"),
+			NumCharacters, NumPlanets, *S.Name, S.Mean(), S.Percentile(0.99)));
+	}
+
+	FString CsvPath;
+	if (WriteReport(FString::Printf(TEXT("TickBenchmark_C%d_P%d"), NumCharacters, NumPlanets), NumCharacters, NumPlanets, Series, CsvPath))
+	{
+		AddInfo(FString::Printf(TEXT("Report written to %s (+ .json)"), *CsvPath));
+	}
+	else
+	{
+		AddWarning(FString::Printf(TEXT("Could not write benchmark report to %s"), *CsvPath));
+	}
+
+	for (AFederationCharacter* Character : Characters)
+	{
+		Character->Destroy();
+	}
+	for (APlanet* Planet : Planets)
+	{
+		Planet->Destroy();
+	}
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
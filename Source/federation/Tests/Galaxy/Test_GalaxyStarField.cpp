@@ -6,6 +6,7 @@
 #include "Tests/AutomationCommon.h"
 #include "Components/InstancedStaticMeshComponent.h"
 #include "Engine/StaticMesh.h"
+#include "Async/TaskGraphInterfaces.h"
 
 #if WITH_DEV_AUTOMATION_TESTS
 
@@ -329,6 +330,78 @@ bool FGalaxyStarFieldClearsOnRegenerate::RunTest(const FString& Parameters)
 	return true;
 }
 
+/**
+ * Test that generation is independent of thread count and that the component holds exactly what was built.
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FGalaxyStarFieldThreadCountIndependent,
+	"FederationGame.Galaxy.StarField.ThreadCountIndependent",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter
+)
+
+bool FGalaxyStarFieldThreadCountIndependent::RunTest(const FString& Parameters)
+{
+	// Arrange
+	UWorld* World = GEngine->GetWorldContexts()[0].World();
+	if (!World)
+	{
+		AddError(TEXT("No world context available for spawning actor"));
+		return false;
+	}
+	
+	AGalaxyStarField* StarField = World->SpawnActor<AGalaxyStarField>();
+	if (!StarField)
+	{
+		AddError(TEXT("Failed to spawn AGalaxyStarField actor"));
+		return false;
+	}
+	
+	// Several chunks, a partial last one, and field stars left over from the arm split
+	SetupTestMesh(StarField);
+	StarField->RandomSeed = 42;
+	StarField->StarCount = 5003;
+	StarField->SpiralArmCount = 3;
+	
+	// Act
+	TArray<FTransform> SerialTransforms, ParallelTransforms;
+	TArray<float> SerialData, ParallelData;
+	StarField->BuildStarInstances(SerialTransforms, SerialData, true);
+	StarField->BuildStarInstances(ParallelTransforms, ParallelData, false);
+	StarField->RegenerateStars();
+	
+	// Assert - bitwise identical, not just close
+	TestEqual(TEXT("One transform per star"), ParallelTransforms.Num(), 5003);
+	TestEqual(TEXT("Four custom floats per star"), ParallelData.Num(), 5003 * 4);
+	TestTrue(TEXT("Custom data matches single-threaded"), SerialData == ParallelData);
+	
+	bool bTransformsMatch = SerialTransforms.Num() == ParallelTransforms.Num();
+	for (int32 i = 0; bTransformsMatch && i < SerialTransforms.Num(); ++i)
+	{
+		bTransformsMatch = SerialTransforms[i].Equals(ParallelTransforms[i], 0.0);
+	}
+	TestTrue(TEXT("Transforms match single-threaded"), bTransformsMatch);
+	
+	// The component got the same data in one batch
+	UInstancedStaticMeshComponent* Component = StarField->StarMeshComponent;
+	TestEqual(TEXT("Component has every star"), StarField->GetStarCount(), 5003);
+	TestTrue(TEXT("Component custom data is the built data"), Component->PerInstanceSMCustomData == ParallelData);
+	FTransform Last;
+	Component->GetInstanceTransform(5002, Last, false);
+	TestTrue(TEXT("Last instance placed as built"), Last.Equals(ParallelTransforms[5002], 1e-3));
+	
+	// A different seed gives a different galaxy
+	StarField->RandomSeed = 43;
+	TArray<FTransform> OtherTransforms;
+	TArray<float> OtherData;
+	StarField->BuildStarInstances(OtherTransforms, OtherData);
+	TestFalse(TEXT("Seed changes the output"), OtherData == ParallelData);
+	
+	// Cleanup
+	StarField->Destroy();
+	
+	return true;
+}
+
 /**
  * Performance test: Verify 10,000 stars can be generated efficiently.
  */
@@ -379,4 +452,72 @@ bool FGalaxyStarFieldPerformance10K::RunTest(const FString& Parameters)
 	return true;
 }
 
+/**
+ * Benchmark: regenerating 100,000 stars (the StarCount ClampMax) should take tens of milliseconds.
+ * Reports the best of several runs, split into building the data (parallel and single-threaded) and
+ * the full regenerate including the batched submit to the component.
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FGalaxyStarFieldPerformance100K,
+	"FederationGame.Galaxy.StarField.Performance.Generates100KStars",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter
+)
+
+bool FGalaxyStarFieldPerformance100K::RunTest(const FString& Parameters)
+{
+	// Arrange
+	UWorld* World = GEngine->GetWorldContexts()[0].World();
+	if (!World)
+	{
+		AddError(TEXT("No world context available for spawning actor"));
+		return false;
+	}
+	
+	AGalaxyStarField* StarField = World->SpawnActor<AGalaxyStarField>();
+	if (!StarField)
+	{
+		AddError(TEXT("Failed to spawn AGalaxyStarField actor"));
+		return false;
+	}
+	
+	SetupTestMesh(StarField);
+	StarField->StarCount = 100000;
+	
+	// Act - best of a few runs, so one scheduling hiccup doesn't decide the result
+	constexpr int32 NumRuns = 5;
+	double BestRegenerateMs = TNumericLimits<double>::Max();
+	double BestParallelBuildMs = TNumericLimits<double>::Max();
+	double BestSerialBuildMs = TNumericLimits<double>::Max();
+	TArray<FTransform> Transforms;
+	TArray<float> CustomData;
+	for (int32 Run = 0; Run < NumRuns; ++Run)
+	{
+		double StartTime = FPlatformTime::Seconds();
+		StarField->RegenerateStars();
+		BestRegenerateMs = FMath::Min(BestRegenerateMs, (FPlatformTime::Seconds() - StartTime) * 1000.0);
+		
+		StartTime = FPlatformTime::Seconds();
+		StarField->BuildStarInstances(Transforms, CustomData, false);
+		BestParallelBuildMs = FMath::Min(BestParallelBuildMs, (FPlatformTime::Seconds() - StartTime) * 1000.0);
+		
+		StartTime = FPlatformTime::Seconds();
+		StarField->BuildStarInstances(Transforms, CustomData, true);
+		BestSerialBuildMs = FMath::Min(BestSerialBuildMs, (FPlatformTime::Seconds() - StartTime) * 1000.0);
+	}
+	
+	// Assert
+	TestEqual(TEXT("Should generate 100,000 stars"), StarField->GetStarCount(), 100000);
+	
+	AddInfo(FString::Printf(TEXT("100,000 stars: regenerate %.2f ms; build %.2f ms parallel, %.2f ms single-threaded (%d workers)"),
+		BestRegenerateMs, BestParallelBuildMs, BestSerialBuildMs, FTaskGraphInterface::Get().GetNumWorkerThreads()));
+	
+	// Target is tens of ms; the bound leaves room for slow CI machines while still catching a return to seconds
+	TestTrue(TEXT("Regenerating 100,000 stars should take under 250 ms"), BestRegenerateMs < 250.0);
+	
+	// Cleanup
+	StarField->Destroy();
+	
+	return true;
+}
+
 #endif // WITH_DEV_AUTOMATION_TESTS
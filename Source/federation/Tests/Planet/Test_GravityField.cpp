@@ -0,0 +1,164 @@
+// Copyright Federation Game. All Rights Reserved.
+
+#include "Misc/AutomationTest.h"
+#include "Planet/GravityField.h"
+#include "Planet/GravitySourceSubsystem.h"
+#include "Planet/PlanetGravitySourceComponent.h"
+#include "Engine/World.h"
+#include "Engine/StaticMeshActor.h"
+#include "Tests/AutomationCommon.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace GravityFieldTest
+{
+	struct FSourceParams
+	{
+		FVector Center;
+		float Radius;
+		float Scale;
+		float Exponent;
+		float MinMul;
+		float MaxMul;
+	};
+
+	/** Scalar reference: the per-source loop the batched field replaces. */
+	void EvaluateScalar(const TArray<FSourceParams>& Sources, const FVector& Point, FVector& OutAccel, float& OutBest)
+	{
+		OutAccel = FVector::ZeroVector;
+		OutBest = 0.f;
+		for (const FSourceParams& S : Sources)
+		{
+			const FVector ToSource = S.Center - Point;
+			const float Dist = ToSource.Size();
+			if (Dist < 1.f) continue;
+			const float Strength = UPlanetGravitySourceComponent::ComputeStrengthFromParams(S.Radius, S.Scale, S.Exponent, S.MinMul, S.MaxMul, Dist);
+			if (Strength <= KINDA_SMALL_NUMBER) continue;
+			OutBest = FMath::Max(OutBest, Strength);
+			OutAccel += ToSource.GetSafeNormal() * Strength;
+		}
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FGravityFieldMatchesScalarPath,
+	"FederationGame.Planet.GravityField.MatchesScalarPath",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter
+)
+
+bool FGravityFieldMatchesScalarPath::RunTest(const FString& Parameters)
+{
+	using namespace GravityFieldTest;
+
+	// Mixed exponents (both kernels), a cutoff source and a count that is not a multiple of the SIMD width.
+	TArray<FSourceParams> Sources;
+	Sources.Add({ FVector(0.f, 0.f, 0.f), 1000.f, 1.f, 2.f, 1.f, 0.f });
+	Sources.Add({ FVector(20000.f, 5000.f, 0.f), 2500.f, 0.8f, 2.f, 1.f, 0.f });
+	Sources.Add({ FVector(-8000.f, 0.f, 12000.f), 800.f, 1.2f, 3.f, 1.f, 4.f });
+	Sources.Add({ FVector(3000.f, -15000.f, -2000.f), 1500.f, 1.f, 1.5f, 0.5f, 0.f });
+	Sources.Add({ FVector(2000000.f, 0.f, 0.f), 50000.f, 1.f, 2.f, 1.f, 10.f });
+	Sources.Add({ FVector(-2000000.f, 0.f, 0.f), 50000.f, 1.f, 2.f, 1.f, 0.f });
+	Sources.Add({ FVector(500.f, 500.f, 500.f), 200.f, 2.f, 2.5f, 2.f, 0.f });
+
+	FGravityField Field;
+	for (const FSourceParams& S : Sources)
+	{
+		Field.AddSource(S.Center, S.Radius, S.Scale, S.Exponent, S.MinMul, S.MaxMul);
+	}
+	TestEqual(TEXT("Field should hold every source"), Field.Num(), Sources.Num());
+	TestEqual(TEXT("Exponent-2 sources should use the inverse-square block"), Field.NumInverseSquare(), 4);
+
+	TArray<FVector> Points;
+	Points.Add(FVector(0.f, 0.f, 1500.f));
+	Points.Add(FVector(0.f, 0.f, 0.f)); // Exactly at a source center.
+	Points.Add(FVector(10000.f, 2000.f, 0.f));
+	Points.Add(FVector(-6000.f, 300.f, 9000.f));
+	Points.Add(FVector(1950000.f, 1000.f, -500.f));
+	Points.Add(FVector(50000.f, -40000.f, 20000.f));
+
+	TArray<FVector> Accel;
+	TArray<float> Best;
+	Accel.SetNumZeroed(Points.Num());
+	Best.SetNumZeroed(Points.Num());
+	Field.Evaluate(Points, Accel, Best);
+
+	for (int32 i = 0; i < Points.Num(); ++i)
+	{
+		FVector ExpectedAccel;
+		float ExpectedBest;
+		EvaluateScalar(Sources, Points[i], ExpectedAccel, ExpectedBest);
+
+		const double Tolerance = FMath::Max(1e-5, ExpectedAccel.Size() * 1e-4);
+		TestTrue(FString::Printf(TEXT("Accel should match scalar path at %s (got %s, expected %s)"),
+			*Points[i].ToString(), *Accel[i].ToString(), *ExpectedAccel.ToString()),
+			Accel[i].Equals(ExpectedAccel, Tolerance));
+		TestEqual(FString::Printf(TEXT("BestStrength should match scalar path at %s"), *Points[i].ToString()),
+			Best[i], ExpectedBest, FMath::Max(1e-5f, ExpectedBest * 1e-4f));
+	}
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FGravityFieldEmptyFieldIsZero,
+	"FederationGame.Planet.GravityField.EmptyFieldIsZero",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter
+)
+
+bool FGravityFieldEmptyFieldIsZero::RunTest(const FString& Parameters)
+{
+	FGravityField Field;
+	const FVector Point(100.f, 200.f, 300.f);
+	FVector Accel(1.f);
+	Field.Evaluate(MakeArrayView(&Point, 1), MakeArrayView(&Accel, 1));
+	TestTrue(TEXT("An empty field should produce zero acceleration"), Accel.IsZero());
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FGravitySourceSubsystemBatchMatchesQuery,
+	"FederationGame.Planet.GravityField.SubsystemBatchMatchesQuery",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter
+)
+
+bool FGravitySourceSubsystemBatchMatchesQuery::RunTest(const FString& Parameters)
+{
+	UWorld* World = GEngine->GetWorldContexts()[0].World();
+	if (!World) { AddError(TEXT("No world context")); return false; }
+	UGravitySourceSubsystem* Subsystem = World->GetSubsystem<UGravitySourceSubsystem>();
+	if (!Subsystem) { AddError(TEXT("No subsystem")); return false; }
+
+	AStaticMeshActor* PlanetA = World->SpawnActor<AStaticMeshActor>(FVector(0.f, 0.f, -5000.f), FRotator::ZeroRotator);
+	AStaticMeshActor* PlanetB = World->SpawnActor<AStaticMeshActor>(FVector(30000.f, 0.f, 0.f), FRotator::ZeroRotator);
+	if (!PlanetA || !PlanetB) { AddError(TEXT("Failed to spawn planets")); return false; }
+
+	UPlanetGravitySourceComponent* SourceA = NewObject<UPlanetGravitySourceComponent>(PlanetA, TEXT("GravitySource"));
+	SourceA->RegisterComponent();
+	SourceA->ManualRadius = 2000.f;
+	UPlanetGravitySourceComponent* SourceB = NewObject<UPlanetGravitySourceComponent>(PlanetB, TEXT("GravitySource"));
+	SourceB->RegisterComponent();
+	SourceB->ManualRadius = 4000.f;
+	SourceB->FalloffExponent = 1.5f;
+	Subsystem->RefreshSourceCache(true);
+
+	TArray<FVector> Points;
+	Points.Add(FVector(0.f, 0.f, 0.f));
+	Points.Add(FVector(15000.f, 0.f, 0.f));
+	Points.Add(FVector(28000.f, 3000.f, 1000.f));
+	TArray<FVector> Accel;
+	Accel.SetNumZeroed(Points.Num());
+	Subsystem->EvaluateGravityField(Points, Accel);
+
+	for (int32 i = 0; i < Points.Num(); ++i)
+	{
+		const FGravityQueryResult Query = Subsystem->QueryGravityAt(Points[i]);
+		const double Tolerance = FMath::Max(1e-5, Query.WeightedGravity.Size() * 1e-4);
+		TestTrue(FString::Printf(TEXT("Batched result should match QueryGravityAt at %s"), *Points[i].ToString()),
+			Accel[i].Equals(Query.WeightedGravity, Tolerance));
+	}
+
+	PlanetA->Destroy();
+	PlanetB->Destroy();
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
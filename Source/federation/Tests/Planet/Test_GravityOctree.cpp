@@ -0,0 +1,220 @@
+// Copyright Federation Game. All Rights Reserved.
+
+#include "Misc/AutomationTest.h"
+#include "Planet/GravityOctree.h"
+#include "Planet/GravityField.h"
+#include "Planet/GravitySourceSubsystem.h"
+#include "Planet/PlanetGravitySourceComponent.h"
+#include "Engine/World.h"
+#include "Engine/StaticMeshActor.h"
+#include "HAL/PlatformTime.h"
+#include "Math/RandomStream.h"
+#include "Tests/AutomationCommon.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace GravityOctreeTest
+{
+	/** Star-system-like layout: a flattened disc of bodies, a few big planets and many moons/stations. */
+	void BuildScene(int32 NumSources, int32 Seed, FGravityOctree& OutTree, FGravityField& OutExact)
+	{
+		FRandomStream Rng(Seed);
+		OutTree.Reset();
+		OutExact.Reset();
+		for (int32 i = 0; i < NumSources; ++i)
+		{
+			const FVector Center(Rng.FRandRange(-2.0e6f, 2.0e6f), Rng.FRandRange(-2.0e6f, 2.0e6f), Rng.FRandRange(-2.0e5f, 2.0e5f));
+			const float Radius = (i % 50 == 0) ? Rng.FRandRange(50000.f, 100000.f) : Rng.FRandRange(5000.f, 20000.f);
+			OutTree.AddSource(Center, Radius, 1.f, 1.f);
+			OutExact.AddSource(Center, Radius, 1.f, 2.f, 1.f, 0.f);
+		}
+		OutTree.Build();
+	}
+
+	void MakePoints(int32 NumPoints, int32 Seed, TArray<FVector>& OutPoints)
+	{
+		FRandomStream Rng(Seed);
+		OutPoints.Reset(NumPoints);
+		for (int32 i = 0; i < NumPoints; ++i)
+		{
+			OutPoints.Add(FVector(Rng.FRandRange(-2.0e6f, 2.0e6f), Rng.FRandRange(-2.0e6f, 2.0e6f), Rng.FRandRange(-2.0e5f, 2.0e5f)));
+		}
+	}
+
+	/** Mean and max of |approx - exact| / |exact| over all points. */
+	void MeasureError(const FGravityOctree& Tree, float OpeningAngle, const TArray<FVector>& Points, const TArray<FVector>& Exact,
+		double& OutMean, double& OutMax)
+	{
+		OutMean = 0.0;
+		OutMax = 0.0;
+		int32 Counted = 0;
+		for (int32 i = 0; i < Points.Num(); ++i)
+		{
+			const double ExactSize = Exact[i].Size();
+			if (ExactSize < 1e-8) continue;
+			FVector Approx = FVector::ZeroVector;
+			float Best = 0.f;
+			Tree.Evaluate(Points[i], OpeningAngle, Approx, Best);
+			const double Error = (Approx - Exact[i]).Size() / ExactSize;
+			OutMean += Error;
+			OutMax = FMath::Max(OutMax, Error);
+			++Counted;
+		}
+		OutMean = Counted > 0 ? OutMean / Counted : 0.0;
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FGravityOctreeZeroAngleIsExact,
+	"FederationGame.Planet.GravityOctree.ZeroOpeningAngleIsExact",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter
+)
+
+bool FGravityOctreeZeroAngleIsExact::RunTest(const FString& Parameters)
+{
+	using namespace GravityOctreeTest;
+
+	FGravityOctree Tree;
+	FGravityField Exact;
+	BuildScene(300, 1234, Tree, Exact);
+
+	TArray<FVector> Points;
+	MakePoints(64, 99, Points);
+	TArray<FVector> ExactAccel;
+	ExactAccel.SetNumZeroed(Points.Num());
+	Exact.Evaluate(Points, ExactAccel);
+
+	double Mean = 0.0, Max = 0.0;
+	MeasureError(Tree, 0.f, Points, ExactAccel, Mean, Max);
+	TestTrue(FString::Printf(TEXT("Opening angle 0 should match the exact sum (max rel error %g)"), Max), Max < 1e-6);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FGravityOctreeApproximationIsAccurate,
+	"FederationGame.Planet.GravityOctree.ApproximationIsAccurate",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter
+)
+
+bool FGravityOctreeApproximationIsAccurate::RunTest(const FString& Parameters)
+{
+	using namespace GravityOctreeTest;
+
+	FGravityOctree Tree;
+	FGravityField Exact;
+	BuildScene(1000, 4321, Tree, Exact);
+
+	TArray<FVector> Points;
+	MakePoints(128, 7, Points);
+	TArray<FVector> ExactAccel;
+	ExactAccel.SetNumZeroed(Points.Num());
+	Exact.Evaluate(Points, ExactAccel);
+
+	double Mean = 0.0, Max = 0.0;
+	MeasureError(Tree, 0.5f, Points, ExactAccel, Mean, Max);
+	TestTrue(FString::Printf(TEXT("Theta 0.5 mean relative error should be under 1%% (got %g)"), Mean), Mean < 0.01);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FGravityOctreeSubsystemMode,
+	"FederationGame.Planet.GravityOctree.SubsystemBarnesHutMode",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter
+)
+
+bool FGravityOctreeSubsystemMode::RunTest(const FString& Parameters)
+{
+	UWorld* World = GEngine->GetWorldContexts()[0].World();
+	if (!World) { AddError(TEXT("No world context")); return false; }
+	UGravitySourceSubsystem* Subsystem = World->GetSubsystem<UGravitySourceSubsystem>();
+	if (!Subsystem) { AddError(TEXT("No subsystem")); return false; }
+
+	TArray<AStaticMeshActor*> Planets;
+	for (int32 i = 0; i < 12; ++i)
+	{
+		AStaticMeshActor* Planet = World->SpawnActor<AStaticMeshActor>(FVector(100000.f * i, 20000.f * (i % 3), 0.f), FRotator::ZeroRotator);
+		if (!Planet) { AddError(TEXT("Failed to spawn planet")); return false; }
+		UPlanetGravitySourceComponent* Source = NewObject<UPlanetGravitySourceComponent>(Planet, TEXT("GravitySource"));
+		Source->RegisterComponent();
+		Source->ManualRadius = 5000.f;
+		Source->FalloffExponent = (i == 5) ? 1.5f : 2.f; // One residual (exact) source.
+		Planets.Add(Planet);
+	}
+
+	const FVector Location(-20000.f, 0.f, 3000.f);
+	Subsystem->RefreshSourceCache(true);
+	const FGravityQueryResult ExactResult = Subsystem->QueryGravityAt(Location);
+
+	Subsystem->SetBarnesHutEnabled(true);
+	Subsystem->SetBarnesHutOpeningAngle(0.5f);
+	Subsystem->RefreshSourceCache(true);
+	const FGravityQueryResult Approx = Subsystem->QueryGravityAt(Location);
+	Subsystem->SetBarnesHutEnabled(false);
+
+	TestEqual(TEXT("Barnes-Hut mode should report the same source count"), Approx.NumSources, ExactResult.NumSources);
+	const double Error = (Approx.WeightedGravity - ExactResult.WeightedGravity).Size() / FMath::Max(1e-8, ExactResult.WeightedGravity.Size());
+	TestTrue(FString::Printf(TEXT("Barnes-Hut mode should stay within 1%% of the exact sum (got %g)"), Error), Error < 0.01);
+
+	for (AStaticMeshActor* Planet : Planets)
+	{
+		Planet->Destroy();
+	}
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FGravityOctreeBenchmark,
+	"FederationGame.Planet.GravityOctree.Benchmark",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::PerfFilter
+)
+
+bool FGravityOctreeBenchmark::RunTest(const FString& Parameters)
+{
+	using namespace GravityOctreeTest;
+
+	const int32 SourceCounts[] = { 100, 1000, 5000 };
+	const float OpeningAngles[] = { 0.3f, 0.5f, 0.8f, 1.2f };
+	constexpr int32 NumPoints = 512;
+
+	TArray<FVector> Points;
+	MakePoints(NumPoints, 2024, Points);
+	TArray<FVector> ExactAccel;
+	ExactAccel.SetNumZeroed(NumPoints);
+
+	for (const int32 NumSources : SourceCounts)
+	{
+		FGravityOctree Tree;
+		FGravityField Exact;
+		const double BuildStart = FPlatformTime::Seconds();
+		BuildScene(NumSources, 555 + NumSources, Tree, Exact);
+		const double BuildMs = (FPlatformTime::Seconds() - BuildStart) * 1000.0;
+
+		const double ExactStart = FPlatformTime::Seconds();
+		Exact.Evaluate(Points, ExactAccel);
+		const double ExactUs = (FPlatformTime::Seconds() - ExactStart) * 1.0e6 / NumPoints;
+
+		AddInfo(FString::Printf(TEXT("N=%d: build %.2f ms (%d nodes), exact SIMD %.2f us/query"), NumSources, BuildMs, Tree.NumNodes(), ExactUs));
+
+		for (const float Theta : OpeningAngles)
+		{
+			int64 Visited = 0;
+			const double Start = FPlatformTime::Seconds();
+			for (const FVector& Point : Points)
+			{
+				FVector Accel = FVector::ZeroVector;
+				float Best = 0.f;
+				Visited += Tree.Evaluate(Point, Theta, Accel, Best);
+			}
+			const double ApproxUs = (FPlatformTime::Seconds() - Start) * 1.0e6 / NumPoints;
+
+			double Mean = 0.0, Max = 0.0;
+			MeasureError(Tree, Theta, Points, ExactAccel, Mean, Max);
+			AddInfo(FString::Printf(TEXT("  theta=%.1f: %.2f us/query (%.1fx), %.1f nodes/query, rel error mean %.4f%% max %.4f%%"),
+				Theta, ApproxUs, ExactUs / FMath::Max(ApproxUs, 1e-6), static_cast<double>(Visited) / NumPoints, Mean * 100.0, Max * 100.0));
+		}
+	}
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
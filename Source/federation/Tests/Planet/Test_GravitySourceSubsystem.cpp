@@ -0,0 +1,438 @@
+// Copyright Federation Game. All Rights Reserved.
+
+#include "Misc/AutomationTest.h"
+#include "Planet/GravitySourceSubsystem.h"
+#include "Planet/PlanetGravitySourceComponent.h"
+#include "Engine/World.h"
+#include "Engine/StaticMeshActor.h"
+#include "EngineUtils.h"
+#include "HAL/PlatformTime.h"
+#include "Math/RandomStream.h"
+#include "Tests/AutomationCommon.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace GravitySourceSubsystemTest
+{
+	AStaticMeshActor* SpawnSource(UWorld* World, const FVector& Location, float ManualRadius, float FalloffExponent, UPlanetGravitySourceComponent*& OutSource)
+	{
+		AStaticMeshActor* Planet = World->SpawnActor<AStaticMeshActor>(Location, FRotator::ZeroRotator);
+		if (!Planet) return nullptr;
+		OutSource = NewObject<UPlanetGravitySourceComponent>(Planet, TEXT("GravitySource"));
+		OutSource->RegisterComponent();
+		OutSource->ManualRadius = ManualRadius;
+		OutSource->FalloffExponent = FalloffExponent;
+		return Planet;
+	}
+
+	/** Bounded sources scattered over galaxy-scale coordinates (influence spheres of 8-40 km). */
+	void SpawnGalaxy(UWorld* World, int32 NumSources, int32 Seed, TArray<AActor*>& OutActors)
+	{
+		FRandomStream Rng(Seed);
+		for (int32 i = 0; i < NumSources; ++i)
+		{
+			const FVector Location(Rng.FRandRange(-1.0e9f, 1.0e9f), Rng.FRandRange(-1.0e9f, 1.0e9f), Rng.FRandRange(-1.0e8f, 1.0e8f));
+			UPlanetGravitySourceComponent* Source = nullptr;
+			AStaticMeshActor* Planet = SpawnSource(World, Location, Rng.FRandRange(200000.f, 1000000.f), 2.f, Source);
+			if (!Planet) continue;
+			Source->MaxInfluenceDistanceMultiplier = 4.f;
+			OutActors.Add(Planet);
+		}
+	}
+
+	/** Half the points sit inside some influence volume, half in deep space. */
+	void MakeGalaxyQueries(const TArray<AActor*>& Planets, int32 NumQueries, int32 Seed, TArray<FVector>& OutPoints)
+	{
+		FRandomStream Rng(Seed);
+		for (int32 i = 0; i < NumQueries; ++i)
+		{
+			if ((i & 1) == 0 && Planets.Num() > 0)
+			{
+				const AActor* Planet = Planets[Rng.RandRange(0, Planets.Num() - 1)];
+				OutPoints.Add(Planet->GetActorLocation() + Rng.GetUnitVector() * Rng.FRandRange(500000.f, 3000000.f));
+			}
+			else
+			{
+				OutPoints.Add(FVector(Rng.FRandRange(-1.0e9f, 1.0e9f), Rng.FRandRange(-1.0e9f, 1.0e9f), Rng.FRandRange(-1.0e8f, 1.0e8f)));
+			}
+		}
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FGravitySourceSubsystemExists,
+	"FederationGame.Planet.GravitySourceSubsystem.SubsystemExists",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter
+)
+
+bool FGravitySourceSubsystemExists::RunTest(const FString& Parameters)
+{
+	UWorld* World = GEngine->GetWorldContexts()[0].World();
+	if (!World) { AddError(TEXT("No world context")); return false; }
+
+	TestNotNull(TEXT("GravitySourceSubsystem should exist"), World->GetSubsystem<UGravitySourceSubsystem>());
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FGravitySourceSubsystemRegisterUnregister,
+	"FederationGame.Planet.GravitySourceSubsystem.RegisterUnregister",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter
+)
+
+bool FGravitySourceSubsystemRegisterUnregister::RunTest(const FString& Parameters)
+{
+	UWorld* World = GEngine->GetWorldContexts()[0].World();
+	if (!World) { AddError(TEXT("No world context")); return false; }
+	UGravitySourceSubsystem* Subsystem = World->GetSubsystem<UGravitySourceSubsystem>();
+	if (!Subsystem) { AddError(TEXT("No subsystem")); return false; }
+
+	const int32 Before = Subsystem->GetNumRegisteredSources();
+
+	UPlanetGravitySourceComponent* Source = nullptr;
+	AStaticMeshActor* Planet = GravitySourceSubsystemTest::SpawnSource(World, FVector::ZeroVector, 500.f, 2.f, Source);
+	if (!Planet) { AddError(TEXT("Failed to spawn planet")); return false; }
+
+	TestEqual(TEXT("Registering the component should add one source"), Subsystem->GetNumRegisteredSources(), Before + 1);
+
+	Source->UnregisterComponent();
+	TestEqual(TEXT("Unregistering the component should remove the source"), Subsystem->GetNumRegisteredSources(), Before);
+
+	Planet->Destroy();
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FGravitySourceSubsystemIgnoresDuplicates,
+	"FederationGame.Planet.GravitySourceSubsystem.IgnoresDuplicateRegistration",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter
+)
+
+bool FGravitySourceSubsystemIgnoresDuplicates::RunTest(const FString& Parameters)
+{
+	UWorld* World = GEngine->GetWorldContexts()[0].World();
+	if (!World) { AddError(TEXT("No world context")); return false; }
+	UGravitySourceSubsystem* Subsystem = World->GetSubsystem<UGravitySourceSubsystem>();
+	if (!Subsystem) { AddError(TEXT("No subsystem")); return false; }
+
+	UPlanetGravitySourceComponent* Source = nullptr;
+	AStaticMeshActor* Planet = GravitySourceSubsystemTest::SpawnSource(World, FVector::ZeroVector, 500.f, 2.f, Source);
+	if (!Planet) { AddError(TEXT("Failed to spawn planet")); return false; }
+
+	const int32 Count = Subsystem->GetNumRegisteredSources();
+	Subsystem->RegisterSource(Source);
+	TestEqual(TEXT("Registering the same source twice should not duplicate it"), Subsystem->GetNumRegisteredSources(), Count);
+
+	Planet->Destroy();
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FGravitySourceSubsystemMatchesActorScan,
+	"FederationGame.Planet.GravitySourceSubsystem.MatchesLegacyActorScan",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter
+)
+
+bool FGravitySourceSubsystemMatchesActorScan::RunTest(const FString& Parameters)
+{
+	UWorld* World = GEngine->GetWorldContexts()[0].World();
+	if (!World) { AddError(TEXT("No world context")); return false; }
+	UGravitySourceSubsystem* Subsystem = World->GetSubsystem<UGravitySourceSubsystem>();
+	if (!Subsystem) { AddError(TEXT("No subsystem")); return false; }
+
+	UPlanetGravitySourceComponent* SourceA = nullptr;
+	UPlanetGravitySourceComponent* SourceB = nullptr;
+	UPlanetGravitySourceComponent* SourceC = nullptr;
+	AStaticMeshActor* PlanetA = GravitySourceSubsystemTest::SpawnSource(World, FVector(0.f, 0.f, 0.f), 1000.f, 2.f, SourceA);
+	AStaticMeshActor* PlanetB = GravitySourceSubsystemTest::SpawnSource(World, FVector(20000.f, 5000.f, 0.f), 2500.f, 1.5f, SourceB);
+	AStaticMeshActor* PlanetC = GravitySourceSubsystemTest::SpawnSource(World, FVector(-8000.f, 0.f, 12000.f), 800.f, 3.f, SourceC);
+	if (!PlanetA || !PlanetB || !PlanetC) { AddError(TEXT("Failed to spawn planets")); return false; }
+	SourceC->MaxInfluenceDistanceMultiplier = 4.f;
+
+	Subsystem->RefreshSourceCache(true);
+
+	const FVector Samples[] = {
+		FVector(0.f, 0.f, 1500.f),
+		FVector(10000.f, 2000.f, 0.f),
+		FVector(-6000.f, 300.f, 9000.f),
+		FVector(50000.f, -40000.f, 20000.f)
+	};
+
+	for (const FVector& Location : Samples)
+	{
+		// Reference: the per-tick actor scan the registry replaces.
+		FVector ExpectedGravity = FVector::ZeroVector;
+		float ExpectedBest = 0.f;
+		for (TActorIterator<AActor> It(World); It; ++It)
+		{
+			UPlanetGravitySourceComponent* Source = It->FindComponentByClass<UPlanetGravitySourceComponent>();
+			if (!Source || !Source->bAffectsGravity) continue;
+			const FVector ToPlanet = It->GetActorLocation() - Location;
+			const float Dist = ToPlanet.Size();
+			if (Dist < 1.f) continue;
+			const float Strength = Source->ComputeGravityStrengthAtDistance(Dist);
+			if (Strength <= KINDA_SMALL_NUMBER) continue;
+			ExpectedBest = FMath::Max(ExpectedBest, Strength);
+			ExpectedGravity += ToPlanet.GetSafeNormal() * Strength;
+		}
+
+		const FGravityQueryResult Result = Subsystem->QueryGravityAt(Location);
+		TestTrue(FString::Printf(TEXT("WeightedGravity should match actor scan at %s"), *Location.ToString()),
+			Result.WeightedGravity.Equals(ExpectedGravity, 1e-4f));
+		TestEqual(FString::Printf(TEXT("BestStrength should match actor scan at %s"), *Location.ToString()),
+			Result.BestStrength, ExpectedBest, 1e-5f);
+	}
+
+	PlanetA->Destroy();
+	PlanetB->Destroy();
+	PlanetC->Destroy();
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FGravitySourceSubsystemIgnoreActorExcluded,
+	"FederationGame.Planet.GravitySourceSubsystem.IgnoreActorExcluded",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter
+)
+
+bool FGravitySourceSubsystemIgnoreActorExcluded::RunTest(const FString& Parameters)
+{
+	UWorld* World = GEngine->GetWorldContexts()[0].World();
+	if (!World) { AddError(TEXT("No world context")); return false; }
+	UGravitySourceSubsystem* Subsystem = World->GetSubsystem<UGravitySourceSubsystem>();
+	if (!Subsystem) { AddError(TEXT("No subsystem")); return false; }
+
+	UPlanetGravitySourceComponent* Source = nullptr;
+	AStaticMeshActor* Planet = GravitySourceSubsystemTest::SpawnSource(World, FVector(0.f, 0.f, -3000.f), 1000.f, 2.f, Source);
+	if (!Planet) { AddError(TEXT("Failed to spawn planet")); return false; }
+	Subsystem->RefreshSourceCache(true);
+
+	const FGravityQueryResult WithPlanet = Subsystem->QueryGravityAt(FVector::ZeroVector);
+	const FGravityQueryResult WithoutPlanet = Subsystem->QueryGravityAt(FVector::ZeroVector, Planet);
+	TestEqual(TEXT("Ignoring the planet should drop exactly one source"), WithoutPlanet.NumSources, WithPlanet.NumSources - 1);
+
+	Planet->Destroy();
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FGravitySourceSubsystemCacheRebuildsOnlyWhenDirty,
+	"FederationGame.Planet.GravitySourceSubsystem.CacheRebuildsOnlyWhenDirty",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter
+)
+
+bool FGravitySourceSubsystemCacheRebuildsOnlyWhenDirty::RunTest(const FString& Parameters)
+{
+	UWorld* World = GEngine->GetWorldContexts()[0].World();
+	if (!World) { AddError(TEXT("No world context")); return false; }
+	UGravitySourceSubsystem* Subsystem = World->GetSubsystem<UGravitySourceSubsystem>();
+	if (!Subsystem) { AddError(TEXT("No subsystem")); return false; }
+
+	UPlanetGravitySourceComponent* Source = nullptr;
+	AStaticMeshActor* Planet = GravitySourceSubsystemTest::SpawnSource(World, FVector(0.f, 0.f, -3000.f), 1000.f, 2.f, Source);
+	if (!Planet) { AddError(TEXT("Failed to spawn planet")); return false; }
+	TestTrue(TEXT("Registering should flag the cache"), Subsystem->IsSourceCacheDirty());
+
+	// Steady state: however many queries or refreshes, nothing is rebuilt.
+	Subsystem->RefreshSourceCache();
+	const int32 Rebuilds = Subsystem->GetNumCacheRebuilds();
+	for (int32 i = 0; i < 10; ++i)
+	{
+		Subsystem->RefreshSourceCache();
+		Subsystem->QueryGravityAt(FVector(0.f, 0.f, float(i)));
+	}
+	TestEqual(TEXT("Unchanged sources should not rebuild"), Subsystem->GetNumCacheRebuilds(), Rebuilds);
+
+	// Moving the source flags it; the next query sees the new position.
+	Planet->SetActorLocation(FVector(0.f, 0.f, 3000.f));
+	TestTrue(TEXT("Moving a source should flag the cache"), Subsystem->IsSourceCacheDirty());
+	const FGravityQueryResult Moved = Subsystem->QueryGravityAt(FVector::ZeroVector);
+	TestEqual(TEXT("Moved source should rebuild once"), Subsystem->GetNumCacheRebuilds(), Rebuilds + 1);
+	TestTrue(TEXT("Gravity should follow the moved source"), Moved.WeightedGravity.Z > 0.f);
+
+	// Direct parameter writes need no marking: the next query reflects them.
+	Source->SurfaceGravityScale *= 2.f;
+	const FGravityQueryResult Scaled = Subsystem->QueryGravityAt(FVector::ZeroVector);
+	TestEqual(TEXT("Changed scale should rebuild once"), Subsystem->GetNumCacheRebuilds(), Rebuilds + 2);
+	TestEqual(TEXT("Doubled scale should double the strength"), Scaled.BestStrength, Moved.BestStrength * 2.f, Moved.BestStrength * 1e-4f);
+	Subsystem->QueryGravityAt(FVector::ZeroVector);
+	TestEqual(TEXT("Matching parameters should not rebuild again"), Subsystem->GetNumCacheRebuilds(), Rebuilds + 2);
+
+	Source->bAffectsGravity = false;
+	TestTrue(TEXT("Disabled source should drop out on the next query"), Subsystem->QueryGravityAt(FVector::ZeroVector, nullptr).WeightedGravity.Z <= 0.f);
+
+	// Explicit marking still forces a rebuild (e.g. after a mesh swap).
+	const int32 RebuildsBeforeMark = Subsystem->GetNumCacheRebuilds();
+	Subsystem->MarkSourcesDirty();
+	Subsystem->RefreshSourceCache();
+	TestEqual(TEXT("Marking should rebuild once"), Subsystem->GetNumCacheRebuilds(), RebuildsBeforeMark + 1);
+
+	Planet->Destroy();
+	TestTrue(TEXT("Unregistering should flag the cache"), Subsystem->IsSourceCacheDirty());
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FGravitySourceSubsystemInfluenceCullingMatchesFullScan,
+	"FederationGame.Planet.GravitySourceSubsystem.InfluenceCullingMatchesFullScan",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter
+)
+
+bool FGravitySourceSubsystemInfluenceCullingMatchesFullScan::RunTest(const FString& Parameters)
+{
+	UWorld* World = GEngine->GetWorldContexts()[0].World();
+	if (!World) { AddError(TEXT("No world context")); return false; }
+	UGravitySourceSubsystem* Subsystem = World->GetSubsystem<UGravitySourceSubsystem>();
+	if (!Subsystem) { AddError(TEXT("No subsystem")); return false; }
+
+	TArray<AActor*> Planets;
+	GravitySourceSubsystemTest::SpawnGalaxy(World, 200, 4242, Planets);
+	TArray<FVector> Points;
+	GravitySourceSubsystemTest::MakeGalaxyQueries(Planets, 400, 99, Points);
+	Subsystem->RefreshSourceCache(true);
+
+	TestTrue(TEXT("Bounded sources should be bucketed in the grid"), Subsystem->GetInfluenceGrid().NumCells() > 0);
+
+	int32 Mismatches = 0;
+	for (const FVector& Point : Points)
+	{
+		Subsystem->SetInfluenceCullingEnabled(false);
+		const FGravityQueryResult Full = Subsystem->QueryGravityAt(Point);
+		Subsystem->SetInfluenceCullingEnabled(true);
+		const FGravityQueryResult Culled = Subsystem->QueryGravityAt(Point);
+
+		if (!Culled.WeightedGravity.Equals(Full.WeightedGravity, 1e-5f) || !FMath::IsNearlyEqual(Culled.BestStrength, Full.BestStrength, 1e-6f)
+			|| Culled.NumSources != Full.NumSources)
+		{
+			++Mismatches;
+		}
+	}
+	TestEqual(TEXT("Culled queries should match the full scan"), Mismatches, 0);
+
+	// Far outside the scattered volume: nothing visited, zero gravity, registry still non-empty (no legacy fallback).
+	// Unbounded sources left in the editor level are always visited, so only the grid part is checked then.
+	const FGravityQueryResult Deep = Subsystem->QueryGravityAt(FVector(5.0e9, 5.0e9, 5.0e9));
+	const int32 NumUnbounded = Subsystem->GetInfluenceGrid().NumUnboundedSources();
+	TestEqual(TEXT("Deep-space query should visit only unbounded sources"), Deep.NumVisitedSources, NumUnbounded);
+	if (NumUnbounded == 0)
+	{
+		TestTrue(TEXT("Deep-space query should have zero gravity"), Deep.WeightedGravity.IsZero());
+		TestFalse(TEXT("Deep-space query should skip the nearest-source search"), Deep.bHasNearestSource);
+	}
+	TestTrue(TEXT("Deep-space query should still report registered sources"), Deep.NumSources >= Planets.Num());
+
+	for (AActor* Planet : Planets)
+	{
+		Planet->Destroy();
+	}
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FGravitySourceSubsystemInfluenceCullingBenchmark,
+	"FederationGame.Planet.GravitySourceSubsystem.InfluenceCullingBenchmark",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::PerfFilter
+)
+
+bool FGravitySourceSubsystemInfluenceCullingBenchmark::RunTest(const FString& Parameters)
+{
+	UWorld* World = GEngine->GetWorldContexts()[0].World();
+	if (!World) { AddError(TEXT("No world context")); return false; }
+	UGravitySourceSubsystem* Subsystem = World->GetSubsystem<UGravitySourceSubsystem>();
+	if (!Subsystem) { AddError(TEXT("No subsystem")); return false; }
+
+	TArray<AActor*> Planets;
+	GravitySourceSubsystemTest::SpawnGalaxy(World, 1000, 1000, Planets);
+	TArray<FVector> Points;
+	GravitySourceSubsystemTest::MakeGalaxyQueries(Planets, 20000, 7, Points);
+
+	double BuildStart = FPlatformTime::Seconds();
+	Subsystem->RefreshSourceCache(true);
+	const double RefreshMs = (FPlatformTime::Seconds() - BuildStart) * 1000.0;
+
+	auto TimeQueries = [&](bool bCulling, int64& OutVisited)
+	{
+		Subsystem->SetInfluenceCullingEnabled(bCulling);
+		OutVisited = 0;
+		FVector Sink = FVector::ZeroVector;
+		const double Start = FPlatformTime::Seconds();
+		for (const FVector& Point : Points)
+		{
+			const FGravityQueryResult Result = Subsystem->QueryGravityAtCached(Point);
+			Sink += Result.WeightedGravity;
+			OutVisited += Result.NumVisitedSources;
+		}
+		const double Us = (FPlatformTime::Seconds() - Start) * 1.0e6 / Points.Num();
+		if (Sink.ContainsNaN()) AddError(TEXT("NaN gravity"));
+		return Us;
+	};
+
+	int64 FullVisited = 0;
+	int64 CulledVisited = 0;
+	const double FullUs = TimeQueries(false, FullVisited);
+	const double CulledUs = TimeQueries(true, CulledVisited);
+	Subsystem->SetInfluenceCullingEnabled(true);
+
+	const FGravityInfluenceGrid& Grid = Subsystem->GetInfluenceGrid();
+	AddInfo(FString::Printf(TEXT("%d sources: refresh %.2f ms (%d cells, cell %.0f UU)"), Planets.Num(), RefreshMs, Grid.NumCells(), Grid.GetCellSize()));
+	AddInfo(FString::Printf(TEXT("Full scan: %.3f us/query (%.1f sources visited)"), FullUs, double(FullVisited) / Points.Num()));
+	AddInfo(FString::Printf(TEXT("Culled:    %.3f us/query (%.2f sources visited)"), CulledUs, double(CulledVisited) / Points.Num()));
+	TestTrue(TEXT("Culling should visit far fewer sources"), CulledVisited * 10 < FullVisited);
+
+	for (AActor* Planet : Planets)
+	{
+		Planet->Destroy();
+	}
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FGravitySourceSubsystemLegacyPlanetsResolvedOnce,
+	"FederationGame.Planet.GravitySourceSubsystem.LegacyPlanetsResolvedOnce",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter
+)
+
+bool FGravitySourceSubsystemLegacyPlanetsResolvedOnce::RunTest(const FString& Parameters)
+{
+	UWorld* World = GEngine->GetWorldContexts()[0].World();
+	if (!World) { AddError(TEXT("No world context")); return false; }
+	UGravitySourceSubsystem* Subsystem = World->GetSubsystem<UGravitySourceSubsystem>();
+	if (!Subsystem) { AddError(TEXT("No subsystem")); return false; }
+
+	// Tagged legacy planet with no gravity source component.
+	AStaticMeshActor* Planet = World->SpawnActor<AStaticMeshActor>(FVector(0.f, 0.f, -5000.f), FRotator::ZeroRotator);
+	if (!Planet) { AddError(TEXT("Failed to spawn planet")); return false; }
+	Planet->Tags.Add(FName(TEXT("Planet")));
+	Subsystem->MarkLegacyPlanetsDirty();
+
+	const int32 ResolvesBefore = Subsystem->GetLegacyResolveCount();
+	for (int32 i = 0; i < 100; ++i)
+	{
+		const FGravityQueryResult Result = Subsystem->QueryLegacyGravityAt(FVector(0.f, 0.f, float(i)));
+		if (Result.NumSources == 0)
+		{
+			AddError(TEXT("Tagged planet should be found by the legacy fallback"));
+			break;
+		}
+	}
+	TestEqual(TEXT("Repeated legacy queries should scan the world once"), Subsystem->GetLegacyResolveCount(), ResolvesBefore + 1);
+	TestTrue(TEXT("Resolved list should contain the tagged planet"),
+		Subsystem->GetLegacyPlanets().Contains(TWeakObjectPtr<AActor>(Planet)));
+
+	// Irrelevant spawns don't invalidate; destroying a resolved planet does.
+	AActor* Unrelated = World->SpawnActor<AActor>(FVector::ZeroVector, FRotator::ZeroRotator);
+	TestFalse(TEXT("Spawning an unrelated actor should keep the cached list"), Subsystem->IsLegacyPlanetListDirty());
+	if (Unrelated) Unrelated->Destroy();
+
+	Planet->Destroy();
+	TestTrue(TEXT("Destroying a resolved planet should invalidate the list"), Subsystem->IsLegacyPlanetListDirty());
+	TestFalse(TEXT("Destroyed planet should drop out after re-resolve"),
+		Subsystem->GetLegacyPlanets().Contains(TWeakObjectPtr<AActor>(Planet)));
+
+	AStaticMeshActor* Spawned = World->SpawnActor<AStaticMeshActor>(FVector::ZeroVector, FRotator::ZeroRotator);
+	TestTrue(TEXT("Spawning a static mesh actor should invalidate the list"), Subsystem->IsLegacyPlanetListDirty());
+	if (Spawned) Spawned->Destroy();
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
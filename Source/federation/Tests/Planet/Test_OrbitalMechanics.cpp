@@ -0,0 +1,311 @@
+// Copyright Federation Game. All Rights Reserved.
+
+#include "Misc/AutomationTest.h"
+#include "Planet/OrbitalSystem.h"
+#include "Planet/OrbitalBodyComponent.h"
+#include "Planet/OrbitalMechanicsSubsystem.h"
+#include "Planet/GravitySourceSubsystem.h"
+#include "Planet/PlanetGravitySourceComponent.h"
+#include "Engine/World.h"
+#include "Engine/StaticMeshActor.h"
+#include "HAL/PlatformTime.h"
+#include "Math/RandomStream.h"
+#include "Tests/AutomationCommon.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace OrbitalMechanicsTest
+{
+	/** 1 km planet with default surface gravity: Mu = 980 * R^2. */
+	constexpr double PlanetRadius = 100000.0;
+	constexpr double PlanetMu = 980.0 * PlanetRadius * PlanetRadius;
+	constexpr double FixedStep = 1.0 / 60.0;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FOrbitalMechanicsCircularOrbitEnergyDrift,
+	"FederationGame.Planet.OrbitalMechanics.CircularOrbitEnergyDrift",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter
+)
+
+bool FOrbitalMechanicsCircularOrbitEnergyDrift::RunTest(const FString& Parameters)
+{
+	using namespace OrbitalMechanicsTest;
+
+	FOrbitalSystem System;
+	const int32 Sun = System.AddStaticBody(FVector::ZeroVector, PlanetMu);
+	const double OrbitRadius = 2.0 * PlanetRadius;
+	const double Speed = FMath::Sqrt(PlanetMu / OrbitRadius);
+	const int32 Probe = System.AddNBodyBody(FVector(OrbitRadius, 0.0, 0.0), FVector(0.0, Speed, 0.0), 0.0);
+
+	const double Period = UE_DOUBLE_TWO_PI * OrbitRadius / Speed;
+	const int32 Steps = FMath::CeilToInt32(5.0 * Period / FixedStep);
+
+	const double E0 = System.ComputeSpecificEnergy(Probe, Sun);
+	double MaxDrift = 0.0;
+	for (int32 i = 0; i < Steps; ++i)
+	{
+		System.Step(FixedStep);
+		MaxDrift = FMath::Max(MaxDrift, FMath::Abs((System.ComputeSpecificEnergy(Probe, Sun) - E0) / E0));
+	}
+
+	const double RadiusError = FMath::Abs(System.GetPosition(Probe).Size() - OrbitRadius) / OrbitRadius;
+	TestTrue(FString::Printf(TEXT("Energy drift over 5 orbits should stay below 1e-8 (got %g)"), MaxDrift), MaxDrift < 1e-8);
+	TestTrue(FString::Printf(TEXT("Circular orbit radius should hold (rel error %g)"), RadiusError), RadiusError < 1e-6);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FOrbitalMechanicsMutualEccentricEnergyBounded,
+	"FederationGame.Planet.OrbitalMechanics.MutualEccentricEnergyBounded",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter
+)
+
+bool FOrbitalMechanicsMutualEccentricEnergyBounded::RunTest(const FString& Parameters)
+{
+	using namespace OrbitalMechanicsTest;
+
+	// Planet + heavy moon on an e = 0.5 mutual orbit (both integrated), started at apoapsis.
+	FOrbitalSystem System;
+	const double MoonMu = PlanetMu * 0.1;
+	const double TotalMu = PlanetMu + MoonMu;
+	const double A = 4.0 * PlanetRadius;
+	const double Ecc = 0.5;
+	const double Apo = A * (1.0 + Ecc);
+	const double ApoSpeed = FMath::Sqrt(TotalMu * (1.0 - Ecc) / Apo);
+
+	// Centre-of-mass frame so the pair doesn't drift.
+	const double PlanetShare = MoonMu / TotalMu;
+	const double MoonShare = PlanetMu / TotalMu;
+	System.AddNBodyBody(FVector(-Apo * PlanetShare, 0.0, 0.0), FVector(0.0, -ApoSpeed * PlanetShare, 0.0), PlanetMu);
+	System.AddNBodyBody(FVector(Apo * MoonShare, 0.0, 0.0), FVector(0.0, ApoSpeed * MoonShare, 0.0), MoonMu);
+
+	const double Period = UE_DOUBLE_TWO_PI * FMath::Sqrt(A * A * A / TotalMu);
+	const int32 StepsPerOrbit = FMath::CeilToInt32(Period / FixedStep);
+
+	const double E0 = System.ComputeTotalEnergy();
+	double MaxDriftFirstOrbit = 0.0;
+	double MaxDriftOverall = 0.0;
+	for (int32 i = 0; i < StepsPerOrbit * 20; ++i)
+	{
+		System.Step(FixedStep);
+		const double Drift = FMath::Abs((System.ComputeTotalEnergy() - E0) / E0);
+		MaxDriftOverall = FMath::Max(MaxDriftOverall, Drift);
+		if (i < StepsPerOrbit)
+		{
+			MaxDriftFirstOrbit = Drift > MaxDriftFirstOrbit ? Drift : MaxDriftFirstOrbit;
+		}
+	}
+
+	AddInfo(FString::Printf(TEXT("Energy drift: first orbit %g, 20 orbits %g"), MaxDriftFirstOrbit, MaxDriftOverall));
+	TestTrue(TEXT("Energy error should stay small"), MaxDriftOverall < 1e-5);
+	// Symplectic: the error oscillates instead of growing secularly.
+	TestTrue(TEXT("Energy error after 20 orbits should not grow beyond ~2x the first orbit"), MaxDriftOverall < MaxDriftFirstOrbit * 2.0 + 1e-12);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FOrbitalMechanicsKeplerIsPeriodic,
+	"FederationGame.Planet.OrbitalMechanics.KeplerIsPeriodic",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter
+)
+
+bool FOrbitalMechanicsKeplerIsPeriodic::RunTest(const FString& Parameters)
+{
+	using namespace OrbitalMechanicsTest;
+
+	FKeplerElements Elements;
+	Elements.SemiMajorAxis = 5.0 * PlanetRadius;
+	Elements.Eccentricity = 0.3;
+	Elements.Inclination = FMath::DegreesToRadians(20.0);
+	Elements.LongitudeOfAscendingNode = FMath::DegreesToRadians(45.0);
+	Elements.ArgumentOfPeriapsis = FMath::DegreesToRadians(10.0);
+
+	FOrbitalSystem System;
+	const int32 Sun = System.AddStaticBody(FVector(1.0e7, 0.0, 0.0), PlanetMu);
+	const int32 Moon = System.AddKeplerBody(Sun, Elements, 0.0);
+	const double Period = System.GetKeplerPeriod(Moon);
+
+	FVector P0, V0, P1, V1;
+	FOrbitalSystem::EvaluateKepler(Elements, PlanetMu, 0.0, P0, V0);
+	FOrbitalSystem::EvaluateKepler(Elements, PlanetMu, Period, P1, V1);
+	TestTrue(TEXT("Kepler position should repeat after one period"), P0.Equals(P1, Elements.SemiMajorAxis * 1e-9));
+
+	// Vis-viva: v^2 = Mu (2/r - 1/a) along the whole orbit.
+	for (int32 i = 1; i <= 200; ++i)
+	{
+		System.Step(Period / 200.0);
+		const FVector Rel = System.GetPosition(Moon) - System.GetPosition(Sun);
+		const double Expected = PlanetMu * (2.0 / Rel.Size() - 1.0 / Elements.SemiMajorAxis);
+		const double Actual = System.GetVelocity(Moon).SizeSquared();
+		if (FMath::Abs(Actual - Expected) > Expected * 1e-9)
+		{
+			AddError(FString::Printf(TEXT("Vis-viva violated at step %d: %g vs %g"), i, Actual, Expected));
+			break;
+		}
+	}
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FOrbitalMechanicsDeterministic,
+	"FederationGame.Planet.OrbitalMechanics.Deterministic",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter
+)
+
+bool FOrbitalMechanicsDeterministic::RunTest(const FString& Parameters)
+{
+	using namespace OrbitalMechanicsTest;
+
+	// Enough N-body bodies to take the parallel acceleration path.
+	auto Build = [](FOrbitalSystem& System)
+	{
+		FRandomStream Rng(77);
+		System.AddStaticBody(FVector::ZeroVector, PlanetMu);
+		for (int32 i = 0; i < 200; ++i)
+		{
+			const FVector Pos = Rng.GetUnitVector() * Rng.FRandRange(2.0f, 10.0f) * PlanetRadius;
+			const FVector Vel = Rng.GetUnitVector() * Rng.FRandRange(1000.f, 5000.f);
+			System.AddNBodyBody(Pos, Vel, (i % 10 == 0) ? PlanetMu * 0.001 : 0.0);
+		}
+	};
+
+	FOrbitalSystem A, B;
+	Build(A);
+	Build(B);
+	for (int32 i = 0; i < 600; ++i)
+	{
+		A.Step(FixedStep);
+		B.Step(FixedStep);
+	}
+
+	bool bIdentical = true;
+	for (int32 i = 0; i < A.Num(); ++i)
+	{
+		bIdentical &= A.GetPosition(i) == B.GetPosition(i) && A.GetVelocity(i) == B.GetVelocity(i);
+	}
+	TestTrue(TEXT("Identical inputs and step counts should give bit-identical state"), bIdentical);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FOrbitalMechanicsSubsystemDrivesGravitySources,
+	"FederationGame.Planet.OrbitalMechanics.SubsystemDrivesGravitySources",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter
+)
+
+bool FOrbitalMechanicsSubsystemDrivesGravitySources::RunTest(const FString& Parameters)
+{
+	using namespace OrbitalMechanicsTest;
+
+	UWorld* World = GEngine->GetWorldContexts()[0].World();
+	if (!World) { AddError(TEXT("No world context")); return false; }
+	UOrbitalMechanicsSubsystem* Orbits = World->GetSubsystem<UOrbitalMechanicsSubsystem>();
+	UGravitySourceSubsystem* Gravity = World->GetSubsystem<UGravitySourceSubsystem>();
+	if (!Orbits || !Gravity) { AddError(TEXT("Missing subsystems")); return false; }
+
+	AStaticMeshActor* Sun = World->SpawnActor<AStaticMeshActor>(FVector(0.f, 0.f, 0.f), FRotator::ZeroRotator);
+	AStaticMeshActor* Planet = World->SpawnActor<AStaticMeshActor>(FVector(0.f, 0.f, 0.f), FRotator::ZeroRotator);
+	if (!Sun || !Planet) { AddError(TEXT("Failed to spawn")); return false; }
+	Planet->GetRootComponent()->SetMobility(EComponentMobility::Movable);
+
+	UOrbitalBodyComponent* SunBody = NewObject<UOrbitalBodyComponent>(Sun, TEXT("OrbitalBody"));
+	SunBody->MuOverride = PlanetMu * 100.0;
+	SunBody->RegisterComponent();
+
+	UPlanetGravitySourceComponent* Source = NewObject<UPlanetGravitySourceComponent>(Planet, TEXT("GravitySource"));
+	Source->RegisterComponent();
+	Source->ManualRadius = PlanetRadius;
+	UOrbitalBodyComponent* PlanetBody = NewObject<UOrbitalBodyComponent>(Planet, TEXT("OrbitalBody"));
+	PlanetBody->OrbitMode = EOrbitMode::Kepler;
+	PlanetBody->OrbitParent = Sun;
+	PlanetBody->SemiMajorAxis = 50.0 * PlanetRadius;
+	PlanetBody->RegisterComponent();
+
+	TestTrue(TEXT("Planet mass should derive from its gravity source"), FMath::IsNearlyEqual(PlanetBody->ComputeMu(), PlanetMu, PlanetMu * 1e-6));
+
+	Orbits->StepFixed(600);
+
+	FVector Propagated;
+	TestTrue(TEXT("Planet should have a propagated position"), Orbits->GetBodyPosition(Planet, Propagated));
+	TestTrue(TEXT("Planet should be on its orbit"), FMath::IsNearlyEqual(Propagated.Size(), 50.0 * PlanetRadius, 1.0));
+	TestTrue(TEXT("Actor transform should follow the propagated state"), Planet->GetActorLocation().Equals(Propagated, 1.0));
+
+	Gravity->RefreshSourceCache(true);
+	bool bFound = false;
+	for (const FGravitySourceEntry& Entry : Gravity->GetCachedSources())
+	{
+		if (Entry.Owner.Get() == Planet)
+		{
+			bFound = true;
+			TestTrue(TEXT("Gravity registry should read the propagated position"), Entry.Center.Equals(Propagated, 1e-3));
+		}
+	}
+	TestTrue(TEXT("Planet gravity source should be cached"), bFound);
+
+	// Budget: a long hitch is capped at MaxStepsPerFrame.
+	const int32 SavedMax = Orbits->MaxStepsPerFrame;
+	const double SavedBudget = Orbits->FrameBudgetMs;
+	Orbits->MaxStepsPerFrame = 4;
+	Orbits->FrameBudgetMs = 1000.0;
+	TestEqual(TEXT("Step count should be capped per frame"), Orbits->AdvanceTime(1.0), 4);
+	TestTrue(TEXT("Backlog should be bounded"), Orbits->GetPendingTime() <= Orbits->FixedTimeStep * 4 + KINDA_SMALL_NUMBER);
+	Orbits->MaxStepsPerFrame = SavedMax;
+	Orbits->FrameBudgetMs = SavedBudget;
+
+	Planet->Destroy();
+	Sun->Destroy();
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FOrbitalMechanicsBenchmark,
+	"FederationGame.Planet.OrbitalMechanics.Benchmark",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::PerfFilter
+)
+
+bool FOrbitalMechanicsBenchmark::RunTest(const FString& Parameters)
+{
+	using namespace OrbitalMechanicsTest;
+
+	// Star system: sun, 8 planets, 5000 Kepler asteroids, 1000 N-body debris particles.
+	FOrbitalSystem System;
+	FRandomStream Rng(9);
+	const int32 Sun = System.AddStaticBody(FVector::ZeroVector, PlanetMu * 1000.0);
+	for (int32 i = 0; i < 8; ++i)
+	{
+		FKeplerElements E;
+		E.SemiMajorAxis = (20.0 + 15.0 * i) * PlanetRadius;
+		E.MeanAnomalyAtEpoch = Rng.FRandRange(0.f, UE_TWO_PI);
+		System.AddKeplerBody(Sun, E, PlanetMu);
+	}
+	for (int32 i = 0; i < 5000; ++i)
+	{
+		FKeplerElements E;
+		E.SemiMajorAxis = Rng.FRandRange(60.f, 90.f) * PlanetRadius;
+		E.Eccentricity = Rng.FRandRange(0.f, 0.2f);
+		E.Inclination = Rng.FRandRange(-0.1f, 0.1f);
+		E.MeanAnomalyAtEpoch = Rng.FRandRange(0.f, UE_TWO_PI);
+		System.AddKeplerBody(Sun, E, 0.0);
+	}
+	for (int32 i = 0; i < 1000; ++i)
+	{
+		const double R = Rng.FRandRange(30.f, 120.f) * PlanetRadius;
+		const double Angle = Rng.FRandRange(0.f, UE_TWO_PI);
+		const FVector Pos(R * FMath::Cos(Angle), R * FMath::Sin(Angle), 0.0);
+		const FVector Vel = FVector(-FMath::Sin(Angle), FMath::Cos(Angle), 0.0) * FMath::Sqrt(PlanetMu * 1000.0 / R);
+		System.AddNBodyBody(Pos, Vel, 0.0);
+	}
+
+	constexpr int32 NumSteps = 240;
+	const double Start = FPlatformTime::Seconds();
+	for (int32 i = 0; i < NumSteps; ++i)
+	{
+		System.Step(FixedStep);
+	}
+	const double MsPerStep = (FPlatformTime::Seconds() - Start) * 1000.0 / NumSteps;
+	AddInfo(FString::Printf(TEXT("%d bodies: %.3f ms/step (%.1f ns/body/step)"), System.Num(), MsPerStep, MsPerStep * 1.0e6 / System.Num()));
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,200 @@
+// Copyright Federation Game. All Rights Reserved.
+
+#include "Misc/AutomationTest.h"
+#include "Planet/PlanetActorCarrier.h"
+#include "Planet/PlanetSurfaceMapping.h"
+#include "Components/SceneComponent.h"
+#include "Components/SphereComponent.h"
+#include "Engine/CollisionProfile.h"
+#include "Engine/World.h"
+#include "GameFramework/Pawn.h"
+#include "GameFramework/ProjectileMovementComponent.h"
+#include "Tests/AutomationCommon.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+/** Actor with a small collision sphere root at Location (Gather finds actors by overlap); Owner and Mobility as given. */
+static AActor* SpawnCarryTestActor(UWorld* World, const FVector& Location, AActor* Owner = nullptr,
+	EComponentMobility::Type Mobility = EComponentMobility::Movable)
+{
+	FActorSpawnParameters Params;
+	Params.Owner = Owner;
+	AActor* Actor = World->SpawnActor<AActor>(AActor::StaticClass(), FTransform(Location), Params);
+	if (!Actor) return nullptr;
+
+	USphereComponent* Root = NewObject<USphereComponent>(Actor, TEXT("Root"));
+	Root->InitSphereRadius(50.f);
+	Root->SetCollisionProfileName(UCollisionProfile::PhysicsActor_ProfileName);
+	Root->SetMobility(Mobility);
+	Root->SetRelativeLocation(Location);
+	Actor->SetRootComponent(Root);
+	Root->RegisterComponent();
+	return Actor;
+}
+
+// ---------------------------------------------------------------------------
+// 1. Gather: only free, movable, nearby actors; the player, planet-owned and tagged actors stay
+// ---------------------------------------------------------------------------
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FPlanetActorCarrierGatherFilters,
+	"FederationGame.Planet.PlanetActorCarrier.GatherFilters",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter
+)
+
+bool FPlanetActorCarrierGatherFilters::RunTest(const FString& Parameters)
+{
+	UWorld* World = GEngine->GetWorldContexts()[0].World();
+	if (!World) { AddError(TEXT("No world context")); return false; }
+
+	// Far from anything else in the test world.
+	const FVector Center(0.f, 0.f, 5.0e7f);
+	AActor* Planet = SpawnCarryTestActor(World, Center - FVector(0.f, 0.f, 100000.f));
+	AActor* Companion = SpawnCarryTestActor(World, Center + FVector(1000.f, 0.f, 0.f));
+	AActor* Far = SpawnCarryTestActor(World, Center + FVector(20000.f, 0.f, 0.f));
+	AActor* Tagged = SpawnCarryTestActor(World, Center + FVector(0.f, 1000.f, 0.f));
+	AActor* PlanetOwned = SpawnCarryTestActor(World, Center + FVector(0.f, -1000.f, 0.f), Planet);
+	AActor* Static = SpawnCarryTestActor(World, Center + FVector(-1000.f, 0.f, 0.f), nullptr, EComponentMobility::Static);
+	AActor* Attached = SpawnCarryTestActor(World, Center + FVector(1000.f, 100.f, 0.f));
+	APawn* Player = World->SpawnActor<APawn>(Center, FRotator::ZeroRotator);
+	TArray<AActor*> Spawned = { Planet, Companion, Far, Tagged, PlanetOwned, Static, Attached, Player };
+	if (Spawned.Contains(nullptr)) { AddError(TEXT("Failed to spawn")); return false; }
+
+	Tagged->Tags.Add(FPlanetActorCarrier::NoCarryTag);
+	Attached->AttachToActor(Companion, FAttachmentTransformRules::KeepWorldTransform);
+
+	// Without collision an actor can't be found by the overlap query.
+	AActor* NoCollision = SpawnCarryTestActor(World, Center + FVector(0.f, 0.f, 1000.f));
+	if (!NoCollision) { AddError(TEXT("Failed to spawn")); return false; }
+	Spawned.Add(NoCollision);
+	Cast<UPrimitiveComponent>(NoCollision->GetRootComponent())->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+
+	FPlanetActorCarrier Carrier;
+	TestEqual(TEXT("Only the companion is gathered"), Carrier.Gather(World, Center, 5000.0, Planet, Player), 1);
+	TestEqual(TEXT("Zero radius gathers nothing"), Carrier.Gather(World, Center, 0.0, Planet, Player), 0);
+
+	for (AActor* Actor : Spawned) Actor->Destroy();
+	return true;
+}
+
+// ---------------------------------------------------------------------------
+// 2. Move to surface and back: relative placement kept, velocity turned with local up
+// ---------------------------------------------------------------------------
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FPlanetActorCarrierRoundTrip,
+	"FederationGame.Planet.PlanetActorCarrier.RoundTrip",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter
+)
+
+bool FPlanetActorCarrierRoundTrip::RunTest(const FString& Parameters)
+{
+	UWorld* World = GEngine->GetWorldContexts()[0].World();
+	if (!World) { AddError(TEXT("No world context")); return false; }
+
+	// Planet 1e8 UU out, surface frame anchored at the top.
+	const double R = 100000.0;
+	const FVector PlanetCenter(1.0e8, 0.0, 0.0);
+	const FPlanetSurfaceMapping Mapping(PlanetCenter, R, PlanetCenter + FVector(0.0, 0.0, R),
+		FVector::UpVector, FVector(0.0, -1.0, 0.0), FVector::ForwardVector, 300.0);
+
+	// Player hovering over the anchor, a companion 3 km to the side falling toward the planet.
+	const FVector PlayerSpace = PlanetCenter + FVector(0.0, 0.0, R + 5000.0);
+	const FVector CompanionSpace = PlayerSpace + FVector(3000.0, 0.0, 0.0);
+	const FVector SpaceUp = (CompanionSpace - PlanetCenter).GetSafeNormal();
+	AActor* Companion = SpawnCarryTestActor(World, CompanionSpace);
+	if (!Companion) { AddError(TEXT("Failed to spawn")); return false; }
+	Companion->SetActorRotation(FQuat::FindBetweenNormals(FVector::UpVector, SpaceUp));
+
+	UProjectileMovementComponent* Movement = NewObject<UProjectileMovementComponent>(Companion);
+	Movement->RegisterComponent();
+	Movement->SetUpdatedComponent(Companion->GetRootComponent());
+	Movement->Velocity = -SpaceUp * 100.0;
+	Movement->UpdateComponentVelocity();
+
+	FPlanetActorCarrier Carrier;
+	Carrier.Add(Companion);
+	TestEqual(TEXT("One actor moved to the surface"), Carrier.MoveToSurface(Mapping), 1);
+
+	const FVector PlayerSurface = Mapping.SpaceToSurface(PlayerSpace);
+	const FVector CompanionSurface = Companion->GetActorLocation();
+	TestTrue(TEXT("Companion lands where the mapping puts it"), CompanionSurface.Equals(Mapping.SpaceToSurface(CompanionSpace), 0.01));
+	// Arc length on the sphere: 3 km at 5 km altitude is R / (R + 5000) of that on the tile.
+	TestTrue(TEXT("Companion keeps its offset from the player"), FMath::IsNearlyEqual(FVector::Dist(CompanionSurface, PlayerSurface), 3000.0 * R / (R + 5000.0), 50.0));
+	TestTrue(TEXT("Falling toward the planet becomes falling toward the tile"), Movement->Velocity.Equals(FVector(0.0, 0.0, -100.0), 0.01));
+	TestTrue(TEXT("Actor up follows the surface normal"), Companion->GetActorUpVector().Equals(FVector::UpVector, 1e-4));
+
+	TestEqual(TEXT("Same actor moved back to space"), Carrier.MoveToSpace(Mapping), 1);
+	TestTrue(TEXT("Companion returns to its space position"), Companion->GetActorLocation().Equals(CompanionSpace, 0.01));
+	TestTrue(TEXT("Velocity turns back with local up"), Movement->Velocity.Equals(-SpaceUp * 100.0, 0.01));
+
+	// Destroyed actors drop out.
+	Companion->Destroy();
+	TestEqual(TEXT("Nothing left to move"), Carrier.MoveToSurface(Mapping), 0);
+	return true;
+}
+
+// ---------------------------------------------------------------------------
+// 3. Physics bodies: a group moves together and angular velocity turns with linear velocity
+// ---------------------------------------------------------------------------
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FPlanetActorCarrierPhysicsBodies,
+	"FederationGame.Planet.PlanetActorCarrier.PhysicsBodies",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter
+)
+
+bool FPlanetActorCarrierPhysicsBodies::RunTest(const FString& Parameters)
+{
+	UWorld* World = GEngine->GetWorldContexts()[0].World();
+	if (!World) { AddError(TEXT("No world context")); return false; }
+
+	const double R = 100000.0;
+	const FVector PlanetCenter(-1.0e8, 0.0, 0.0);
+	const FPlanetSurfaceMapping Mapping(PlanetCenter, R, PlanetCenter + FVector(0.0, 0.0, R),
+		FVector::UpVector, FVector(0.0, -1.0, 0.0), FVector::ForwardVector, 300.0);
+	const FVector PlayerSpace = PlanetCenter + FVector(0.0, 0.0, R + 5000.0);
+
+	// A tight cluster of tumbling debris off to one side, where local up is tilted from the frame normal.
+	constexpr int32 NumBodies = 8;
+	TArray<AActor*> Bodies;
+	TArray<FVector> SpacePositions;
+	for (int32 i = 0; i < NumBodies; ++i)
+	{
+		const FVector SpacePos = PlayerSpace + FVector(3000.0 + 150.0 * i, 400.0 * (i % 3), 0.0);
+		AActor* Body = SpawnCarryTestActor(World, SpacePos);
+		if (!Body) { AddError(TEXT("Failed to spawn")); return false; }
+		Bodies.Add(Body);
+		SpacePositions.Add(SpacePos);
+	}
+
+	FPlanetActorCarrier Carrier;
+	TestEqual(TEXT("The cluster is gathered by overlap"), Carrier.Gather(World, PlayerSpace + FVector(3500.0, 0.0, 0.0), 2500.0, nullptr, nullptr), NumBodies);
+
+	UPrimitiveComponent* Tumbler = Cast<UPrimitiveComponent>(Bodies[0]->GetRootComponent());
+	Tumbler->SetSimulatePhysics(true);
+	Tumbler->SetEnableGravity(false);
+	if (!Tumbler->IsSimulatingPhysics()) { AddError(TEXT("No physics body")); for (AActor* Body : Bodies) Body->Destroy(); return false; }
+	const FVector SpaceUp = (SpacePositions[0] - PlanetCenter).GetSafeNormal();
+	const FVector Spin = FVector::CrossProduct(SpaceUp, FVector::RightVector).GetSafeNormal() * 2.0;
+	Tumbler->SetPhysicsLinearVelocity(-SpaceUp * 100.0);
+	Tumbler->SetPhysicsAngularVelocityInRadians(Spin);
+
+	TestEqual(TEXT("Whole cluster moved"), Carrier.MoveToSurface(Mapping), NumBodies);
+	for (int32 i = 0; i < NumBodies; ++i)
+	{
+		TestTrue(FString::Printf(TEXT("Body %d lands where the mapping puts it"), i),
+			Bodies[i]->GetActorLocation().Equals(Mapping.SpaceToSurface(SpacePositions[i]), 0.01));
+	}
+	const FQuat Turn = FQuat::FindBetweenNormals(SpaceUp, FVector::UpVector);
+	TestTrue(TEXT("Linear velocity turned"), Tumbler->GetPhysicsLinearVelocity().Equals(FVector(0.0, 0.0, -100.0), 0.01));
+	TestTrue(TEXT("Angular velocity turned with it"), Tumbler->GetPhysicsAngularVelocityInRadians().Equals(Turn.RotateVector(Spin), 1e-3));
+
+	Carrier.MoveToSpace(Mapping);
+	TestTrue(TEXT("Angular velocity turns back"), Tumbler->GetPhysicsAngularVelocityInRadians().Equals(Spin, 1e-3));
+
+	for (AActor* Body : Bodies) Body->Destroy();
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
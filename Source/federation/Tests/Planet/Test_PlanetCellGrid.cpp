@@ -0,0 +1,152 @@
+// Copyright Federation Game. All Rights Reserved.
+
+#include "Misc/AutomationTest.h"
+#include "Planet/PlanetCellGrid.h"
+#include "Math/RandomStream.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+// ---------------------------------------------------------------------------
+// Every cell's center maps back to that cell, and every cell is distinct
+// ---------------------------------------------------------------------------
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FPlanetCellGridCenterRoundTrip,
+	"FederationGame.Planet.PlanetCellGrid.CenterRoundTrip",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter
+)
+
+bool FPlanetCellGridCenterRoundTrip::RunTest(const FString& Parameters)
+{
+	const FPlanetCellGrid Grid(4);
+	TestEqual(TEXT("6 * N * N cells"), Grid.GetNumCells(), 96);
+
+	TSet<FPlanetCellId> Seen;
+	for (int32 Face = 0; Face < 6; ++Face)
+	{
+		for (int32 Y = 0; Y < Grid.GetCellsPerFaceEdge(); ++Y)
+		{
+			for (int32 X = 0; X < Grid.GetCellsPerFaceEdge(); ++X)
+			{
+				const FPlanetCellId Cell(Face, X, Y);
+				const FVector Center = Grid.GetCellCenterDirection(Cell);
+				TestTrue(TEXT("Center is a unit direction"), FMath::IsNearlyEqual(Center.Size(), 1.0, 1e-6));
+				TestTrue(FString::Printf(TEXT("Cell %d/%d/%d round-trips"), Face, X, Y), Grid.CellFromDirection(Center) == Cell);
+				Seen.Add(Cell);
+			}
+		}
+	}
+	TestEqual(TEXT("All cells distinct"), Seen.Num(), Grid.GetNumCells());
+
+	// Random directions always land in a valid cell.
+	FRandomStream Rng(1234);
+	for (int32 i = 0; i < 1000; ++i)
+	{
+		TestTrue(TEXT("Random direction maps to a valid cell"), Grid.IsValidCell(Grid.CellFromDirection(Rng.GetUnitVector())));
+	}
+	return true;
+}
+
+// ---------------------------------------------------------------------------
+// Equal-angle split: cells are about the same size everywhere on the sphere
+// ---------------------------------------------------------------------------
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FPlanetCellGridEvenCellSize,
+	"FederationGame.Planet.PlanetCellGrid.EvenCellSize",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter
+)
+
+bool FPlanetCellGridEvenCellSize::RunTest(const FString& Parameters)
+{
+	const FPlanetCellGrid Grid(8);
+	double MinSpacing = DBL_MAX;
+	double MaxSpacing = 0.0;
+	for (int32 Face = 0; Face < 6; ++Face)
+	{
+		for (int32 Y = 0; Y < 8; ++Y)
+		{
+			for (int32 X = 0; X < 7; ++X)
+			{
+				const double Spacing = FMath::Acos(FVector::DotProduct(
+					Grid.GetCellCenterDirection(FPlanetCellId(Face, X, Y)),
+					Grid.GetCellCenterDirection(FPlanetCellId(Face, X + 1, Y))));
+				MinSpacing = FMath::Min(MinSpacing, Spacing);
+				MaxSpacing = FMath::Max(MaxSpacing, Spacing);
+			}
+		}
+	}
+
+	AddInfo(FString::Printf(TEXT("Center spacing %.4f..%.4f rad (cell angle %.4f)"), MinSpacing, MaxSpacing, Grid.GetCellAngle()));
+	TestTrue(TEXT("Smallest spacing within 30% of the largest"), MinSpacing > MaxSpacing * 0.7);
+	TestTrue(TEXT("Largest spacing close to the nominal cell angle"), FMath::IsNearlyEqual(MaxSpacing, Grid.GetCellAngle(), Grid.GetCellAngle() * 0.1));
+	return true;
+}
+
+// ---------------------------------------------------------------------------
+// Rings: 8 neighbours inside a face, 7 at a cube corner, seams cost one step
+// ---------------------------------------------------------------------------
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FPlanetCellGridRings,
+	"FederationGame.Planet.PlanetCellGrid.Rings",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter
+)
+
+bool FPlanetCellGridRings::RunTest(const FString& Parameters)
+{
+	const FPlanetCellGrid Grid(4);
+	TArray<FPlanetCellId, TInlineAllocator<8>> Neighbors;
+
+	Grid.GetNeighbors(FPlanetCellId(0, 1, 1), Neighbors);
+	TestEqual(TEXT("Interior cell has 8 neighbours"), Neighbors.Num(), 8);
+
+	Grid.GetNeighbors(FPlanetCellId(0, 3, 1), Neighbors);
+	TestEqual(TEXT("Edge cell has 8 neighbours (3 across the seam)"), Neighbors.Num(), 8);
+	int32 OtherFace = 0;
+	for (const FPlanetCellId& Neighbor : Neighbors)
+	{
+		TestTrue(TEXT("Neighbour is a valid cell"), Grid.IsValidCell(Neighbor));
+		OtherFace += Neighbor.Face != 0 ? 1 : 0;
+	}
+	TestEqual(TEXT("Three neighbours on the adjacent face"), OtherFace, 3);
+
+	Grid.GetNeighbors(FPlanetCellId(0, 3, 3), Neighbors);
+	TestEqual(TEXT("Corner cell has 7 neighbours"), Neighbors.Num(), 7);
+
+	// Neighbourhood is symmetric, including across seams.
+	for (int32 Face = 0; Face < 6; ++Face)
+	{
+		for (int32 Y = 0; Y < 4; ++Y)
+		{
+			for (int32 X = 0; X < 4; ++X)
+			{
+				const FPlanetCellId Cell(Face, X, Y);
+				Grid.GetNeighbors(Cell, Neighbors);
+				for (const FPlanetCellId& Neighbor : Neighbors)
+				{
+					TArray<FPlanetCellId, TInlineAllocator<8>> Back;
+					Grid.GetNeighbors(Neighbor, Back);
+					TestTrue(FString::Printf(TEXT("%d/%d/%d <-> %d/%d/%d"), Face, X, Y, Neighbor.Face, Neighbor.X, Neighbor.Y), Back.Contains(Cell));
+				}
+			}
+		}
+	}
+
+	TMap<FPlanetCellId, int32> Rings;
+	Grid.GatherCellsInRings(FPlanetCellId(0, 1, 1), 1, Rings);
+	TestEqual(TEXT("Ring 0..1 around an interior cell is 3x3"), Rings.Num(), 9);
+	Grid.GatherCellsInRings(FPlanetCellId(0, 1, 1), 8, Rings);
+	TestEqual(TEXT("Enough rings cover the whole sphere"), Rings.Num(), Grid.GetNumCells());
+
+	// Just either side of the +X/+Y cube edge.
+	const FPlanetCellId EdgeCell = Grid.CellFromDirection(FVector(1.0, 0.95, -0.25));
+	const FPlanetCellId SeamCell = Grid.CellFromDirection(FVector(1.0, 1.05, -0.25));
+	TestTrue(TEXT("Inside the edge stays on face 0"), EdgeCell == FPlanetCellId(0, 3, 1));
+	TestTrue(TEXT("Past the edge lands on face 2"), SeamCell == FPlanetCellId(2, 0, 1));
+	TestEqual(TEXT("Across the seam is one ring"), Grid.GetRingDistance(EdgeCell, SeamCell, 4), 1);
+	TestEqual(TEXT("Opposite faces are out of a small ring"), Grid.GetRingDistance(FPlanetCellId(0, 1, 1), FPlanetCellId(1, 1, 1), 2), INDEX_NONE);
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,75 @@
+// Copyright Federation Game. All Rights Reserved.
+
+#include "Misc/AutomationTest.h"
+#include "Planet/PlanetContentWarmUp.h"
+#include "Engine/StaticMesh.h"
+#include "Engine/StaticMeshActor.h"
+#include "Engine/World.h"
+#include "Components/StaticMeshComponent.h"
+#include "Tests/AutomationCommon.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+// ---------------------------------------------------------------------------
+// 1. Nothing to warm: active at once with no outstanding requests; Reset clears it
+// ---------------------------------------------------------------------------
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FPlanetContentWarmUpEmpty,
+	"FederationGame.Planet.PlanetContentWarmUp.Empty",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter
+)
+
+bool FPlanetContentWarmUpEmpty::RunTest(const FString& Parameters)
+{
+	FPlanetContentWarmUp WarmUp;
+	TestFalse(TEXT("Inactive before Begin"), WarmUp.IsActive());
+
+	TestEqual(TEXT("No level, no requests"), WarmUp.Begin(static_cast<const ULevel*>(nullptr), 5.f), 0);
+	TestTrue(TEXT("Active after Begin"), WarmUp.IsActive());
+	TestEqual(TEXT("Nothing outstanding"), WarmUp.Update(), 0);
+
+	TestEqual(TEXT("No actor, no requests"), WarmUp.Begin(static_cast<const AActor*>(nullptr), 5.f), 0);
+	WarmUp.Reset();
+	TestFalse(TEXT("Inactive after Reset"), WarmUp.IsActive());
+	return true;
+}
+
+// ---------------------------------------------------------------------------
+// 2. A mesh actor: its mesh and textures are requested, outstanding only goes down, gone counts as done
+// ---------------------------------------------------------------------------
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FPlanetContentWarmUpMeshActor,
+	"FederationGame.Planet.PlanetContentWarmUp.MeshActor",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter
+)
+
+bool FPlanetContentWarmUpMeshActor::RunTest(const FString& Parameters)
+{
+	UWorld* World = GEngine->GetWorldContexts()[0].World();
+	if (!World) { AddError(TEXT("No world context")); return false; }
+
+	UStaticMesh* Mesh = LoadObject<UStaticMesh>(nullptr, TEXT("/Engine/BasicShapes/Sphere.Sphere"));
+	if (!Mesh) { AddWarning(TEXT("Engine sphere mesh not found; skipped")); return true; }
+
+	AStaticMeshActor* Actor = World->SpawnActor<AStaticMeshActor>(FVector(0.f, 0.f, -5.0e6f), FRotator::ZeroRotator);
+	if (!Actor) { AddError(TEXT("Failed to spawn")); return false; }
+	Actor->GetStaticMeshComponent()->SetStaticMesh(Mesh);
+
+	FPlanetContentWarmUp WarmUp;
+	const int32 NumRequests = WarmUp.Begin(Actor, 5.f);
+	TestTrue(TEXT("At least the mesh is requested"), NumRequests >= 1);
+	TestEqual(TEXT("Every request starts outstanding"), WarmUp.GetNumOutstanding(), NumRequests);
+
+	const int32 Outstanding = WarmUp.Update();
+	TestTrue(TEXT("Outstanding never grows"), Outstanding <= NumRequests);
+	AddInfo(FString::Printf(TEXT("%d requests, %d outstanding after one update"), NumRequests, Outstanding));
+
+	// Destroyed content has nothing left to hitch on; its components' requests drop out.
+	Actor->Destroy();
+	TestTrue(TEXT("Shared assets may remain, nothing more"), WarmUp.Update() <= Outstanding);
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
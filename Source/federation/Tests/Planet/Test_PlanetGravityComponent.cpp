@@ -3,6 +3,7 @@
 #include "Misc/AutomationTest.h"
 #include "Planet/PlanetGravityComponent.h"
 #include "Planet/PlanetGravitySourceComponent.h"
+#include "Planet/GravitySourceSubsystem.h"
 #include "Engine/World.h"
 #include "Tests/AutomationCommon.h"
 #include "GameFramework/Character.h"
@@ -561,4 +562,272 @@ bool FPlanetGravityComponentTwoSourceBlendSmoothAcrossMidpoint::RunTest(const FS
 	return true;
 }
 
+// ---------------------------------------------------------------------------
+// Batched pre-physics pass matches the serial per-component update
+// ---------------------------------------------------------------------------
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FPlanetGravityComponentBatchedMatchesSerial,
+	"FederationGame.Planet.PlanetGravityComponent.BatchedMatchesSerial",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter
+)
+
+bool FPlanetGravityComponentBatchedMatchesSerial::RunTest(const FString& Parameters)
+{
+	UWorld* World = GEngine->GetWorldContexts()[0].World();
+	if (!World) { AddError(TEXT("No world context")); return false; }
+	UGravitySourceSubsystem* Subsystem = World->GetSubsystem<UGravitySourceSubsystem>();
+	if (!Subsystem) { AddError(TEXT("No gravity source subsystem")); return false; }
+
+	AStaticMeshActor* PlanetA = World->SpawnActor<AStaticMeshActor>();
+	AStaticMeshActor* PlanetB = World->SpawnActor<AStaticMeshActor>();
+	if (!PlanetA || !PlanetB) { AddError(TEXT("Failed to spawn planets")); return false; }
+	PlanetA->SetActorLocation(FVector(-100000.f, 0.f, 0.f));
+	PlanetB->SetActorLocation(FVector(100000.f, 0.f, 0.f));
+
+	UPlanetGravitySourceComponent* SourceA = NewObject<UPlanetGravitySourceComponent>(PlanetA, TEXT("GravitySourceA"));
+	UPlanetGravitySourceComponent* SourceB = NewObject<UPlanetGravitySourceComponent>(PlanetB, TEXT("GravitySourceB"));
+	SourceA->RegisterComponent();
+	SourceB->RegisterComponent();
+	SourceA->ManualRadius = 50000.f;
+	SourceB->ManualRadius = 30000.f;
+	SourceB->FalloffExponent = 1.5f;
+	Subsystem->RefreshSourceCache(true);
+
+	const FVector Locations[] = {
+		FVector(-45000.f, 0.f, 0.f),
+		FVector(0.f, 0.f, 0.f),
+		FVector(70000.f, 5000.f, -2000.f),
+		FVector(0.f, 300000.f, 0.f),
+		FVector(-100000.f, 0.f, 51000.f)
+	};
+	const int32 NumChars = UE_ARRAY_COUNT(Locations);
+
+	TArray<ACharacter*> Chars;
+	TArray<UPlanetGravityComponent*> Comps;
+	for (int32 i = 0; i < NumChars; ++i)
+	{
+		UPlanetGravityComponent* Comp = nullptr;
+		ACharacter* Char = SpawnCharacterWithGravityComp(World, Comp);
+		if (!Char || !Comp) { AddError(TEXT("Failed to spawn")); return false; }
+		Char->SetActorLocation(Locations[i]);
+		Comp->SetSurfaceBlendAlpha(i == 2 ? 0.5f : 0.f);
+		Chars.Add(Char);
+		Comps.Add(Comp);
+	}
+
+	TArray<FVector> SerialDirs;
+	TArray<float> SerialScales;
+	for (UPlanetGravityComponent* Comp : Comps)
+	{
+		Comp->UpdatePlanetGravity();
+		SerialDirs.Add(Comp->GravityDir);
+		SerialScales.Add(Comp->LastComputedGravityScale);
+		Comp->GravityDir = FVector::ZeroVector;
+		Comp->LastComputedGravityScale = -1.f;
+	}
+
+	TestTrue(TEXT("Every gravity component should be registered as a batch consumer"), Subsystem->GetNumGravityConsumers() >= NumChars);
+	Subsystem->RunGravityBatch();
+
+	for (int32 i = 0; i < NumChars; ++i)
+	{
+		TestTrue(FString::Printf(TEXT("Batched direction %d should match serial"), i), Comps[i]->GravityDir.Equals(SerialDirs[i], 1e-4f));
+		TestEqual(FString::Printf(TEXT("Batched scale %d should match serial"), i), Comps[i]->LastComputedGravityScale, SerialScales[i], 1e-4f);
+		if (UCharacterMovementComponent* CMC = Chars[i]->GetCharacterMovement())
+		{
+			TestEqual(FString::Printf(TEXT("CMC gravity scale %d should be written back"), i), CMC->GravityScale, SerialScales[i], 1e-4f);
+		}
+	}
+
+	for (ACharacter* Char : Chars)
+	{
+		Char->Destroy();
+	}
+	PlanetA->Destroy();
+	PlanetB->Destroy();
+	return true;
+}
+
+// ---------------------------------------------------------------------------
+// Consumers registered before begin play (level-placed) still wait on the batch tick
+// ---------------------------------------------------------------------------
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FPlanetGravityComponentBatchPrerequisiteBeforeBeginPlay,
+	"FederationGame.Planet.PlanetGravityComponent.BatchPrerequisiteBeforeBeginPlay",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter
+)
+
+bool FPlanetGravityComponentBatchPrerequisiteBeforeBeginPlay::RunTest(const FString& Parameters)
+{
+	// The editor world never begins play, so registering here is the level-load order: OnRegister first.
+	UWorld* World = GEngine->GetWorldContexts()[0].World();
+	if (!World) { AddError(TEXT("No world context")); return false; }
+	UGravitySourceSubsystem* Subsystem = World->GetSubsystem<UGravitySourceSubsystem>();
+	if (!Subsystem) { AddError(TEXT("No gravity source subsystem")); return false; }
+
+	UPlanetGravityComponent* Comp = nullptr;
+	ACharacter* Char = SpawnCharacterWithGravityComp(World, Comp);
+	if (!Char || !Comp) { AddError(TEXT("Failed to spawn")); return false; }
+	UCharacterMovementComponent* CMC = Char->GetCharacterMovement();
+
+	const FTickFunction* BatchTick = &Subsystem->GetBatchTickFunction();
+	auto WaitsOnBatch = [BatchTick](const FTickFunction& Tick)
+	{
+		return Tick.GetPrerequisites().ContainsByPredicate([BatchTick](const FTickPrerequisite& Prerequisite)
+		{
+			return Prerequisite.PrerequisiteTickFunction == BatchTick;
+		});
+	};
+
+	TestTrue(TEXT("Batch tick should be configured before begin play"), BatchTick->bCanEverTick && BatchTick->TickGroup == TG_PrePhysics);
+	TestTrue(TEXT("Gravity component should tick after the batch"), WaitsOnBatch(Comp->PrimaryComponentTick));
+	TestTrue(TEXT("CMC should move after the batch"), CMC && WaitsOnBatch(CMC->PrimaryComponentTick));
+
+	Comp->UnregisterComponent();
+	TestFalse(TEXT("Unregistered component should drop the prerequisite"), WaitsOnBatch(Comp->PrimaryComponentTick));
+
+	Char->Destroy();
+	return true;
+}
+
+// ---------------------------------------------------------------------------
+// Async ground probe: trace length follows fall speed, hit applied from current position
+// ---------------------------------------------------------------------------
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FPlanetGravityComponentGroundProbeAdaptsToFallSpeed,
+	"FederationGame.Planet.PlanetGravityComponent.GroundProbeAdaptsToFallSpeed",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter
+)
+
+bool FPlanetGravityComponentGroundProbeAdaptsToFallSpeed::RunTest(const FString& Parameters)
+{
+	UWorld* World = GEngine->GetWorldContexts()[0].World();
+	if (!World) { AddError(TEXT("No world context")); return false; }
+	UGravitySourceSubsystem* Subsystem = World->GetSubsystem<UGravitySourceSubsystem>();
+	if (!Subsystem) { AddError(TEXT("No gravity source subsystem")); return false; }
+
+	UPlanetGravityComponent* Comp = nullptr;
+	ACharacter* Char = SpawnCharacterWithGravityComp(World, Comp);
+	if (!Char || !Comp) { AddError(TEXT("Failed to spawn")); return false; }
+
+	UCharacterMovementComponent* CMC = Char->GetCharacterMovement();
+	Comp->GravityDir = FVector(0.f, 0.f, -1.f);
+	CMC->SetMovementMode(MOVE_Falling);
+	const float DeltaTime = 1.f / 60.f;
+
+	FVector Start, End;
+	CMC->Velocity = FVector::ZeroVector;
+	Comp->RecoverGroundContact(DeltaTime);
+	TestTrue(TEXT("Falling character should queue a probe"), Subsystem->GetQueuedGroundProbe(Comp, Start, End));
+	TestEqual(TEXT("Resting probe should use the base length"), (End - Start).Size(), Comp->GroundRecoveryTraceLength, 0.01f);
+
+	CMC->Velocity = FVector(0.f, 0.f, -3000.f);
+	Comp->RecoverGroundContact(DeltaTime);
+	Subsystem->GetQueuedGroundProbe(Comp, Start, End);
+	const float Expected = Comp->GroundRecoveryTraceLength + 3000.f * DeltaTime * Comp->GroundRecoveryLookaheadFrames;
+	TestEqual(TEXT("Fast fall should extend the probe"), (End - Start).Size(), Expected, 0.01f);
+	TestTrue(TEXT("Probe should point along gravity"), (End - Start).GetSafeNormal().Equals(Comp->GravityDir, 1e-4f));
+
+	// Submitting moves the probe in flight; nothing blocks the main thread.
+	Subsystem->RunGroundProbes(DeltaTime);
+	TestFalse(TEXT("Submitted probe should leave the queue"), Subsystem->GetQueuedGroundProbe(Comp, Start, End));
+	TestTrue(TEXT("Submitted probe should be in flight"), Subsystem->GetNumInFlightGroundProbes() >= 1);
+
+	// The hit lands a frame late: only snap if the surface is still close to where we are now.
+	const FVector Bottom = Char->GetActorLocation() + Comp->GravityDir * Char->GetCapsuleComponent()->GetScaledCapsuleHalfHeight();
+	FHitResult FarHit;
+	FarHit.bBlockingHit = true;
+	FarHit.ImpactPoint = Bottom + Comp->GravityDir * (Comp->GroundRecoveryTraceLength + 100.f);
+	Comp->ApplyGroundProbeHit(FarHit);
+	TestTrue(TEXT("Far hit should keep falling"), CMC->MovementMode == MOVE_Falling);
+
+	FHitResult NearHit = FarHit;
+	NearHit.ImpactPoint = Bottom + Comp->GravityDir * (Comp->GroundRecoveryTraceLength * 0.5f);
+	Comp->ApplyGroundProbeHit(NearHit);
+	TestTrue(TEXT("Near hit should recover to walking"), CMC->MovementMode == MOVE_Walking);
+
+	Char->Destroy();
+	return true;
+}
+
+// ---------------------------------------------------------------------------
+// Many falling consumers: one probe each (latest wins), hits handed back before their CMCs move
+// ---------------------------------------------------------------------------
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FPlanetGravityComponentGroundProbesOnePerConsumer,
+	"FederationGame.Planet.PlanetGravityComponent.GroundProbesOnePerConsumer",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter
+)
+
+bool FPlanetGravityComponentGroundProbesOnePerConsumer::RunTest(const FString& Parameters)
+{
+	UWorld* World = GEngine->GetWorldContexts()[0].World();
+	if (!World) { AddError(TEXT("No world context")); return false; }
+	UGravitySourceSubsystem* Subsystem = World->GetSubsystem<UGravitySourceSubsystem>();
+	if (!Subsystem) { AddError(TEXT("No gravity source subsystem")); return false; }
+
+	const float DeltaTime = 1.f / 60.f;
+	Subsystem->RunGroundProbes(DeltaTime);
+	const int32 QueuedBefore = Subsystem->GetNumQueuedGroundProbes();
+
+	constexpr int32 NumChars = 64;
+	TArray<ACharacter*> Chars;
+	TArray<UPlanetGravityComponent*> Comps;
+	for (int32 i = 0; i < NumChars; ++i)
+	{
+		UPlanetGravityComponent* Comp = nullptr;
+		ACharacter* Char = SpawnCharacterWithGravityComp(World, Comp);
+		if (!Char || !Comp) { AddError(TEXT("Failed to spawn")); return false; }
+		Char->SetActorLocation(FVector(i * 1000.f, 0.f, 5.0e6f));
+		Comp->GravityDir = FVector(0.f, 0.f, -1.f);
+		Char->GetCharacterMovement()->SetMovementMode(MOVE_Falling);
+		Chars.Add(Char);
+		Comps.Add(Comp);
+	}
+
+	// Two passes in one frame: the second replaces the first rather than adding to the queue.
+	for (int32 Pass = 0; Pass < 2; ++Pass)
+	{
+		for (int32 i = 0; i < NumChars; ++i)
+		{
+			Chars[i]->GetCharacterMovement()->Velocity = FVector(0.f, 0.f, Pass == 0 ? 0.f : -3000.f);
+			Comps[i]->RecoverGroundContact(DeltaTime);
+		}
+	}
+	TestEqual(TEXT("One queued probe per consumer"), Subsystem->GetNumQueuedGroundProbes() - QueuedBefore, NumChars);
+
+	const float Expected = Comps[0]->GroundRecoveryTraceLength + 3000.f * DeltaTime * Comps[0]->GroundRecoveryLookaheadFrames;
+	const FTickFunction* BatchTick = &Subsystem->GetBatchTickFunction();
+	int32 Stale = 0;
+	int32 Unordered = 0;
+	for (int32 i = 0; i < NumChars; ++i)
+	{
+		FVector Start, End;
+		if (!Subsystem->GetQueuedGroundProbe(Comps[i], Start, End) || !FMath::IsNearlyEqual((End - Start).Size(), Expected, 0.01f))
+		{
+			++Stale;
+		}
+		// Probes are submitted and their hits applied in the batch tick, which every CMC waits on.
+		const bool bOrdered = Chars[i]->GetCharacterMovement()->PrimaryComponentTick.GetPrerequisites().ContainsByPredicate(
+			[BatchTick](const FTickPrerequisite& Prerequisite) { return Prerequisite.PrerequisiteTickFunction == BatchTick; });
+		if (!bOrdered) ++Unordered;
+	}
+	TestEqual(TEXT("Every queued probe should be the latest one"), Stale, 0);
+	TestEqual(TEXT("Every CMC should move after the ground probes"), Unordered, 0);
+
+	Subsystem->RunGroundProbes(DeltaTime);
+	TestEqual(TEXT("Submitting should empty the queue"), Subsystem->GetNumQueuedGroundProbes(), 0);
+	TestTrue(TEXT("Every probe should be in flight"), Subsystem->GetNumInFlightGroundProbes() >= NumChars);
+
+	for (ACharacter* Char : Chars)
+	{
+		Char->Destroy();
+	}
+	return true;
+}
+
 #endif // WITH_DEV_AUTOMATION_TESTS
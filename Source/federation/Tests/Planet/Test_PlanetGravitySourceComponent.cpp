@@ -2,6 +2,7 @@
 
 #include "Misc/AutomationTest.h"
 #include "Planet/PlanetGravitySourceComponent.h"
+#include "Planet/Planet.h"
 #include "Engine/World.h"
 #include "Tests/AutomationCommon.h"
 #include "Engine/StaticMeshActor.h"
@@ -67,4 +68,45 @@ bool FPlanetGravitySourceMaxInfluenceCutoffWorks::RunTest(const FString& Paramet
 	return true;
 }
 
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FPlanetGravitySourceRadiusIsCached,
+	"FederationGame.Planet.PlanetGravitySourceComponent.RadiusIsCached",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter
+)
+
+bool FPlanetGravitySourceRadiusIsCached::RunTest(const FString& Parameters)
+{
+	UWorld* World = GEngine->GetWorldContexts()[0].World();
+	if (!World) { AddError(TEXT("No world context")); return false; }
+
+	APlanet* Planet = World->SpawnActor<APlanet>();
+	if (!Planet || !Planet->PlanetGravitySource) { AddError(TEXT("Failed to spawn APlanet")); return false; }
+	Planet->SetActorScale3D(FVector(10.f));
+	UPlanetGravitySourceComponent* Source = Planet->PlanetGravitySource;
+
+	const float First = Source->GetSourceRadiusUU();
+	if (First <= 0.f)
+	{
+		AddWarning(TEXT("Planet has no measurable bounds (sphere mesh missing); skipping cache checks"));
+		Planet->Destroy();
+		return true;
+	}
+	TestTrue(TEXT("Radius should be cached after the first query"), Source->IsRadiusCacheValid());
+	TestEqual(TEXT("Cached radius should match the first measurement"), Source->GetSourceRadiusUU(), First);
+
+	Planet->SetActorLocation(FVector(100000.f, 0.f, 0.f));
+	TestTrue(TEXT("Translation alone should keep the cached radius"), Source->IsRadiusCacheValid());
+
+	Planet->SetActorScale3D(FVector(20.f));
+	TestFalse(TEXT("Scale change should invalidate the cached radius"), Source->IsRadiusCacheValid());
+	TestTrue(TEXT("Radius should grow with scale"), Source->GetSourceRadiusUU() > First * 1.5f);
+	TestTrue(TEXT("Radius should be cached again after re-measuring"), Source->IsRadiusCacheValid());
+
+	Source->InvalidateRadiusCache();
+	TestFalse(TEXT("InvalidateRadiusCache should drop the cached radius"), Source->IsRadiusCacheValid());
+
+	Planet->Destroy();
+	return true;
+}
+
 #endif // WITH_DEV_AUTOMATION_TESTS
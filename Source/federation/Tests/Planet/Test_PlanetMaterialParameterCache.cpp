@@ -0,0 +1,52 @@
+// Copyright Federation Game. All Rights Reserved.
+
+#include "Misc/AutomationTest.h"
+#include "Planet/PlanetMaterialParameterCache.h"
+#include "Materials/Material.h"
+#include "Materials/MaterialInstanceDynamic.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+// ---------------------------------------------------------------------------
+// 1. Unchanged values are skipped; changes, new names and invalidation push
+// ---------------------------------------------------------------------------
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FPlanetMaterialParameterCacheSkipsUnchanged,
+	"FederationGame.Planet.PlanetMaterialParameterCache.SkipsUnchanged",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter
+)
+
+bool FPlanetMaterialParameterCacheSkipsUnchanged::RunTest(const FString& Parameters)
+{
+	UMaterialInstanceDynamic* MID = UMaterialInstanceDynamic::Create(UMaterial::GetDefaultMaterial(MD_Surface), GetTransientPackage());
+	if (!MID) { AddError(TEXT("Failed to create MID")); return false; }
+
+	FPlanetMaterialParameterCache Cache(1.e-4f);
+	TestFalse(TEXT("No target, no push"), Cache.SetScalar(static_cast<UMaterialInstanceDynamic*>(nullptr), TEXT("FadeAlpha"), 1.f));
+	TestEqual(TEXT("Null target isn't counted"), Cache.GetNumPushes() + Cache.GetNumSkipped(), 0);
+
+	TestTrue(TEXT("First value pushes"), Cache.SetScalar(MID, TEXT("FadeAlpha"), 1.f));
+	TestFalse(TEXT("Same value is skipped"), Cache.SetScalar(MID, TEXT("FadeAlpha"), 1.f));
+	TestFalse(TEXT("Change within tolerance is skipped"), Cache.SetScalar(MID, TEXT("FadeAlpha"), 1.f - 1.e-6f));
+	TestTrue(TEXT("Real change pushes"), Cache.SetScalar(MID, TEXT("FadeAlpha"), 0.5f));
+	TestTrue(TEXT("Other parameter is tracked separately"), Cache.SetScalar(MID, TEXT("RevealRadius"), 0.5f));
+
+	// Tolerance is relative for large values: world-space positions don't push on float noise.
+	const FLinearColor Center(2.0e6f, -3.0e5f, 1.0e5f);
+	TestTrue(TEXT("Vector pushes"), Cache.SetVector(MID, TEXT("RevealCenterWS"), Center));
+	TestFalse(TEXT("Vector within relative tolerance is skipped"), Cache.SetVector(MID, TEXT("RevealCenterWS"), FLinearColor(2.0e6f + 1.f, -3.0e5f, 1.0e5f)));
+	TestTrue(TEXT("Vector moved past tolerance pushes"), Cache.SetVector(MID, TEXT("RevealCenterWS"), FLinearColor(2.0e6f + 5000.f, -3.0e5f, 1.0e5f)));
+
+	TestEqual(TEXT("Push count"), Cache.GetNumPushes(), 5);
+	TestEqual(TEXT("Skip count"), Cache.GetNumSkipped(), 3);
+
+	Cache.Invalidate();
+	TestTrue(TEXT("Invalidated value pushes again"), Cache.SetScalar(MID, TEXT("FadeAlpha"), 0.5f));
+
+	UMaterialInstanceDynamic* OtherMID = UMaterialInstanceDynamic::Create(UMaterial::GetDefaultMaterial(MD_Surface), GetTransientPackage());
+	TestTrue(TEXT("Same value on another material pushes"), Cache.SetScalar(OtherMID, TEXT("FadeAlpha"), 0.5f));
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,183 @@
+// Copyright Federation Game. All Rights Reserved.
+
+#include "Misc/AutomationTest.h"
+#include "Planet/PlanetQuadtree.h"
+#include "Planet/PlanetCellGrid.h"
+#include "Planet/PlanetLODMesh.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+/** Fraction of the sphere covered by Nodes, in faces (6 = exactly once, if none overlap). */
+static double CoveredFaces(const TArray<FPlanetQuadNodeId>& Nodes)
+{
+	double Faces = 0.0;
+	for (const FPlanetQuadNodeId& Node : Nodes)
+	{
+		Faces += 1.0 / static_cast<double>(1 << (2 * Node.Depth));
+	}
+	return Faces;
+}
+
+static bool AnyOverlap(const TArray<FPlanetQuadNodeId>& Nodes)
+{
+	for (const FPlanetQuadNodeId& A : Nodes)
+	{
+		for (const FPlanetQuadNodeId& B : Nodes)
+		{
+			if (A != B && A.Contains(B)) return true;
+		}
+	}
+	return false;
+}
+
+// ---------------------------------------------------------------------------
+// 1. Leaves cover the sphere exactly once and refine toward the viewer
+// ---------------------------------------------------------------------------
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FPlanetQuadtreeLeafSelection,
+	"FederationGame.Planet.PlanetQuadtree.LeafSelection",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter
+)
+
+bool FPlanetQuadtreeLeafSelection::RunTest(const FString& Parameters)
+{
+	constexpr double Radius = 100000.0;
+	const FPlanetQuadtree Tree(Radius, 8, 2.0);
+	TArray<FPlanetQuadNodeId> Leaves;
+
+	Tree.SelectLeaves(FVector(Radius * 100.0, 0.0, 0.0), Leaves);
+	TestEqual(TEXT("Far away: the 6 face roots"), Leaves.Num(), 6);
+
+	const FVector GroundDir = FVector(0.3, 0.8, 0.5).GetSafeNormal();
+	Tree.SelectLeaves(GroundDir * (Radius + 100.0), Leaves);
+	TestTrue(TEXT("Leaves cover the sphere exactly once"), FMath::IsNearlyEqual(CoveredFaces(Leaves), 6.0, 1e-9));
+	TestFalse(TEXT("No leaf overlaps another"), AnyOverlap(Leaves));
+
+	const FPlanetQuadNodeId Under = Tree.NodeFromDirection(GroundDir, Tree.GetMaxDepth());
+	TestTrue(TEXT("Leaf under a ground-level viewer is at max depth"), Leaves.Contains(Under));
+
+	const FPlanetQuadNodeId Antipode = Tree.NodeFromDirection(-GroundDir, Tree.GetMaxDepth());
+	int32 AntipodeDepth = INDEX_NONE;
+	for (const FPlanetQuadNodeId& Leaf : Leaves)
+	{
+		if (Leaf.Contains(Antipode)) AntipodeDepth = Leaf.Depth;
+	}
+	TestTrue(TEXT("Far side of the planet stays coarse"), AntipodeDepth >= 0 && AntipodeDepth <= 1);
+	AddInfo(FString::Printf(TEXT("%d leaves at ground level (max depth %d)"), Leaves.Num(), Tree.GetMaxDepth()));
+	return true;
+}
+
+// ---------------------------------------------------------------------------
+// 2. Node (F, D, X, Y) is cell (F, X, Y) of a 2^D grid
+// ---------------------------------------------------------------------------
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FPlanetQuadtreeMatchesCellGrid,
+	"FederationGame.Planet.PlanetQuadtree.MatchesCellGrid",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter
+)
+
+bool FPlanetQuadtreeMatchesCellGrid::RunTest(const FString& Parameters)
+{
+	const FPlanetQuadtree Tree(1000.0, 4, 2.0);
+	const FPlanetCellGrid Grid(8);
+	for (int32 Face = 0; Face < 6; ++Face)
+	{
+		for (int32 Y = 0; Y < 8; ++Y)
+		{
+			for (int32 X = 0; X < 8; ++X)
+			{
+				const FPlanetQuadNodeId Node(Face, 3, X, Y);
+				TestTrue(TEXT("Same center as the cell"), Tree.GetNodeCenterDirection(Node).Equals(Grid.GetCellCenterDirection(FPlanetCellId(Face, X, Y)), 1e-9));
+				TestTrue(TEXT("Parent contains child"), Node.GetParent().Contains(Node));
+				TestTrue(TEXT("Child round-trips through its parent"), Node.GetParent().GetChild((X & 1) | ((Y & 1) << 1)) == Node);
+			}
+		}
+	}
+	return true;
+}
+
+// ---------------------------------------------------------------------------
+// 3. LOD mesh: refinement never opens a hole and respects the upload budget
+// ---------------------------------------------------------------------------
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FPlanetLODMeshNoHoles,
+	"FederationGame.Planet.PlanetQuadtree.LODMeshNoHoles",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter
+)
+
+bool FPlanetLODMeshNoHoles::RunTest(const FString& Parameters)
+{
+	UWorld* World = GEngine->GetWorldContexts()[0].World();
+	if (!World) { AddError(TEXT("No world")); return false; }
+
+	APlanetLODMesh* Mesh = World->SpawnActor<APlanetLODMesh>();
+	if (!Mesh) { AddError(TEXT("Spawn failed")); return false; }
+	Mesh->SetActorTickEnabled(false);
+
+	constexpr double Radius = 100000.0;
+	FPlanetLODSettings Settings;
+	Settings.MaxDepth = 4;
+	Settings.ChunkResolution = 5;
+	Settings.MaxChunkUploadsPerTick = 3;
+	Mesh->Initialize(Settings, FPlanetTerrainSettings(), Radius, nullptr);
+
+	auto VisibleNodes = [Mesh]()
+	{
+		TArray<FPlanetQuadNodeId> Visible;
+		for (int32 Depth = 0; Depth <= Mesh->GetQuadtree().GetMaxDepth(); ++Depth)
+		{
+			for (int32 Face = 0; Face < 6; ++Face)
+			{
+				for (int32 Y = 0; Y < (1 << Depth); ++Y)
+				{
+					for (int32 X = 0; X < (1 << Depth); ++X)
+					{
+						const FPlanetQuadNodeId Node(Face, Depth, X, Y);
+						if (Mesh->IsChunkVisible(Node)) Visible.Add(Node);
+					}
+				}
+			}
+		}
+		return Visible;
+	};
+
+	// Descend from orbit to the ground, then climb back out.
+	const FVector Dir = FVector(0.2, -0.4, 0.9).GetSafeNormal();
+	const double Altitudes[] = { Radius * 10.0, Radius, Radius * 0.1, 500.0, Radius * 0.1, Radius * 10.0 };
+	for (const double Altitude : Altitudes)
+	{
+		const FVector Viewer = Dir * (Radius + Altitude);
+		for (int32 Frame = 0; Frame < 200; ++Frame)
+		{
+			Mesh->UpdateLOD(Viewer);
+			Mesh->WaitForChunkTasks();
+			TestTrue(TEXT("Upload stays within budget"), Mesh->UploadCompletedChunks(Settings.MaxChunkUploadsPerTick) <= Settings.MaxChunkUploadsPerTick);
+			Mesh->UpdateLOD(Viewer);
+
+			if (Mesh->IsBaseReady())
+			{
+				const TArray<FPlanetQuadNodeId> Visible = VisibleNodes();
+				if (!FMath::IsNearlyEqual(CoveredFaces(Visible), 6.0, 1e-9) || AnyOverlap(Visible))
+				{
+					AddError(FString::Printf(TEXT("Hole or overlap at altitude %.0f, frame %d"), Altitude, Frame));
+					Mesh->Destroy();
+					return false;
+				}
+			}
+			if (Mesh->IsFullyRefined()) break;
+		}
+		TestTrue(FString::Printf(TEXT("Fully refined at altitude %.0f"), Altitude), Mesh->IsFullyRefined());
+		AddInfo(FString::Printf(TEXT("Altitude %.0f: %d leaves, %d visible, %d resident"),
+			Altitude, Mesh->GetDesiredLeaves().Num(), Mesh->GetNumVisibleChunks(), Mesh->GetNumResidentChunks()));
+	}
+
+	Mesh->Destroy();
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,315 @@
+// Copyright Federation Game. All Rights Reserved.
+
+#include "Misc/AutomationTest.h"
+#include "Planet/PlanetStreamingSubsystem.h"
+#include "Planet/PlanetSurfaceStreamer.h"
+#include "Engine/LevelStreamingDynamic.h"
+#include "Engine/World.h"
+#include "GameFramework/Pawn.h"
+#include "Tests/AutomationCommon.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+/** Row of planets along +X, Spacing apart, each with an explicit 1000 UU streaming radius. */
+static void SpawnStreamerRow(UWorld* World, int32 Count, float Spacing, TArray<AActor*>& OutActors, TArray<UPlanetSurfaceStreamer*>& OutStreamers)
+{
+	for (int32 i = 0; i < Count; ++i)
+	{
+		AActor* Actor = World->SpawnActor<AActor>();
+		if (!Actor) continue;
+
+		USceneComponent* Root = NewObject<USceneComponent>(Actor, TEXT("Root"));
+		Root->RegisterComponent();
+		Actor->SetRootComponent(Root);
+		Actor->SetActorLocation(FVector(i * Spacing, 0.f, 0.f));
+
+		UPlanetSurfaceStreamer* Streamer = NewObject<UPlanetSurfaceStreamer>(Actor, TEXT("TestStreamer"));
+		Streamer->TransitionProfile.bUseExplicitRadiiOverrides = true;
+		Streamer->StreamingRadius = 1000.f;
+		Streamer->RegisterComponent();
+
+		OutActors.Add(Actor);
+		OutStreamers.Add(Streamer);
+	}
+}
+
+// ---------------------------------------------------------------------------
+// 1. Only planets near the player wake up; far planets stay dormant.
+// ---------------------------------------------------------------------------
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FPlanetStreamingSubsystemFarPlanetsDormant,
+	"FederationGame.Planet.PlanetStreamingSubsystem.FarPlanetsDormant",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter
+)
+
+bool FPlanetStreamingSubsystemFarPlanetsDormant::RunTest(const FString& Parameters)
+{
+	UWorld* World = GEngine->GetWorldContexts()[0].World();
+	if (!World) { AddError(TEXT("No world context")); return false; }
+	UPlanetStreamingSubsystem* Sub = World->GetSubsystem<UPlanetStreamingSubsystem>();
+	if (!Sub) { AddError(TEXT("No planet streaming subsystem")); return false; }
+
+	TArray<AActor*> Actors;
+	TArray<UPlanetSurfaceStreamer*> Streamers;
+	SpawnStreamerRow(World, 10, 100000.f, Actors, Streamers);
+	if (Streamers.Num() != 10) { AddError(TEXT("Failed to spawn")); return false; }
+
+	for (UPlanetSurfaceStreamer* Streamer : Streamers)
+	{
+		TestTrue(TEXT("Streamer starts dormant"), Streamer->IsStreamingDormant());
+	}
+
+	APawn* Pawn = World->SpawnActor<APawn>(FVector(200000.f + 500.f, 0.f, 0.f), FRotator::ZeroRotator);
+	if (!Pawn) { AddError(TEXT("Failed to spawn pawn")); return false; }
+
+	Sub->UpdateStreamers(Pawn);
+	for (int32 i = 0; i < Streamers.Num(); ++i)
+	{
+		const bool bExpectActive = i == 2;
+		TestEqual(FString::Printf(TEXT("Planet %d dormant"), i), Streamers[i]->IsStreamingDormant(), !bExpectActive);
+		TestEqual(FString::Printf(TEXT("Planet %d tick enabled"), i), Streamers[i]->IsComponentTickEnabled(), bExpectActive);
+	}
+
+	// Player leaves: the woken planet goes back to sleep.
+	Pawn->SetActorLocation(FVector(0.f, 500000.f, 0.f));
+	Sub->UpdateStreamers(Pawn);
+	TestTrue(TEXT("Planet 2 dormant after player leaves"), Streamers[2]->IsStreamingDormant());
+
+	Pawn->Destroy();
+	for (AActor* Actor : Actors) Actor->Destroy();
+	return true;
+}
+
+// ---------------------------------------------------------------------------
+// 2. Candidates are capped nearest-first; a transitioning streamer is never culled.
+// ---------------------------------------------------------------------------
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FPlanetStreamingSubsystemCapKeepsTransitioning,
+	"FederationGame.Planet.PlanetStreamingSubsystem.CapKeepsTransitioning",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter
+)
+
+bool FPlanetStreamingSubsystemCapKeepsTransitioning::RunTest(const FString& Parameters)
+{
+	UWorld* World = GEngine->GetWorldContexts()[0].World();
+	if (!World) { AddError(TEXT("No world context")); return false; }
+	UPlanetStreamingSubsystem* Sub = World->GetSubsystem<UPlanetStreamingSubsystem>();
+	if (!Sub) { AddError(TEXT("No planet streaming subsystem")); return false; }
+
+	// Five planets all within activation range of the origin, plus one far away.
+	TArray<AActor*> Actors;
+	TArray<UPlanetSurfaceStreamer*> Streamers;
+	SpawnStreamerRow(World, 5, 100.f, Actors, Streamers);
+	SpawnStreamerRow(World, 1, 0.f, Actors, Streamers);
+	if (Streamers.Num() != 6) { AddError(TEXT("Failed to spawn")); return false; }
+	Actors.Last()->SetActorLocation(FVector(0.f, 1000000.f, 0.f));
+	Streamers.Last()->SetStreamingState(EPlanetStreamingState::OnSurface);
+
+	APawn* Pawn = World->SpawnActor<APawn>(FVector::ZeroVector, FRotator::ZeroRotator);
+	if (!Pawn) { AddError(TEXT("Failed to spawn pawn")); return false; }
+
+	const int32 SavedMax = Sub->MaxActiveStreamers;
+	Sub->MaxActiveStreamers = 2;
+	Sub->UpdateStreamers(Pawn);
+	Sub->MaxActiveStreamers = SavedMax;
+
+	TestFalse(TEXT("Nearest planet awake"), Streamers[0]->IsStreamingDormant());
+	TestFalse(TEXT("Second-nearest planet awake"), Streamers[1]->IsStreamingDormant());
+	for (int32 i = 2; i < 5; ++i)
+	{
+		TestTrue(FString::Printf(TEXT("Planet %d culled by cap"), i), Streamers[i]->IsStreamingDormant());
+	}
+	TestFalse(TEXT("Far planet mid-transition stays awake"), Streamers[5]->IsStreamingDormant());
+
+	// Without a player only the transitioning streamer stays awake.
+	Sub->UpdateStreamers(nullptr);
+	TestTrue(TEXT("Idle planet dormant without player"), Streamers[0]->IsStreamingDormant());
+	TestFalse(TEXT("Transitioning planet awake without player"), Streamers[5]->IsStreamingDormant());
+
+	Streamers.Last()->SetStreamingState(EPlanetStreamingState::Idle);
+	Pawn->Destroy();
+	for (AActor* Actor : Actors) Actor->Destroy();
+	return true;
+}
+
+// ---------------------------------------------------------------------------
+// 3. Surface level pool: LRU eviction by count and memory, reuse by transform, counters.
+// ---------------------------------------------------------------------------
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FPlanetStreamingSubsystemSurfacePool,
+	"FederationGame.Planet.PlanetStreamingSubsystem.SurfaceLevelPool",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter
+)
+
+bool FPlanetStreamingSubsystemSurfacePool::RunTest(const FString& Parameters)
+{
+	UWorld* World = GEngine->GetWorldContexts()[0].World();
+	if (!World) { AddError(TEXT("No world context")); return false; }
+	UPlanetStreamingSubsystem* Sub = World->GetSubsystem<UPlanetStreamingSubsystem>();
+	if (!Sub) { AddError(TEXT("No planet streaming subsystem")); return false; }
+
+	const int32 SavedMax = Sub->MaxPooledSurfaceLevels;
+	const float SavedBudget = Sub->SurfacePoolMemoryBudgetMB;
+	Sub->FlushSurfacePool();
+	Sub->MaxPooledSurfaceLevels = 2;
+	Sub->SurfacePoolMemoryBudgetMB = 1000.f;
+	const FSurfaceLevelPoolStats Before = Sub->GetSurfacePoolStats();
+
+	// Level instances that were never added to the world: the pool only manages their flags.
+	const FString PathA = TEXT("/Game/Planets/PlanetSurface_A");
+	UPlanetSurfaceStreamer* Owner = NewObject<UPlanetSurfaceStreamer>();
+	auto MakeLevel = [World](float X)
+	{
+		ULevelStreamingDynamic* Level = NewObject<ULevelStreamingDynamic>(World);
+		Level->LevelTransform = FTransform(FVector(X, 0.f, 0.f));
+		Level->SetShouldBeLoaded(true);
+		Level->SetShouldBeVisible(true);
+		return Level;
+	};
+	ULevelStreamingDynamic* L1 = MakeLevel(1000.f);
+	ULevelStreamingDynamic* L2 = MakeLevel(2000.f);
+	ULevelStreamingDynamic* L3 = MakeLevel(3000.f);
+
+	TestTrue(TEXT("L1 pooled"), Sub->ReleaseSurfaceLevelToPool(L1, PathA, Owner, 100.f, 2.f));
+	TestTrue(TEXT("L2 pooled"), Sub->ReleaseSurfaceLevelToPool(L2, PathA, nullptr, 100.f, 3.f));
+	TestFalse(TEXT("Pooled level hidden"), L2->GetShouldBeVisibleFlag());
+	TestTrue(TEXT("L3 pooled"), Sub->ReleaseSurfaceLevelToPool(L3, PathA, nullptr, 100.f, 4.f));
+
+	TestEqual(TEXT("Count cap keeps two"), Sub->GetNumPooledSurfaceLevels(), 2);
+	TestTrue(TEXT("Least recently used evicted and unloaded"), L1->GetIsRequestingUnloadAndRemoval());
+	TestFalse(TEXT("Newer instance kept loaded"), L2->GetIsRequestingUnloadAndRemoval());
+	TestNull(TEXT("Evicted instance no longer found for its owner"), Sub->FindPooledSurfaceLevel(PathA, Owner));
+
+	// Reuse needs the same path and (for levels that can't be moved) the same placement.
+	float LoadSeconds = 0.f;
+	TestTrue(TEXT("Hit at matching transform"), Sub->AcquirePooledSurfaceLevel(PathA, L2->LevelTransform, LoadSeconds) == L2);
+	TestEqual(TEXT("Original load time reported"), LoadSeconds, 3.f);
+	TestNull(TEXT("Miss at other transform (unloaded level can't be moved)"), Sub->AcquirePooledSurfaceLevel(PathA, FTransform(FVector(9000.f, 0.f, 0.f)), LoadSeconds));
+	TestNull(TEXT("Miss for other level path"), Sub->AcquirePooledSurfaceLevel(TEXT("/Game/Planets/PlanetSurface_B"), L3->LevelTransform, LoadSeconds));
+
+	// Memory cap: 100 (L3) + 100 > 150 evicts L3; an instance bigger than the whole budget isn't pooled.
+	Sub->SurfacePoolMemoryBudgetMB = 150.f;
+	ULevelStreamingDynamic* L4 = MakeLevel(4000.f);
+	TestTrue(TEXT("L4 pooled"), Sub->ReleaseSurfaceLevelToPool(L4, PathA, Owner, 100.f, 1.f));
+	TestTrue(TEXT("Memory cap evicted L3"), L3->GetIsRequestingUnloadAndRemoval());
+	TestTrue(TEXT("Owner finds its pooled instance"), Sub->FindPooledSurfaceLevel(PathA, Owner) == L4);
+	TestFalse(TEXT("Oversized instance rejected"), Sub->ReleaseSurfaceLevelToPool(MakeLevel(5000.f), PathA, Owner, 200.f, 1.f));
+
+	const FSurfaceLevelPoolStats& After = Sub->GetSurfacePoolStats();
+	TestEqual(TEXT("Hits"), After.Hits - Before.Hits, 1);
+	TestEqual(TEXT("Misses"), After.Misses - Before.Misses, 2);
+	TestEqual(TEXT("Evictions"), After.Evictions - Before.Evictions, 2);
+	TestEqual(TEXT("Reload time saved"), static_cast<float>(After.ReloadSecondsSaved - Before.ReloadSecondsSaved), 3.f, 0.001f);
+
+	Sub->FlushSurfacePool();
+	Sub->MaxPooledSurfaceLevels = SavedMax;
+	Sub->SurfacePoolMemoryBudgetMB = SavedBudget;
+	return true;
+}
+
+// ---------------------------------------------------------------------------
+// 4. Load scheduler: IO cap defers and demotes later arrivals, memory cap cancels them.
+// ---------------------------------------------------------------------------
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FPlanetStreamingSubsystemLoadScheduler,
+	"FederationGame.Planet.PlanetStreamingSubsystem.LoadScheduler",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter
+)
+
+bool FPlanetStreamingSubsystemLoadScheduler::RunTest(const FString& Parameters)
+{
+	UWorld* World = GEngine->GetWorldContexts()[0].World();
+	if (!World) { AddError(TEXT("No world context")); return false; }
+	UPlanetStreamingSubsystem* Sub = World->GetSubsystem<UPlanetStreamingSubsystem>();
+	if (!Sub) { AddError(TEXT("No planet streaming subsystem")); return false; }
+
+	// Player between two planets, both in streaming range; the nearer one is reached first.
+	TArray<AActor*> Actors;
+	TArray<UPlanetSurfaceStreamer*> Streamers;
+	SpawnStreamerRow(World, 2, 1500.f, Actors, Streamers);
+	if (Streamers.Num() != 2) { AddError(TEXT("Failed to spawn")); return false; }
+	UPlanetSurfaceStreamer* Near = Streamers[0];
+	UPlanetSurfaceStreamer* Far = Streamers[1];
+
+	APawn* Pawn = World->SpawnActor<APawn>(FVector(600.f, 0.f, 0.f), FRotator::ZeroRotator);
+	if (!Pawn) { AddError(TEXT("Failed to spawn pawn")); return false; }
+
+	const bool bSavedPredictive = Sub->bPredictiveStreaming;
+	const int32 SavedMaxLoads = Sub->MaxConcurrentSurfaceLoads;
+	const float SavedMaxMemory = Sub->MaxResidentSurfaceMemoryMB;
+	Sub->bPredictiveStreaming = false;
+	Sub->MaxConcurrentSurfaceLoads = 1;
+	Sub->MaxResidentSurfaceMemoryMB = 2048.f;
+	const FSurfaceLoadSchedulerStats Before = Sub->GetLoadSchedulerStats();
+
+	// One IO slot: the nearer planet may load, the other waits.
+	Sub->UpdateStreamers(Pawn);
+	TestFalse(TEXT("Near planet not deferred"), Near->IsLoadDeferred());
+	TestTrue(TEXT("Far planet deferred"), Far->IsLoadDeferred());
+	TestFalse(TEXT("Deferred planet refuses a predictive load"), Far->BeginPredictiveStreamIn(FVector(1500.f, 0.f, 0.f)));
+	TestEqual(TEXT("Deferred planet stays Idle"), Far->GetStreamingState(), EPlanetStreamingState::Idle);
+
+	// Both in flight: the later arrival streams behind everything else.
+	Near->SetStreamingState(EPlanetStreamingState::Loading);
+	Far->SetStreamingState(EPlanetStreamingState::Loading);
+	Sub->UpdateStreamers(Pawn);
+	TestTrue(TEXT("Near load at raised priority"), Near->GetSurfaceLoadPriority() > 0);
+	TestTrue(TEXT("Far load demoted"), Far->GetSurfaceLoadPriority() < 0);
+	TestEqual(TEXT("One demotion"), Sub->GetLoadSchedulerStats().Demotions - Before.Demotions, 1);
+
+	// Memory for only one surface (256 MB each): the later arrival is cancelled.
+	Sub->MaxResidentSurfaceMemoryMB = 300.f;
+	Sub->UpdateStreamers(Pawn);
+	TestEqual(TEXT("Near keeps loading"), Near->GetStreamingState(), EPlanetStreamingState::Loading);
+	TestEqual(TEXT("Far cancelled to Idle"), Far->GetStreamingState(), EPlanetStreamingState::Idle);
+	TestTrue(TEXT("Cancelled planet deferred"), Far->IsLoadDeferred());
+	TestEqual(TEXT("One cancellation"), Sub->GetLoadSchedulerStats().Cancellations - Before.Cancellations, 1);
+
+	// The planet the player is on is never cancelled; the nearer load gives way instead.
+	Far->SetStreamingState(EPlanetStreamingState::OnSurface);
+	Sub->UpdateStreamers(Pawn);
+	TestEqual(TEXT("Surface planet kept"), Far->GetStreamingState(), EPlanetStreamingState::OnSurface);
+	TestEqual(TEXT("Near load cancelled"), Near->GetStreamingState(), EPlanetStreamingState::Idle);
+	TestTrue(TEXT("Deferrals counted"), Sub->GetLoadSchedulerStats().Deferrals > Before.Deferrals);
+
+	Far->SetStreamingState(EPlanetStreamingState::Idle);
+	Sub->bPredictiveStreaming = bSavedPredictive;
+	Sub->MaxConcurrentSurfaceLoads = SavedMaxLoads;
+	Sub->MaxResidentSurfaceMemoryMB = SavedMaxMemory;
+	Pawn->Destroy();
+	for (AActor* Actor : Actors) Actor->Destroy();
+	return true;
+}
+
+// ---------------------------------------------------------------------------
+// 5. Streamer, predictive, scheduler and pool caps are config properties, read from DefaultGame.ini
+// ---------------------------------------------------------------------------
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FPlanetStreamingSubsystemCapsAreConfig,
+	"FederationGame.Planet.PlanetStreamingSubsystem.CapsAreConfig",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter
+)
+
+bool FPlanetStreamingSubsystemCapsAreConfig::RunTest(const FString& Parameters)
+{
+	const UClass* Class = UPlanetStreamingSubsystem::StaticClass();
+	TestTrue(TEXT("Subsystem reads Game config"), Class->ClassConfigName == NAME_Game);
+
+	const TCHAR* ConfigNames[] = {
+		TEXT("MaxActiveStreamers"), TEXT("MaxPredictiveLoads"), TEXT("PredictiveMemoryBudgetMB"),
+		TEXT("MaxConcurrentSurfaceLoads"), TEXT("MaxResidentSurfaceMemoryMB"),
+		TEXT("MaxPooledSurfaceLevels"), TEXT("SurfacePoolMemoryBudgetMB") };
+	for (const TCHAR* Name : ConfigNames)
+	{
+		const FProperty* Property = FindFProperty<FProperty>(Class, Name);
+		TestTrue(FString::Printf(TEXT("%s is a config property"), Name), Property && Property->HasAnyPropertyFlags(CPF_Config));
+	}
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,114 @@
+// Copyright Federation Game. All Rights Reserved.
+
+#include "Misc/AutomationTest.h"
+#include "Planet/PlanetStreamingTelemetry.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+// ---------------------------------------------------------------------------
+// 1. Histogram: exact count/min/max/mean, percentiles within a bucket width
+// ---------------------------------------------------------------------------
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FPlanetTimingHistogramPercentiles,
+	"FederationGame.Planet.PlanetStreamingTelemetry.HistogramPercentiles",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter
+)
+
+bool FPlanetTimingHistogramPercentiles::RunTest(const FString& Parameters)
+{
+	FPlanetTimingHistogram Histogram(0.01, 100.0, 40);
+	TestEqual(TEXT("Empty percentile is 0"), Histogram.GetPercentile(0.5), 0.0);
+
+	// 1..100 ms, 0.01..1 s.
+	for (int32 i = 1; i <= 100; ++i)
+	{
+		Histogram.Add(i * 0.01);
+	}
+	TestEqual(TEXT("Count"), Histogram.GetCount(), 100);
+	TestTrue(TEXT("Min is exact"), FMath::IsNearlyEqual(Histogram.GetMin(), 0.01, 1e-9));
+	TestTrue(TEXT("Max is exact"), FMath::IsNearlyEqual(Histogram.GetMax(), 1.0, 1e-9));
+	TestTrue(TEXT("Mean is exact"), FMath::IsNearlyEqual(Histogram.GetMean(), 0.505, 1e-9));
+
+	// 40 buckets over 4 decades: each bucket spans a factor of 10^(1/10) ~ 1.26.
+	const double BucketRatio = Histogram.GetBucketUpperBound(0) / Histogram.GetBucketLowerBound(0);
+	const double P50 = Histogram.GetPercentile(0.5);
+	const double P95 = Histogram.GetPercentile(0.95);
+	TestTrue(FString::Printf(TEXT("p50 %.3f near 0.5"), P50), P50 > 0.5 / BucketRatio && P50 < 0.5 * BucketRatio);
+	TestTrue(FString::Printf(TEXT("p95 %.3f near 0.95"), P95), P95 > 0.95 / BucketRatio && P95 <= 1.0);
+	TestTrue(TEXT("Percentiles are ordered"), Histogram.GetPercentile(0.1) <= P50 && P50 <= P95);
+	TestTrue(TEXT("p100 is the max"), FMath::IsNearlyEqual(Histogram.GetPercentile(1.0), 1.0, 1e-9));
+
+	// Out of range values land in the end buckets but keep exact min/max.
+	Histogram.Add(0.0001);
+	Histogram.Add(5000.0);
+	TestTrue(TEXT("Underflow in first bucket"), Histogram.GetBucketCount(0) >= 2);
+	TestEqual(TEXT("Overflow in last bucket"), Histogram.GetBucketCount(Histogram.GetNumBuckets() - 1), 1);
+	TestTrue(TEXT("Max tracks overflow"), FMath::IsNearlyEqual(Histogram.GetMax(), 5000.0, 1e-9));
+
+	int32 Total = 0;
+	for (int32 i = 0; i < Histogram.GetNumBuckets(); ++i)
+	{
+		Total += Histogram.GetBucketCount(i);
+	}
+	TestEqual(TEXT("Buckets sum to count"), Total, Histogram.GetCount());
+
+	Histogram.Reset();
+	TestEqual(TEXT("Reset clears count"), Histogram.GetCount(), 0);
+	TestEqual(TEXT("Reset clears buckets"), Histogram.GetBucketCount(0), 0);
+	return true;
+}
+
+// ---------------------------------------------------------------------------
+// 2. Telemetry: per-metric samples, stall counts and CSV export
+// ---------------------------------------------------------------------------
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FPlanetStreamingTelemetryCsv,
+	"FederationGame.Planet.PlanetStreamingTelemetry.RecordAndCsv",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter
+)
+
+bool FPlanetStreamingTelemetryCsv::RunTest(const FString& Parameters)
+{
+	FPlanetStreamingTelemetry Telemetry;
+	TestTrue(TEXT("Starts empty"), Telemetry.IsEmpty());
+
+	Telemetry.Record(EPlanetStreamingMetric::Load, 1.2);
+	Telemetry.Record(EPlanetStreamingMetric::Load, 4.5, true);
+	Telemetry.Record(EPlanetStreamingMetric::HandoffFrame, 3.0);
+	Telemetry.Record(EPlanetStreamingMetric::HandoffFrame, 0.05);
+
+	TestFalse(TEXT("Not empty after a sample"), Telemetry.IsEmpty());
+	TestEqual(TEXT("Two loads"), Telemetry.GetHistogram(EPlanetStreamingMetric::Load).GetCount(), 2);
+	TestEqual(TEXT("No unloads"), Telemetry.GetHistogram(EPlanetStreamingMetric::Unload).GetCount(), 0);
+	TestEqual(TEXT("One load stall"), Telemetry.GetNumStalls(EPlanetStreamingMetric::Load), 1);
+	TestEqual(TEXT("One stall in total"), Telemetry.GetTotalStalls(), 1);
+	TestTrue(TEXT("Handoff frames bucket in ms"), Telemetry.GetHistogram(EPlanetStreamingMetric::HandoffFrame).GetBucketLowerBound(0) < 1.0);
+
+	TArray<FString> Lines;
+	Telemetry.ToCsv().ParseIntoArrayLines(Lines);
+	TestEqual(TEXT("Header plus one row per filled bucket"), Lines.Num(), 5);
+	if (Lines.Num() == 5)
+	{
+		TestEqual(TEXT("Header"), Lines[0], FString(TEXT("Metric,Unit,LowerBound,UpperBound,Count")));
+		TestTrue(TEXT("Load rows first, in seconds"), Lines[1].StartsWith(TEXT("Load,s,")));
+		TestTrue(TEXT("Handoff rows in ms"), Lines[3].StartsWith(TEXT("HandoffFrame,ms,")));
+
+		TArray<FString> Fields;
+		Lines[1].ParseIntoArray(Fields, TEXT(","));
+		TestEqual(TEXT("Five fields"), Fields.Num(), 5);
+		if (Fields.Num() == 5)
+		{
+			TestTrue(TEXT("Bucket contains the sample"), FCString::Atod(*Fields[2]) <= 1.2 && FCString::Atod(*Fields[3]) > 1.2);
+		}
+	}
+	AddInfo(Telemetry.GetSummary(EPlanetStreamingMetric::Load));
+
+	Telemetry.Reset();
+	TestTrue(TEXT("Reset empties"), Telemetry.IsEmpty());
+	TestEqual(TEXT("Reset clears stalls"), Telemetry.GetTotalStalls(), 0);
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,159 @@
+// Copyright Federation Game. All Rights Reserved.
+
+#include "Misc/AutomationTest.h"
+#include "Planet/PlanetSurfaceMapping.h"
+#include "Math/RandomStream.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+/** Mapping for a planet of radius R at Center, with the surface frame anchored in direction AnchorDir. */
+static FPlanetSurfaceMapping MakeTestMapping(const FVector& Center, double R, const FVector& AnchorDir, double MinAltitude = 0.0)
+{
+	const FVector Normal = AnchorDir.GetSafeNormal();
+	const FVector UpHint = FMath::Abs(Normal.Z) < 0.99 ? FVector::UpVector : FVector::ForwardVector;
+	const FVector AxisX = FVector::CrossProduct(UpHint, Normal).GetSafeNormal();
+	const FVector AxisY = FVector::CrossProduct(Normal, AxisX).GetSafeNormal();
+	return FPlanetSurfaceMapping(Center, R, Center + Normal * R, Normal, AxisX, AxisY, MinAltitude);
+}
+
+// ---------------------------------------------------------------------------
+// 1. Property sweep: round trips both ways stay exact out to 1e10 UU from the origin
+// ---------------------------------------------------------------------------
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FPlanetSurfaceMappingRoundTripSweep,
+	"FederationGame.Planet.PlanetSurfaceMapping.RoundTripSweep",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter
+)
+
+bool FPlanetSurfaceMappingRoundTripSweep::RunTest(const FString& Parameters)
+{
+	// 0.1 mm: far below anything visible, far above double rounding at 1e10 UU (~2e-6).
+	const double Tolerance = 0.01;
+	constexpr int32 SamplesPerDecade = 500;
+
+	FRandomStream Rng(2024);
+	double WorstError = 0.0;
+	for (int32 Decade = 0; Decade <= 10; ++Decade)
+	{
+		double SurfaceError = 0.0;
+		double SpaceError = 0.0;
+		for (int32 i = 0; i < SamplesPerDecade; ++i)
+		{
+			const FVector Center = Rng.GetUnitVector() * FMath::Pow(10.0, Decade) * Rng.FRandRange(1.0, 9.99);
+			const double R = FMath::Pow(10.0, Rng.FRandRange(4.0, 7.0));
+			const FPlanetSurfaceMapping Mapping = MakeTestMapping(Center, R, Rng.GetUnitVector());
+
+			// Surface -> space -> surface, anywhere within a radian of arc of the anchor.
+			const FVector SurfacePos = Mapping.GetSurfaceOrigin()
+				+ FVector::VectorPlaneProject(Rng.GetUnitVector(), Mapping.GetNormal()).GetSafeNormal() * (R * Rng.FRandRange(0.0, 1.0))
+				+ Mapping.GetNormal() * (R * Rng.FRandRange(0.0, 0.2));
+			SurfaceError = FMath::Max(SurfaceError, FVector::Dist(SurfacePos, Mapping.SpaceToSurface(Mapping.SurfaceToSpace(SurfacePos))));
+
+			// Space -> surface -> space, for points above the near hemisphere.
+			FVector Dir = Rng.GetUnitVector();
+			if (FVector::DotProduct(Dir, Mapping.GetNormal()) < 0.1)
+			{
+				Dir = (Dir + Mapping.GetNormal() * 1.5).GetSafeNormal();
+			}
+			const FVector SpacePos = Center + Dir * (R * Rng.FRandRange(1.0, 1.5));
+			SpaceError = FMath::Max(SpaceError, FVector::Dist(SpacePos, Mapping.SurfaceToSpace(Mapping.SpaceToSurface(SpacePos))));
+		}
+
+		AddInfo(FString::Printf(TEXT("|center| ~1e%d: max round-trip error surface %.3g UU, space %.3g UU"), Decade, SurfaceError, SpaceError));
+		TestTrue(FString::Printf(TEXT("Surface round trip within tolerance at 1e%d"), Decade), SurfaceError <= Tolerance);
+		TestTrue(FString::Printf(TEXT("Space round trip within tolerance at 1e%d"), Decade), SpaceError <= Tolerance);
+		WorstError = FMath::Max(WorstError, FMath::Max(SurfaceError, SpaceError));
+	}
+	AddInfo(FString::Printf(TEXT("Worst round-trip error over all decades: %.3g UU"), WorstError));
+	return true;
+}
+
+// ---------------------------------------------------------------------------
+// 2. Geometry: arc length along the axes, altitude preserved, far hemisphere, altitude clamps
+// ---------------------------------------------------------------------------
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FPlanetSurfaceMappingGeometry,
+	"FederationGame.Planet.PlanetSurfaceMapping.Geometry",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter
+)
+
+bool FPlanetSurfaceMappingGeometry::RunTest(const FString& Parameters)
+{
+	const double R = 100000.0;
+	const FVector Center(3.0e9, -2.0e9, 5.0e8);
+	const FPlanetSurfaceMapping Mapping = MakeTestMapping(Center, R, FVector::UpVector, 300.0);
+	const FVector Top = Center + FVector(0.0, 0.0, R);
+
+	TestTrue(TEXT("Anchor point maps to the frame origin (raised to min altitude)"),
+		Mapping.SpaceToSurface(Top + FVector(0.0, 0.0, 300.0)).Equals(Mapping.GetSurfaceOrigin() + FVector(0.0, 0.0, 300.0), 1e-4));
+
+	// A quarter turn around the planet is a quarter circumference along the frame.
+	const FVector Surface = Mapping.SpaceToSurface(Center + FVector(R + 1000.0, 0.0, 0.0));
+	const FVector Local = Surface - Mapping.GetSurfaceOrigin();
+	TestTrue(TEXT("Quarter turn is R * pi/2 along the frame"), FMath::IsNearlyEqual(FMath::Abs(Local.X) + FMath::Abs(Local.Y), R * UE_DOUBLE_HALF_PI, 1e-3));
+	TestTrue(TEXT("Altitude carried over"), FMath::IsNearlyEqual(Local.Z, 1000.0, 1e-4));
+
+	// Diagonal offsets, where two sequential axis rotations were not an exact inverse.
+	const FVector Diagonal = Mapping.GetSurfaceOrigin() + FVector(30000.0, 40000.0, 6000.0);
+	TestTrue(TEXT("Diagonal offset round-trips exactly"), Diagonal.Equals(Mapping.SpaceToSurface(Mapping.SurfaceToSpace(Diagonal)), 1e-4));
+	TestTrue(TEXT("Diagonal offset keeps its altitude"),
+		FMath::IsNearlyEqual(FVector::Dist(Mapping.SurfaceToSpace(Diagonal), Center), R + 6000.0, 1e-4));
+
+	// Past 90 degrees of arc on both axes the inverse lands on the far hemisphere.
+	const FVector FarSide = Center + FVector(-0.3, -0.4, -0.5).GetSafeNormal() * (R + 2000.0);
+	TestTrue(TEXT("Far hemisphere round-trips"), FarSide.Equals(Mapping.SurfaceToSpace(Mapping.SpaceToSurface(FarSide)), 1e-3));
+
+	// Below the sphere: surface positions are raised to the minimum altitude, space positions land on the sphere.
+	TestTrue(TEXT("Underground space position raised to min altitude"),
+		FMath::IsNearlyEqual(FVector::DotProduct(Mapping.SpaceToSurface(Center) - Mapping.GetSurfaceOrigin(), FVector::UpVector), 300.0, 1e-4));
+	TestTrue(TEXT("Below-frame surface position lands on the sphere"),
+		FMath::IsNearlyEqual(FVector::Dist(Mapping.SurfaceToSpace(Mapping.GetSurfaceOrigin() - FVector(0.0, 0.0, 5000.0)), Center), R, 1e-4));
+	return true;
+}
+
+// ---------------------------------------------------------------------------
+// 3. Batch conversion matches per-position conversion (in place too)
+// ---------------------------------------------------------------------------
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FPlanetSurfaceMappingBatch,
+	"FederationGame.Planet.PlanetSurfaceMapping.Batch",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter
+)
+
+bool FPlanetSurfaceMappingBatch::RunTest(const FString& Parameters)
+{
+	FRandomStream Rng(77);
+	const double R = 250000.0;
+	const FVector Center(1.0e10, 0.0, 0.0);
+	const FPlanetSurfaceMapping Mapping = MakeTestMapping(Center, R, FVector(0.2, 0.9, 0.4));
+
+	TArray<FVector> Space;
+	for (int32 i = 0; i < 256; ++i)
+	{
+		Space.Add(Center + (Mapping.GetNormal() + Rng.GetUnitVector() * 0.5).GetSafeNormal() * (R + Rng.FRandRange(0.0, 20000.0)));
+	}
+
+	TArray<FVector> Surface;
+	Surface.SetNumUninitialized(Space.Num());
+	Mapping.SpaceToSurface(Space, Surface);
+
+	TArray<FVector> InPlace = Surface;
+	Mapping.SurfaceToSpace(InPlace, InPlace);
+
+	int32 NumMismatched = 0;
+	double MaxError = 0.0;
+	for (int32 i = 0; i < Space.Num(); ++i)
+	{
+		NumMismatched += Surface[i] == Mapping.SpaceToSurface(Space[i]) ? 0 : 1;
+		NumMismatched += InPlace[i] == Mapping.SurfaceToSpace(Surface[i]) ? 0 : 1;
+		MaxError = FMath::Max(MaxError, FVector::Dist(InPlace[i], Space[i]));
+	}
+	TestEqual(TEXT("Batch results identical to single conversions"), NumMismatched, 0);
+	TestTrue(FString::Printf(TEXT("Batch round trip at 1e10 UU within 0.01 UU (max %.3g)"), MaxError), MaxError <= 0.01);
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -3,6 +3,10 @@
 #include "Misc/AutomationTest.h"
 #include "Planet/PlanetSurfaceStreamer.h"
 #include "Planet/PlanetGravityComponent.h"
+#include "Planet/PlanetLODMesh.h"
+#include "Planet/PlanetStreamingSubsystem.h"
+#include "Planet/Planet.h"
+#include "Character/FederationCharacter.h"
 #include "Engine/World.h"
 #include "Tests/AutomationCommon.h"
 #include "GameFramework/Character.h"
@@ -503,6 +507,49 @@ static AActor* SpawnPlanetWithStreamer(
 	return Actor;
 }
 
+// ---------------------------------------------------------------------------
+// Helper: run a headless staged handoff (no streamed level, so nothing holds
+// a stage). Planet of radius 1e5 at (2e6, 0, 0), surface frame under -X, a
+// character 2000 UU above it, then up to 16 frames of AdvanceSurfaceHandoff.
+// ---------------------------------------------------------------------------
+struct FHeadlessHandoff
+{
+	AActor* Planet = nullptr;
+	UPlanetSurfaceStreamer* Comp = nullptr;
+	AFederationCharacter* Character = nullptr;
+	/** Where the character started in space. */
+	FVector SpacePos = FVector::ZeroVector;
+	bool bCompleted = false;
+
+	void Destroy()
+	{
+		if (Character) Character->Destroy();
+		if (Planet) Planet->Destroy();
+	}
+};
+
+static bool RunHeadlessHandoff(FAutomationTestBase& Test, UWorld* World, FHeadlessHandoff& Out)
+{
+	const FVector PlanetCenter(2000000.f, 0.f, 0.f);
+	const float R = 100000.f;
+	Out.Planet = SpawnPlanetWithStreamer(World, Out.Comp, PlanetCenter, R);
+	if (!Out.Planet || !Out.Comp) { Test.AddError(TEXT("Spawn failed")); return false; }
+
+	Out.Comp->SurfaceLevelWorldOrigin = PlanetCenter + FVector(-R, 0.f, 0.f);
+	Out.Comp->ComputeTangentFrame(PlanetCenter);
+	Out.SpacePos = PlanetCenter + FVector(-(R + 2000.f), 0.f, 0.f);
+	Out.Character = World->SpawnActor<AFederationCharacter>(Out.SpacePos, FRotator::ZeroRotator);
+	if (!Out.Character) { Out.Destroy(); Test.AddError(TEXT("Failed to spawn character")); return false; }
+
+	Out.Comp->BeginSurfaceHandoff(Out.Character);
+	Test.TestTrue(TEXT("Handoff in progress"), Out.Comp->IsHandoffInProgress());
+	for (int32 Frame = 0; Frame < 16 && !Out.bCompleted; ++Frame)
+	{
+		Out.bCompleted = Out.Comp->AdvanceSurfaceHandoff();
+	}
+	return true;
+}
+
 // ===========================================================================
 // 5a. Missing planet approach tests
 // ===========================================================================
@@ -2440,7 +2487,7 @@ bool FPlanetStreamerAutoScaleMinFloor::RunTest(const FString& Parameters)
 }
 
 // ---------------------------------------------------------------------------
-// 71. Fixed anchor: TransitionPlayerToSurface preserves origin from BeginStreamIn
+// 71. Fixed anchor: surface handoff preserves origin from BeginStreamIn
 // ---------------------------------------------------------------------------
 
 IMPLEMENT_SIMPLE_AUTOMATION_TEST(
@@ -2532,4 +2579,322 @@ bool FPlanetStreamerDefaultAnchorUsesPlayerDirection::RunTest(const FString& Par
 	return true;
 }
 
+// ---------------------------------------------------------------------------
+// 73. Staged handoff: every stage stays within the per-frame budget
+// ---------------------------------------------------------------------------
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FPlanetStreamerStagedHandoffWithinBudget,
+	"FederationGame.Planet.PlanetSurfaceStreamer.StagedHandoffWithinBudget",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter
+)
+
+bool FPlanetStreamerStagedHandoffWithinBudget::RunTest(const FString& Parameters)
+{
+	UWorld* World = GEngine->GetWorldContexts()[0].World();
+	if (!World) { AddError(TEXT("No world")); return false; }
+
+	// Headless: no streamed level, so prewarm finishes at once and the stages themselves are timed.
+	FHeadlessHandoff Handoff;
+	if (!RunHeadlessHandoff(*this, World, Handoff)) return false;
+	UPlanetSurfaceStreamer* Comp = Handoff.Comp;
+
+	TestTrue(TEXT("Handoff completes"), Handoff.bCompleted);
+	TestEqual(TEXT("State is OnSurface"), Comp->GetStreamingState(), EPlanetStreamingState::OnSurface);
+	TestFalse(TEXT("Handoff no longer in progress"), Comp->IsHandoffInProgress());
+	TestTrue(TEXT("Planet shell hidden"), Handoff.Planet->IsHidden());
+	TestFalse(TEXT("Radial gravity disabled"), Handoff.Character->GravityComp->IsComponentTickEnabled());
+	TestTrue(TEXT("Player placed at the surface mapping of its space position"),
+		Handoff.Character->GetActorLocation().Equals(Comp->SpaceToSurfacePosition(Handoff.SpacePos), 1.f));
+
+	const FPlanetHandoffTimings& Timings = Comp->GetLastHandoffTimings();
+	for (int32 Stage = 1; Stage < static_cast<int32>(EPlanetHandoffStage::Count); ++Stage)
+	{
+		AddInfo(FString::Printf(TEXT("Stage %d: %.3f ms"), Stage, Timings.StageMs[Stage]));
+		TestTrue(FString::Printf(TEXT("Stage %d within %.1f ms budget"), Stage, Comp->HandoffFrameBudgetMs),
+			Timings.StageMs[Stage] <= Comp->HandoffFrameBudgetMs);
+	}
+	AddInfo(FString::Printf(TEXT("Handoff: %d frames, worst frame %.3f ms"), Timings.Frames, Timings.WorstFrameMs));
+
+	Handoff.Destroy();
+	return true;
+}
+
+// ---------------------------------------------------------------------------
+// 74. Cell grid: re-basing onto a neighbour cell keeps the player's place on the sphere
+// ---------------------------------------------------------------------------
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FPlanetStreamerCellRebaseKeepsPosition,
+	"FederationGame.Planet.PlanetSurfaceStreamer.CellRebaseKeepsPosition",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter
+)
+
+bool FPlanetStreamerCellRebaseKeepsPosition::RunTest(const FString& Parameters)
+{
+	UWorld* World = GEngine->GetWorldContexts()[0].World();
+	if (!World) { AddError(TEXT("No world")); return false; }
+
+	const FVector PlanetCenter(2000000.f, 0.f, 0.f);
+	const float R = 100000.f;
+	UPlanetSurfaceStreamer* Comp = nullptr;
+	AActor* Actor = SpawnPlanetWithStreamer(World, Comp, PlanetCenter, R);
+	if (!Actor || !Comp) { AddError(TEXT("Spawn failed")); return false; }
+
+	Comp->bUseCellGrid = true;
+	Comp->CellsPerFaceEdge = 8;
+	const FPlanetCellGrid Grid = Comp->GetCellGrid();
+	const FPlanetCellId From(0, 3, 3);
+	const FPlanetCellId To(0, 4, 3);
+
+	// Headless: no cell levels, so only the frame and the player move.
+	Comp->RebaseToSurfaceCell(From, nullptr);
+	TestTrue(TEXT("Active cell set"), Comp->GetActiveSurfaceCell() == From);
+	TestTrue(TEXT("Tile centered on the cell"),
+		Comp->SurfaceLevelWorldOrigin.Equals(PlanetCenter + Grid.GetCellCenterDirection(From) * R, 1.f));
+
+	// Stand 1000 UU up, just past the border into To.
+	const FVector FromDir = Grid.GetCellCenterDirection(From);
+	const FVector ToDir = Grid.GetCellCenterDirection(To);
+	const FVector PlayerDir = FQuat::Slerp(FQuat::Identity, FQuat::FindBetweenNormals(FromDir, ToDir), 0.6f).RotateVector(FromDir);
+	const FVector SpacePos = PlanetCenter + PlayerDir * (R + 1000.f);
+	AFederationCharacter* Character = World->SpawnActor<AFederationCharacter>(Comp->SpaceToSurfacePosition(SpacePos), FRotator::ZeroRotator);
+	if (!Character) { Actor->Destroy(); AddError(TEXT("Failed to spawn character")); return false; }
+	TestTrue(TEXT("Player is over the To cell"),
+		Grid.CellFromDirection(Comp->SurfaceToSpacePosition(Character->GetActorLocation()) - PlanetCenter) == To);
+
+	const FVector SphereBefore = Comp->SurfaceToSpacePosition(Character->GetActorLocation());
+	Comp->RebaseToSurfaceCell(To, Character);
+
+	TestTrue(TEXT("Active cell moved"), Comp->GetActiveSurfaceCell() == To);
+	TestTrue(TEXT("Frame normal is the new cell's center"), Comp->TangentNormal.Equals(ToDir, 1e-4f));
+	TestTrue(TEXT("Same place on the sphere"), Comp->SurfaceToSpacePosition(Character->GetActorLocation()).Equals(SphereBefore, 10.f));
+	TestTrue(TEXT("Same height above the tile"), FMath::IsNearlyEqual(
+		FVector::DotProduct(Character->GetActorLocation() - Comp->SurfaceLevelWorldOrigin, Comp->TangentNormal), 1000.f, 1.f));
+	TestTrue(TEXT("Gravity follows the new surface"),
+		Character->GetCharacterMovement()->GetGravityDirection().Equals(-ToDir, 1e-3f));
+	TestEqual(TEXT("No cell levels requested headless"), Comp->GetNumStreamedSurfaceCells(), 0);
+
+	Character->Destroy();
+	Actor->Destroy();
+	return true;
+}
+
+// ---------------------------------------------------------------------------
+// 75. UnifiedSeamless: LOD mesh instead of a streamed level, no predictive load
+// ---------------------------------------------------------------------------
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FPlanetStreamerUnifiedSeamlessUsesLODMesh,
+	"FederationGame.Planet.PlanetSurfaceStreamer.UnifiedSeamlessUsesLODMesh",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter
+)
+
+bool FPlanetStreamerUnifiedSeamlessUsesLODMesh::RunTest(const FString& Parameters)
+{
+	UWorld* World = GEngine->GetWorldContexts()[0].World();
+	if (!World) { AddError(TEXT("No world")); return false; }
+
+	UPlanetSurfaceStreamer* Comp = nullptr;
+	const FVector Center(0.f, 0.f, 500000.f);
+	AActor* Actor = SpawnPlanetWithStreamer(World, Comp, Center, 100000.f);
+	if (!Actor || !Comp) { AddError(TEXT("Spawn failed")); return false; }
+
+	Comp->TransitionProfile.TransitionMode = EPlanetTransitionMode::UnifiedSeamless;
+	Comp->LODSettings.MaxDepth = 3;
+	TestTrue(TEXT("Seamless mode selected"), Comp->UsesSeamlessLOD());
+	TestFalse(TEXT("No predictive level load in seamless mode"), Comp->BeginPredictiveStreamIn(Center + FVector(200000.f, 0.f, 0.f)));
+
+	Comp->TickComponent(0.016f, LEVELTICK_All, nullptr);
+	APlanetLODMesh* LODMesh = Comp->GetLODMesh();
+	TestNotNull(TEXT("LOD mesh spawned"), LODMesh);
+	TestEqual(TEXT("No surface level requested"), Comp->GetStreamingState(), EPlanetStreamingState::Idle);
+	if (LODMesh)
+	{
+		TestTrue(TEXT("LOD mesh at the planet center"), LODMesh->GetActorLocation().Equals(Center, 1.f));
+		TestTrue(TEXT("LOD radius matches the planet"), FMath::IsNearlyEqual(LODMesh->GetQuadtree().GetPlanetRadius(), 100000.0, 1.0));
+		TestEqual(TEXT("LOD depth from the streamer settings"), LODMesh->GetQuadtree().GetMaxDepth(), 3);
+	}
+
+	const TWeakObjectPtr<APlanetLODMesh> WeakLOD = LODMesh;
+	Actor->Destroy();
+	TestTrue(TEXT("LOD mesh destroyed with the planet"), !WeakLOD.IsValid() || WeakLOD->IsActorBeingDestroyed());
+	return true;
+}
+
+// ---------------------------------------------------------------------------
+// 76. Telemetry: a finished handoff records its worst frame in the world's histograms
+// ---------------------------------------------------------------------------
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FPlanetStreamerHandoffRecordsTelemetry,
+	"FederationGame.Planet.PlanetSurfaceStreamer.HandoffRecordsTelemetry",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter
+)
+
+bool FPlanetStreamerHandoffRecordsTelemetry::RunTest(const FString& Parameters)
+{
+	UWorld* World = GEngine->GetWorldContexts()[0].World();
+	if (!World) { AddError(TEXT("No world")); return false; }
+	UPlanetStreamingSubsystem* Sub = World->GetSubsystem<UPlanetStreamingSubsystem>();
+	if (!Sub) { AddError(TEXT("No streaming subsystem")); return false; }
+
+	const FPlanetTimingHistogram& Handoffs = Sub->GetTelemetry().GetHistogram(EPlanetStreamingMetric::HandoffFrame);
+	const int32 CountBefore = Handoffs.GetCount();
+
+	FHeadlessHandoff Handoff;
+	if (!RunHeadlessHandoff(*this, World, Handoff)) return false;
+
+	TestTrue(TEXT("Handoff completes"), Handoff.bCompleted);
+	TestEqual(TEXT("One handoff sample recorded"), Handoffs.GetCount(), CountBefore + 1);
+	TestTrue(TEXT("Histogram max covers this handoff's worst frame"), Handoffs.GetMax() >= Handoff.Comp->GetLastHandoffTimings().WorstFrameMs - KINDA_SMALL_NUMBER);
+	AddInfo(Sub->GetTelemetry().GetSummary(EPlanetStreamingMetric::HandoffFrame));
+
+	Handoff.Destroy();
+	return true;
+}
+
+// ---------------------------------------------------------------------------
+// 77. Fade parameters: the idle planet stops pushing once its values are set
+// ---------------------------------------------------------------------------
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FPlanetStreamerIdleFadeNoRepush,
+	"FederationGame.Planet.PlanetSurfaceStreamer.IdleFadeDoesNotRepush",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter
+)
+
+bool FPlanetStreamerIdleFadeNoRepush::RunTest(const FString& Parameters)
+{
+	UWorld* World = GEngine->GetWorldContexts()[0].World();
+	if (!World) { AddError(TEXT("No world")); return false; }
+
+	APlanet* Planet = World->SpawnActor<APlanet>();
+	if (!Planet || !Planet->PlanetSurfaceStreamer) { AddError(TEXT("Failed to spawn APlanet")); return false; }
+	UPlanetSurfaceStreamer* Comp = Planet->PlanetSurfaceStreamer;
+
+	// No player: the planet stays Idle and only writes its rest fade (alpha 1, no reveal sphere).
+	Comp->TickComponent(0.016f, LEVELTICK_All, nullptr);
+	const int32 FirstPushes = Comp->GetFadeParameterCache().GetNumPushes();
+	TestTrue(TEXT("Rest values pushed once the fade MID exists"), FirstPushes > 0);
+
+	for (int32 Frame = 0; Frame < 10; ++Frame)
+	{
+		Comp->TickComponent(0.016f, LEVELTICK_All, nullptr);
+	}
+	TestEqual(TEXT("No pushes while the values don't change"), Comp->GetFadeParameterCache().GetNumPushes(), FirstPushes);
+	TestTrue(TEXT("Idle ticks were skipped"), Comp->GetFadeParameterCache().GetNumSkipped() >= 10);
+
+	Planet->Destroy();
+	return true;
+}
+
+// ---------------------------------------------------------------------------
+// 78. Handoff timings: every stage, warm-up included, reports its frames, time and game-thread cost
+// ---------------------------------------------------------------------------
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FPlanetStreamerHandoffStageBreakdown,
+	"FederationGame.Planet.PlanetSurfaceStreamer.HandoffStageBreakdown",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter
+)
+
+bool FPlanetStreamerHandoffStageBreakdown::RunTest(const FString& Parameters)
+{
+	UWorld* World = GEngine->GetWorldContexts()[0].World();
+	if (!World) { AddError(TEXT("No world")); return false; }
+
+	// Headless: no surface content, so the warm-up has nothing to request and never holds the handoff.
+	FHeadlessHandoff Handoff;
+	if (!RunHeadlessHandoff(*this, World, Handoff)) return false;
+	TestTrue(TEXT("Handoff completes"), Handoff.bCompleted);
+	TestTrue(TEXT("Warm with no warm-up running"), Handoff.Comp->IsSurfaceContentWarm());
+
+	const FPlanetHandoffTimings& Timings = Handoff.Comp->GetLastHandoffTimings();
+	for (int32 Stage = 1; Stage < static_cast<int32>(EPlanetHandoffStage::Count); ++Stage)
+	{
+		TestTrue(FString::Printf(TEXT("Stage %d ran"), Stage), Timings.StageFrames[Stage] >= 1);
+		TestTrue(FString::Printf(TEXT("Stage %d total covers its worst run"), Stage), Timings.StageTotalMs[Stage] >= Timings.StageMs[Stage] - KINDA_SMALL_NUMBER);
+		TestTrue(FString::Printf(TEXT("Stage %d wall time covers its cost"), Stage), Timings.StageSeconds[Stage] * 1000.f >= Timings.StageTotalMs[Stage] - 0.01f);
+	}
+	TestEqual(TEXT("Nothing to warm"), Timings.WarmUpRequests, 0);
+	TestEqual(TEXT("Deadline not hit"), Timings.WarmUpOutstanding, 0);
+
+	Handoff.Destroy();
+	return true;
+}
+
+// ---------------------------------------------------------------------------
+// 79. Cell grid: a neighbour tile meets the active one without a step, before and after a re-base
+// ---------------------------------------------------------------------------
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FPlanetStreamerCellSeamContinuity,
+	"FederationGame.Planet.PlanetSurfaceStreamer.CellSeamContinuity",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter
+)
+
+bool FPlanetStreamerCellSeamContinuity::RunTest(const FString& Parameters)
+{
+	UWorld* World = GEngine->GetWorldContexts()[0].World();
+	if (!World) { AddError(TEXT("No world")); return false; }
+
+	const FVector PlanetCenter(2000000.f, 0.f, 0.f);
+	const float R = 100000.f;
+	UPlanetSurfaceStreamer* Comp = nullptr;
+	AActor* Actor = SpawnPlanetWithStreamer(World, Comp, PlanetCenter, R);
+	if (!Actor || !Comp) { AddError(TEXT("Spawn failed")); return false; }
+
+	Comp->bUseCellGrid = true;
+	Comp->CellsPerFaceEdge = 8;
+	const FPlanetCellGrid Grid = Comp->GetCellGrid();
+	const FPlanetCellId From(0, 3, 3);
+	const FPlanetCellId To(0, 4, 3);
+	const FPlanetTerrainGenerator Generator(Comp->TerrainSettings, R);
+	const double HalfExtent = Comp->GetDesiredPatchRadius();
+
+	// Ground height at surface point P, as the tile placed at Transform with Frame would build it.
+	auto TileHeightAt = [](const FPlanetTerrainGenerator& Gen, const FTransform& Transform, const FPlanetTerrainTileFrame& Frame, const FVector& P)
+	{
+		const FVector Local = P - Transform.GetLocation();
+		return Gen.SampleHeight(FPlanetTerrainGenerator::TileLocalToDirection(Frame,
+			FVector::DotProduct(Local, Frame.AxisX), FVector::DotProduct(Local, Frame.AxisY)));
+	};
+
+	for (const FPlanetCellId& Active : { From, To })
+	{
+		const FPlanetCellId& Neighbour = (Active == From) ? To : From;
+		Comp->RebaseToSurfaceCell(Active, nullptr);
+		const FString Label = (Active == From) ? TEXT("Before re-base") : TEXT("After re-base");
+
+		FPlanetTerrainTileFrame ActiveFrame, NeighbourFrame;
+		const FTransform ActiveTransform = Comp->MakeSurfaceCellTransform(Grid.GetCellCenterDirection(Active), ActiveFrame);
+		const FTransform NeighbourTransform = Comp->MakeSurfaceCellTransform(Grid.GetCellCenterDirection(Neighbour), NeighbourFrame);
+
+		TestTrue(Label + TEXT(": active tile sits on the frame origin"), ActiveTransform.GetLocation().Equals(Comp->SurfaceLevelWorldOrigin, 1.f));
+		TestTrue(Label + TEXT(": neighbour turned like the active tile"), NeighbourTransform.GetRotation().Equals(ActiveTransform.GetRotation(), 1e-6f));
+		TestTrue(Label + TEXT(": neighbour in the same plane"), FMath::IsNearlyZero(
+			FVector::DotProduct(NeighbourTransform.GetLocation() - Comp->SurfaceLevelWorldOrigin, Comp->TangentNormal), 1.0));
+		TestTrue(Label + TEXT(": neighbour centered where the mapping puts its cell"),
+			Comp->SurfaceToSpacePosition(NeighbourTransform.GetLocation()).Equals(PlanetCenter + Grid.GetCellCenterDirection(Neighbour) * R, 1.f));
+
+		// The tiles' facing edges meet (no gap or pile-up along the step between them).
+		const FVector2D Step(NeighbourFrame.CenterX - ActiveFrame.CenterX, NeighbourFrame.CenterY - ActiveFrame.CenterY);
+		TestTrue(Label + TEXT(": edges meet"), FMath::Abs(FMath::Max(FMath::Abs(Step.X), FMath::Abs(Step.Y)) - 2.0 * HalfExtent) < 0.05 * HalfExtent);
+
+		// Along the shared border both tiles build the same ground.
+		const FVector2D Along = FVector2D(-Step.Y, Step.X).GetSafeNormal();
+		for (int32 i = -4; i <= 4; ++i)
+		{
+			const FVector2D Flat = Step * 0.5 + Along * (HalfExtent * 0.2 * i);
+			const FVector P = ActiveTransform.GetLocation() + Comp->TangentX * Flat.X + Comp->TangentY * Flat.Y;
+			TestEqual(FString::Printf(TEXT("%s: border point %d height"), *Label, i),
+				TileHeightAt(Generator, NeighbourTransform, NeighbourFrame, P), TileHeightAt(Generator, ActiveTransform, ActiveFrame, P), 1e-2f);
+		}
+	}
+
+	Actor->Destroy();
+	return true;
+}
+
 #endif // WITH_DEV_AUTOMATION_TESTS
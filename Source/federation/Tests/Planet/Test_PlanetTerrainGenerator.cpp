@@ -0,0 +1,249 @@
+// Copyright Federation Game. All Rights Reserved.
+
+#include "Misc/AutomationTest.h"
+#include "Planet/PlanetTerrainGenerator.h"
+#include "Planet/PlanetTerrainTile.h"
+#include "Planet/PlanetSurfaceMapping.h"
+#include "Async/TaskGraphInterfaces.h"
+#include "Components/DynamicMeshComponent.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "Math/RandomStream.h"
+#include "Tasks/Task.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+static FPlanetTerrainTileFrame MakeTestFrame(double PlanetRadius, double HalfExtent)
+{
+	FPlanetTerrainTileFrame Frame;
+	Frame.Normal = FVector(0.6, 0.0, 0.8);
+	Frame.AxisX = FVector::CrossProduct(FVector::UpVector, Frame.Normal).GetSafeNormal();
+	Frame.AxisY = FVector::CrossProduct(Frame.Normal, Frame.AxisX).GetSafeNormal();
+	Frame.PlanetRadius = PlanetRadius;
+	Frame.HalfExtent = HalfExtent;
+	return Frame;
+}
+
+// ---------------------------------------------------------------------------
+// 1. Determinism: same seed, same heights; batched and single samples agree
+// ---------------------------------------------------------------------------
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FPlanetTerrainGeneratorDeterminism,
+	"FederationGame.Planet.TerrainGenerator.Determinism",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter
+)
+
+bool FPlanetTerrainGeneratorDeterminism::RunTest(const FString& Parameters)
+{
+	FPlanetTerrainSettings Settings;
+	const FPlanetTerrainGenerator A(Settings, 100000.0);
+	const FPlanetTerrainGenerator B(Settings, 100000.0);
+	Settings.Seed += 1;
+	const FPlanetTerrainGenerator Other(Settings, 100000.0);
+
+	FRandomStream Rng(42);
+	TArray<float> DirX, DirY, DirZ;
+	int32 Differing = 0;
+	float MaxAbsHeight = 0.f;
+	for (int32 i = 0; i < 256; ++i)
+	{
+		const FVector Dir = Rng.GetUnitVector();
+		const float H = A.SampleHeight(Dir);
+		TestEqual(TEXT("Same settings give the same height"), B.SampleHeight(Dir), H);
+		Differing += FMath::IsNearlyEqual(Other.SampleHeight(Dir), H, 1.f) ? 0 : 1;
+		MaxAbsHeight = FMath::Max(MaxAbsHeight, FMath::Abs(H));
+		DirX.Add(static_cast<float>(Dir.X));
+		DirY.Add(static_cast<float>(Dir.Y));
+		DirZ.Add(static_cast<float>(Dir.Z));
+	}
+	TestTrue(TEXT("A different seed gives different terrain"), Differing > 200);
+	// Gradient noise peaks slightly above 1, hence the margin.
+	TestTrue(TEXT("Heights stay within the height scale"), MaxAbsHeight <= A.GetSettings().HeightScale * 1.1f);
+	TestTrue(TEXT("Terrain is not flat"), MaxAbsHeight > A.GetSettings().HeightScale * 0.05f);
+
+	TArray<float> Batch;
+	Batch.SetNumUninitialized(DirX.Num());
+	A.SampleHeights(DirX, DirY, DirZ, Batch);
+	for (int32 i = 0; i < Batch.Num(); ++i)
+	{
+		TestEqual(TEXT("Batch matches single sample"), Batch[i], A.SampleHeight(FVector(DirX[i], DirY[i], DirZ[i])));
+	}
+	return true;
+}
+
+// ---------------------------------------------------------------------------
+// 2. Neighbouring chunks share border vertices, heights and normals
+// ---------------------------------------------------------------------------
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FPlanetTerrainGeneratorChunkSeams,
+	"FederationGame.Planet.TerrainGenerator.ChunkSeams",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter
+)
+
+bool FPlanetTerrainGeneratorChunkSeams::RunTest(const FString& Parameters)
+{
+	FPlanetTerrainSettings Settings;
+	Settings.ChunkResolution = 9;
+	const FPlanetTerrainGenerator Generator(Settings, 100000.0);
+	const FPlanetTerrainTileFrame Frame = MakeTestFrame(100000.0, 20000.0);
+
+	FPlanetTerrainChunkData Left, Right;
+	Generator.BuildChunk(Frame, 0, 1, 3, Left);
+	Generator.BuildChunk(Frame, 1, 1, 3, Right);
+
+	const int32 Res = Settings.ChunkResolution;
+	TestEqual(TEXT("Res * Res vertices"), Left.Positions.Num(), Res * Res);
+	TestEqual(TEXT("Two triangles per quad"), Left.Indices.Num(), (Res - 1) * (Res - 1) * 6);
+	for (int32 j = 0; j < Res; ++j)
+	{
+		const int32 L = j * Res + (Res - 1);
+		const int32 R = j * Res;
+		TestTrue(TEXT("Border vertex matches"), Left.Positions[L].Equals(Right.Positions[R], 0.01f));
+		TestTrue(TEXT("Border normal matches"), Left.Normals[L].Equals(Right.Normals[R], 1e-4f));
+	}
+
+	// Vertex heights are the sphere samples under them.
+	const FVector3f& Corner = Left.Positions[0];
+	const FVector Dir = FPlanetTerrainGenerator::TileLocalToDirection(Frame, Corner.X, Corner.Y);
+	TestTrue(TEXT("Vertex height is the sampled height"), FMath::IsNearlyEqual(Corner.Z, Generator.SampleHeight(Dir), 1.f));
+	TestTrue(TEXT("Min/max bracket every vertex"), Left.MinHeight <= Corner.Z && Corner.Z <= Left.MaxHeight);
+
+	// Triangles face up (+Z in tile space).
+	const FVector3f& P0 = Left.Positions[Left.Indices[0]];
+	const FVector3f& P1 = Left.Positions[Left.Indices[1]];
+	const FVector3f& P2 = Left.Positions[Left.Indices[2]];
+	TestTrue(TEXT("Winding faces up"), ((P2 - P0) ^ (P1 - P0)).Z > 0.f);
+	return true;
+}
+
+// ---------------------------------------------------------------------------
+// 3. Tile: worker chunks become mesh components, at most the upload budget per call
+// ---------------------------------------------------------------------------
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FPlanetTerrainTileUploadBudget,
+	"FederationGame.Planet.TerrainGenerator.TileUploadBudget",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter
+)
+
+bool FPlanetTerrainTileUploadBudget::RunTest(const FString& Parameters)
+{
+	UWorld* World = GEngine->GetWorldContexts()[0].World();
+	if (!World) { AddError(TEXT("No world")); return false; }
+
+	APlanetTerrainTile* Tile = World->SpawnActor<APlanetTerrainTile>();
+	if (!Tile) { AddError(TEXT("Spawn failed")); return false; }
+
+	FPlanetTerrainSettings Settings;
+	Settings.ChunkResolution = 9;
+	Tile->BeginGenerate(Settings, MakeTestFrame(100000.0, 20000.0), 2, nullptr);
+	TestEqual(TEXT("2 x 2 chunks"), Tile->GetNumChunks(), 4);
+	TestFalse(TEXT("Not complete before upload"), Tile->IsGenerationComplete());
+
+	Tile->WaitForChunkTasks();
+	TestEqual(TEXT("Upload honours the budget"), Tile->UploadCompletedChunks(1), 1);
+	TestEqual(TEXT("Rest uploaded next"), Tile->UploadCompletedChunks(8), 3);
+	TestTrue(TEXT("Complete once all chunks are uploaded"), Tile->IsGenerationComplete());
+
+	for (int32 i = 0; i < Tile->GetNumChunks(); ++i)
+	{
+		const UDynamicMeshComponent* Chunk = Tile->GetChunkComponent(i);
+		TestTrue(TEXT("Chunk component exists"), Chunk != nullptr);
+		TestTrue(TEXT("Chunk has triangles"), Chunk && Chunk->GetMesh()->TriangleCount() == 8 * 8 * 2);
+	}
+
+	Tile->Destroy();
+	return true;
+}
+
+// ---------------------------------------------------------------------------
+// 4. Benchmark: chunk throughput on one thread vs. spread over the task workers
+// ---------------------------------------------------------------------------
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FPlanetTerrainGeneratorThroughput,
+	"FederationGame.Planet.TerrainGenerator.ChunkThroughputBenchmark",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::PerfFilter
+)
+
+bool FPlanetTerrainGeneratorThroughput::RunTest(const FString& Parameters)
+{
+	const FPlanetTerrainSettings Settings;
+	const FPlanetTerrainTileFrame Frame = MakeTestFrame(600000.0, 40000.0);
+	constexpr int32 ChunksPerEdge = 8;
+	constexpr int32 NumChunks = ChunksPerEdge * ChunksPerEdge;
+
+	const double SerialStart = FPlatformTime::Seconds();
+	{
+		const FPlanetTerrainGenerator Generator(Settings, Frame.PlanetRadius);
+		FPlanetTerrainChunkData Chunk;
+		for (int32 i = 0; i < NumChunks; ++i)
+		{
+			Generator.BuildChunk(Frame, i % ChunksPerEdge, i / ChunksPerEdge, ChunksPerEdge, Chunk);
+		}
+	}
+	const double SerialSeconds = FPlatformTime::Seconds() - SerialStart;
+
+	const double ParallelStart = FPlatformTime::Seconds();
+	{
+		TArray<UE::Tasks::FTask> Tasks;
+		for (int32 i = 0; i < NumChunks; ++i)
+		{
+			Tasks.Add(UE::Tasks::Launch(UE_SOURCE_LOCATION, [&Settings, &Frame, i]()
+			{
+				FPlanetTerrainChunkData Chunk;
+				FPlanetTerrainGenerator(Settings, Frame.PlanetRadius).BuildChunk(Frame, i % ChunksPerEdge, i / ChunksPerEdge, ChunksPerEdge, Chunk);
+			}));
+		}
+		UE::Tasks::Wait(Tasks);
+	}
+	const double ParallelSeconds = FPlatformTime::Seconds() - ParallelStart;
+
+	const int32 Workers = FMath::Max(1, FTaskGraphInterface::Get().GetNumWorkerThreads());
+	const double SerialRate = NumChunks / FMath::Max(SerialSeconds, 1e-6);
+	const double ParallelRate = NumChunks / FMath::Max(ParallelSeconds, 1e-6);
+	AddInfo(FString::Printf(TEXT("%d chunks of %d^2 vertices, %d octaves"), NumChunks, Settings.ChunkResolution, Settings.Octaves));
+	AddInfo(FString::Printf(TEXT("1 thread: %.1f chunks/s"), SerialRate));
+	AddInfo(FString::Printf(TEXT("%d workers: %.1f chunks/s (%.1f chunks/s/core, %.2fx)"), Workers, ParallelRate, ParallelRate / Workers, ParallelRate / SerialRate));
+	TestTrue(TEXT("Generation completed"), SerialSeconds > 0.0 && ParallelSeconds > 0.0);
+	return true;
+}
+
+// ---------------------------------------------------------------------------
+// 5. Tile vertices sample the same direction the surface mapping gives, off both axes too
+// ---------------------------------------------------------------------------
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FPlanetTerrainGeneratorMatchesSurfaceMapping,
+	"FederationGame.Planet.TerrainGenerator.MatchesSurfaceMapping",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter
+)
+
+bool FPlanetTerrainGeneratorMatchesSurfaceMapping::RunTest(const FString& Parameters)
+{
+	constexpr double Radius = 100000.0;
+	const FPlanetTerrainTileFrame Frame = MakeTestFrame(Radius, 40000.0);
+	const FVector Center(3.0e9, -1.0e9, 2.0e8);
+	const FVector SurfaceOrigin(1000.0, 2000.0, -500.0);
+	const FPlanetSurfaceMapping Mapping(Center, Radius, SurfaceOrigin, Frame.Normal, Frame.AxisX, Frame.AxisY);
+	const FPlanetTerrainGenerator Generator(FPlanetTerrainSettings(), Radius);
+
+	// Diagonals are where sequential rotations and the closed form part ways.
+	const FVector2D Points[] = {
+		FVector2D(40000.0, 40000.0), FVector2D(-40000.0, 40000.0), FVector2D(25000.0, -38000.0),
+		FVector2D(-12000.0, -31000.0), FVector2D(3.0, -7.0), FVector2D(40000.0, 0.0), FVector2D(0.0, -40000.0)
+	};
+	for (const FVector2D& Point : Points)
+	{
+		const FVector TileDir = FPlanetTerrainGenerator::TileLocalToDirection(Frame, Point.X, Point.Y);
+		const FVector MappedDir = (Mapping.SurfaceToSpace(SurfaceOrigin + Frame.AxisX * Point.X + Frame.AxisY * Point.Y) - Center).GetSafeNormal();
+		TestTrue(FString::Printf(TEXT("Direction at (%.0f, %.0f) matches the mapping"), Point.X, Point.Y), TileDir.Equals(MappedDir, 1e-9));
+		TestEqual(FString::Printf(TEXT("Ground height at (%.0f, %.0f) matches"), Point.X, Point.Y),
+			Generator.SampleHeight(TileDir), Generator.SampleHeight(MappedDir), 1e-3f);
+	}
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,143 @@
+// Copyright Federation Game. All Rights Reserved.
+
+#include "Misc/AutomationTest.h"
+#include "Planet/PlanetTrajectoryPredictor.h"
+#include "Planet/PlanetSurfaceStreamer.h"
+#include "Tests/AutomationCommon.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+// ---------------------------------------------------------------------------
+// 1. Straight line: arrival time matches distance / speed, ranked soonest first.
+// ---------------------------------------------------------------------------
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FPlanetTrajectoryPredictorStraightLine,
+	"FederationGame.Planet.TrajectoryPredictor.StraightLineArrivals",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter
+)
+
+bool FPlanetTrajectoryPredictorStraightLine::RunTest(const FString& Parameters)
+{
+	FPlanetTrajectoryPredictor Predictor;
+	Predictor.HorizonSeconds = 10.f;
+
+	// Listed far-first so the output order has to come from arrival time.
+	const FPlanetStreamTarget Targets[] = {
+		{ 0, FVector(9000.f, 0.f, 0.f), 1000.0 },    // entered at x = 8000 -> t = 8
+		{ 1, FVector(5000.f, 0.f, 0.f), 1000.0 },    // entered at x = 4000 -> t = 4
+		{ 2, FVector(-5000.f, 0.f, 0.f), 1000.0 },   // behind the player
+		{ 3, FVector(50000.f, 0.f, 0.f), 1000.0 },   // beyond the horizon
+	};
+
+	TArray<FPlanetArrival> Arrivals;
+	Predictor.PredictArrivals(FVector::ZeroVector, FVector(1000.f, 0.f, 0.f), Targets,
+		[](const FVector&) { return FVector::ZeroVector; }, Arrivals);
+
+	if (!TestEqual(TEXT("Two targets reached"), Arrivals.Num(), 2)) return false;
+	TestEqual(TEXT("Nearest first"), Arrivals[0].Id, 1);
+	TestEqual(TEXT("Nearest arrival time"), Arrivals[0].TimeSeconds, 4.f, 0.01f);
+	TestTrue(TEXT("Entry point on sphere"), Arrivals[0].EntryPoint.Equals(FVector(4000.f, 0.f, 0.f), 1.f));
+	TestEqual(TEXT("Second target"), Arrivals[1].Id, 0);
+	TestEqual(TEXT("Second arrival time"), Arrivals[1].TimeSeconds, 8.f, 0.01f);
+
+	// Already inside: immediate arrival.
+	Predictor.PredictArrivals(FVector(5000.f, 0.f, 0.f), FVector::ZeroVector, Targets,
+		[](const FVector&) { return FVector::ZeroVector; }, Arrivals);
+	TestEqual(TEXT("Inside target arrives at t=0"), Arrivals.Num() > 0 ? Arrivals[0].TimeSeconds : -1.f, 0.f);
+	return true;
+}
+
+// ---------------------------------------------------------------------------
+// 2. Gravity bends the path into a planet that pure velocity would miss.
+// ---------------------------------------------------------------------------
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FPlanetTrajectoryPredictorGravity,
+	"FederationGame.Planet.TrajectoryPredictor.GravityBendsPath",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter
+)
+
+bool FPlanetTrajectoryPredictorGravity::RunTest(const FString& Parameters)
+{
+	FPlanetTrajectoryPredictor Predictor;
+	Predictor.HorizonSeconds = 10.f;
+	Predictor.StepSeconds = 0.01f;
+
+	const FPlanetStreamTarget Targets[] = { { 7, FVector::ZeroVector, 5000.0 } };
+	const FVector Start(0.f, 10000.f, 0.f);
+	const FVector Velocity(2000.f, 0.f, 0.f); // Tangential: never gets closer than 10000 without gravity.
+
+	TArray<FPlanetArrival> Arrivals;
+	Predictor.PredictArrivals(Start, Velocity, Targets, [](const FVector&) { return FVector::ZeroVector; }, Arrivals);
+	TestEqual(TEXT("Missed without gravity"), Arrivals.Num(), 0);
+
+	// Constant 1000 UU/s^2 toward -Y: y(t) = 10000 - 500 t^2, x(t) = 2000 t; enters r = 5000 at t ~= 2.6.
+	Predictor.PredictArrivals(Start, Velocity, Targets, [](const FVector&) { return FVector(0.f, -1000.f, 0.f); }, Arrivals);
+	if (!TestEqual(TEXT("Reached with gravity"), Arrivals.Num(), 1)) return false;
+	TestEqual(TEXT("Target id"), Arrivals[0].Id, 7);
+	TestTrue(TEXT("Entry point on sphere"), FMath::IsNearlyEqual(Arrivals[0].EntryPoint.Size(), 5000.0, 10.0));
+
+	// Cross-check against a fine analytic scan of the same parabola.
+	float ExpectedT = -1.f;
+	for (float T = 0.f; T < 10.f; T += 0.0005f)
+	{
+		if (FVector(2000.f * T, 10000.f - 500.f * T * T, 0.f).Size() <= 5000.f) { ExpectedT = T; break; }
+	}
+	TestEqual(TEXT("Arrival time matches analytic path"), Arrivals[0].TimeSeconds, ExpectedT, 0.05f);
+	return true;
+}
+
+// ---------------------------------------------------------------------------
+// 3. Harness: time spent waiting at handoff, reactive radius only vs. with prediction.
+// ---------------------------------------------------------------------------
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FPlanetTrajectoryPredictorHandoffWait,
+	"FederationGame.Planet.TrajectoryPredictor.HandoffWaitBenchmark",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::PerfFilter
+)
+
+bool FPlanetTrajectoryPredictorHandoffWait::RunTest(const FString& Parameters)
+{
+	// Straight-in approach to a 100000 UU planet; the load takes LoadSeconds once started.
+	// Reactive: load starts when the player crosses the adaptive streaming radius.
+	// Predictive: load starts on the first frame the predicted path reaches the handoff radius (or reactive, if earlier).
+	UPlanetSurfaceStreamer* Streamer = NewObject<UPlanetSurfaceStreamer>();
+	constexpr float PlanetRadius = 100000.f;
+	constexpr double StartDistance = 3000000.0;
+	constexpr float FrameSeconds = 1.f / 60.f;
+	const float Speeds[] = { 10000.f, 50000.f, 100000.f };
+	const float LoadSeconds[] = { 2.f, 6.f, 10.f };
+
+	FPlanetTrajectoryPredictor Predictor;
+	for (const float Speed : Speeds)
+	{
+		const double StreamR = Streamer->ComputeAdaptiveStreamingRadius(PlanetRadius, Speed);
+		const double HandoffR = Streamer->ComputeAdaptiveHandoffRadius(PlanetRadius, Speed);
+		const double HandoffTime = (StartDistance - HandoffR) / Speed;
+		const double ReactiveStart = (StartDistance - StreamR) / Speed;
+
+		double PredictiveStart = ReactiveStart;
+		const FPlanetStreamTarget Target{ 0, FVector::ZeroVector, HandoffR };
+		TArray<FPlanetArrival> Arrivals;
+		for (double T = 0.0; T < ReactiveStart; T += FrameSeconds)
+		{
+			Predictor.PredictArrivals(FVector(StartDistance - Speed * T, 0.f, 0.f), FVector(-Speed, 0.f, 0.f),
+				MakeArrayView(&Target, 1), [](const FVector&) { return FVector::ZeroVector; }, Arrivals);
+			if (Arrivals.Num() > 0) { PredictiveStart = T; break; }
+		}
+
+		for (const float Load : LoadSeconds)
+		{
+			const double ReactiveWait = FMath::Max(0.0, ReactiveStart + Load - HandoffTime);
+			const double PredictiveWait = FMath::Max(0.0, PredictiveStart + Load - HandoffTime);
+			AddInfo(FString::Printf(TEXT("speed %.0f UU/s, load %.0fs: wait at handoff %.2fs reactive -> %.2fs predictive (lead %.2fs -> %.2fs)"),
+				Speed, Load, ReactiveWait, PredictiveWait, HandoffTime - ReactiveStart, HandoffTime - PredictiveStart));
+			TestTrue(TEXT("Prediction never waits longer"), PredictiveWait <= ReactiveWait + KINDA_SMALL_NUMBER);
+		}
+	}
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -2,6 +2,7 @@
 
 #include "UI/DevDiagnosticsWidget.h"
 #include "Core/FederationGameState.h"
+#include "Planet/PlanetStreamingSubsystem.h"
 #include "Components/TextBlock.h"
 #include "Components/VerticalBox.h"
 #include "Components/VerticalBoxSlot.h"
@@ -74,6 +75,7 @@ void UDevDiagnosticsWidget::BuildWidgetTree()
 	MakeLine(SpeedText, TEXT("Speed: 0"));
 	MakeLine(LevelText, TEXT("Level: ?"));
 	MakeLine(StreamText, TEXT("Stream: -"));
+	MakeLine(StreamTelemetryText, TEXT("Transitions: -"));
 	MakeLine(JetpackEnabledText, TEXT("Jetpack: False"));
 	MakeLine(JetpackBoostText, TEXT("Boost: False"));
 }
@@ -93,6 +95,17 @@ void UDevDiagnosticsWidget::NativeTick(const FGeometry& MyGeometry, float InDelt
 	}
 
 	UWorld* World = GetWorld();
+	const UPlanetStreamingSubsystem* Streaming = World ? World->GetSubsystem<UPlanetStreamingSubsystem>() : nullptr;
+	if (StreamTelemetryText && Streaming && !Streaming->GetTelemetry().IsEmpty())
+	{
+		const FPlanetStreamingTelemetry& Telemetry = Streaming->GetTelemetry();
+		const FPlanetTimingHistogram& Load = Telemetry.GetHistogram(EPlanetStreamingMetric::Load);
+		const FPlanetTimingHistogram& Handoff = Telemetry.GetHistogram(EPlanetStreamingMetric::HandoffFrame);
+		StreamTelemetryText->SetText(FText::FromString(FString::Printf(
+			TEXT("Transitions: load p50 %.2fs p95 %.2fs, handoff worst %.1fms, %d stalls"),
+			Load.GetPercentile(0.5), Load.GetPercentile(0.95), Handoff.GetMax(), Telemetry.GetTotalStalls())));
+	}
+
 	AFederationGameState* GS = World ? World->GetGameState<AFederationGameState>() : nullptr;
 	if (!GS) return;
 
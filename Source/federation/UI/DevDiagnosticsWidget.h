@@ -10,7 +10,7 @@ class UTextBlock;
 
 /**
  * Developer-only diagnostics overlay (UMG).
- * Shows speed, streaming state, jetpack status.
+ * Shows speed, streaming state, transition timing telemetry, jetpack status.
  * Toggled with the tilde (`) key; not shown to players in shipping builds.
  */
 UCLASS()
@@ -34,6 +34,9 @@ private:
 	UPROPERTY()
 	TObjectPtr<UTextBlock> StreamText;
 
+	UPROPERTY()
+	TObjectPtr<UTextBlock> StreamTelemetryText;
+
 	UPROPERTY()
 	TObjectPtr<UTextBlock> JetpackEnabledText;
 